@@ -1,6 +1,7 @@
 #!/usr/bin/perl
 
-# Convert parsed UsbSnoop logfile into vfs101 API calls
+# Convert parsed UsbSnoop logfile into vfs101 API calls, or with -b into a
+# command script for the play cycle (see src/script.h)
 # 
 # Copyright (c) 2010 Ray Lehtiniemi <rayl@mail.com>
 #
@@ -27,6 +28,13 @@ use warnings;
 # Input file handling
 #-----------------------------------------------------------------------------------
 
+# write a command script instead of C?
+my $script = 0;
+if (@ARGV and $ARGV[0] eq "-b") {
+	$script = 1;
+	shift @ARGV;
+}
+
 # All lines from the preprocessed tracefile. The current line being processed
 # sits on the top of the array and is popped off when processing is complete.
 my $curr = 0;
@@ -220,7 +228,6 @@ sub fmt_args {
 #-----------------------------------------------------------------------------------
 
 my $seq;
-my $max_seq = -1;
 my $last_cmd;
 
 
@@ -241,12 +248,16 @@ sub dump_send_3 {
 	$last_cmd = cmd_id $packet;
 }
 
+# replies as [ urb, offset in blob, length, bytes ]
+my @results;
+my $blob = 0;
+
 sub dump_recv_3 {
 	my $packet = strip grab "RECV";
 	warn "Response type mismatch..." unless $last_cmd == cmd_id $packet;
 	my @p2 = split /\s+/, $packet;
-	my $p2 = join "\\x", @p2;
-	printf "\t[ %5d ] = { %3d, \"\\x$p2\" },\n", $seq, $#p2+1;
+	push @results, [ $seq, $blob, $#p2+1, join "\\x", @p2 ];
+	$blob += $#p2+1;
 }
 
 sub dump_pnm {
@@ -280,7 +291,6 @@ sub dump_time {
 	my ($t) = next_line;
 	$t =~ m/^TIME: (\d+) (\d+)/;
 	$seq = $2;
-	$max_seq = $seq if $seq > $max_seq;
 }
 
 sub output_unchecked {
@@ -337,32 +347,111 @@ sub output_results {
 	}
 }
 
+
+
+#-----------------------------------------------------------------------------------
+# Command script output, see src/script.h
+#-----------------------------------------------------------------------------------
+
+my %sc = (END => 0x00, LOAD => 0x20, RESULT => 0x21, CHECK => 0x80);
+
+sub bytes {
+	map { hex $_ } split " ", $_[0];
+}
+
+sub script_send {
+	my @p = bytes strip grab "SEND";
+	my ($id) = splice @p, 0, 2;
+	$last_cmd = $id;
+	if (defined $seq) {
+		die "URB $seq is past 65535, the last one a command script can check\n" if $seq > 0xffff;
+		print pack "Cv C*", $id | $sc{CHECK}, $seq, @p;
+	} else {
+		print pack "C*", $id, @p;
+	}
+}
+
+sub script_recv {
+	my @p = bytes strip grab "RECV";
+	warn "Response type mismatch..." unless $last_cmd == $p[0];
+	print pack "CvC C*", $sc{RESULT}, $seq, $#p+1, @p;
+}
+
+sub script_load {
+	print pack "C", $sc{LOAD};
+	dump_pnm;
+}
+
+sub output_script {
+	if (looking_at "SEND") {
+		script_send;
+
+	} elsif (looking_at "RECV") {
+		script_recv;
+
+	} elsif (looking_at "LOAD") {
+		script_load;
+
+	} elsif (looking_at "TIME") {
+		dump_time;
+
+	} else {
+		warn next_line;
+	}
+}
+
 sub process_1 {
 	first_line;
 	&{$_[0]} while more_lines;
 }
 
+# built in memory and only printed once complete, so that a log the
+# script can't hold leaves nothing half written behind
+sub process_script {
+	my $script = "";
+	open my $out, ">", \$script or die;
+	my $stdout = select $out;
+	print "VFSSCR01";
+	process_1 \&output_script;
+	print pack "C", $sc{END};
+	select $stdout;
+	close $out;
+	binmode STDOUT;
+	print $script;
+}
+
 sub process_file {
 
-	print "int PREFIX_unchecked (struct vfs_dev *dev)\n";
+	print "static int PREFIX_unchecked (struct vfs_dev *dev)\n";
 	print "{\n";
 	process_1 \&output_unchecked;
 	print "\treturn 0;\n";
 	print "}\n";
 
-	print "int PREFIX_checked (struct vfs_dev *dev)\n";
+	print "static int PREFIX_checked (struct vfs_dev *dev)\n";
 	print "{\n";
 	process_1 \&output_checked;
 	print "\treturn 0;\n";
 	print "}\n";
 
-	print "struct result_table PREFIX_results =\n";
-	print "{\n";
-	print "\t$max_seq,\n";
-	print "\t{\n";
 	process_1 \&output_results;
-	print "\t}\n";
+	print "static const struct result PREFIX_result[] =\n";
+	print "{\n";
+	printf "\t{ %5d, %5d, %3d },\n", @$_[0..2] for @results;
+	print "};\n";
+	print "static const unsigned char PREFIX_blob[] =\n";
+	printf "\t/* %5d */ \"\\x%s\"\n", @$_[0,3] for @results;
+	print "\t;\n";
+	print "static struct result_table PREFIX_results =\n";
+	print "{\n";
+	print "\tnitems(PREFIX_result),\n";
+	print "\tPREFIX_result,\n";
+	print "\tPREFIX_blob,\n";
 	print "};\n";
 }
 
-process_file;
+if ($script) {
+	process_script;
+} else {
+	process_file;
+}
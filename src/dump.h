@@ -0,0 +1,325 @@
+/* vfs101 fingerprint driver: human readable packet and frame dumps
+ *
+ * Shared by proto.c and the trace decoder, so that a decoded trace reads
+ * exactly like the output proto.c prints without one. FRAME_SIZE must be
+ * defined before this file is included.
+ *
+ * Copyright (c) 2010 Damir Syabitov <dsyabitov@gmail.com>
+ * Copyright (c) 2010 Ray Lehtiniemi <rayl@mail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/* names of the protocol commands, indexed by command id */
+static const char *cmd_names[0x17] = {
+	NULL,          "Reset",       "GetVersion",  "GetPrint",
+	"GetParam",    "SetParam",    "GetConfig",   "DownloadPatch",
+	"GetRateData", "IspRequest",  "ProgramFlash","EraseFlash",
+	"LedStates",   "LedEvent",    "AbortPrint",  "Spare2",
+	"Spare3",      "Spare4",      "Peek",        "Poke",
+	"SensorSpiTrans", "SensorGPIO", "GetFingerState",
+};
+
+static int dump_buffer (FILE *f, const unsigned char *data, int length, unsigned char *prefix)
+{
+	int i = 0;
+	fprintf(f, "%s ", prefix);
+	for (i; i < length; i++)
+		fprintf(f, "%02X ", data[i]);
+	fprintf(f, "\n");
+	return length;
+}
+
+static int dump_frame_1 (FILE *f, unsigned char *d, int n)
+{
+	int i;
+
+	fprintf(f, "\n  ---------------------------- Packet %05d -----------------------------\n", n);
+	fprintf(f, "  {\n");
+	d += dump_buffer(f, d,  2, "  Line type       ");
+	d += dump_buffer(f, d,  2, "  Sequence        ");
+	d += dump_buffer(f, d,  2, "  ???             ");
+	fprintf(f, "\n");
+
+	d += dump_buffer(f, d, 16, "  Fingerprint A   ");
+	for (i=1; i<12; i++)
+		d += dump_buffer(f, d, 16, "                  ");
+	d += dump_buffer(f, d,  8, "                  ");
+	fprintf(f, "\n");
+
+	d += dump_buffer(f, d,  2, "  ???             ");
+	fprintf(f, "\n");
+
+	d += dump_buffer(f, d, 16, "  IMG B           ");
+	d += dump_buffer(f, d, 16, "                  ");
+	d += dump_buffer(f, d,  6, "                  ");
+	d += dump_buffer(f, d, 16, "  IMG C           ");
+	d += dump_buffer(f, d, 10, "                  ");
+	fprintf(f, "\n");
+
+	d += dump_buffer(f, d,  4, "  Constant        ");
+	d += dump_buffer(f, d,  2, "  Sequence'       ");
+	fprintf(f, "\n");
+
+	d += dump_buffer(f, d,  1, "  S_curr_state    ");
+	d += dump_buffer(f, d,  1, "  S_next_state    ");
+	d += dump_buffer(f, d,  2, "  S_count         ");
+	d += dump_buffer(f, d,  2, "  S_level         ");
+	d += dump_buffer(f, d,  8, "  ???             ");
+	fprintf(f, "  }\n");
+}
+
+/******************************************************************************************************
+ * Frame header resync
+ *
+ * A line starts with 01 FE (image) or 01 01 (info). An image line carries its
+ * sequence number twice, little endian at bytes 2-3 and big endian at 274-275;
+ * an info line has only a big endian one at bytes 2-3, so it is confirmed by
+ * the next line's header instead, one frame on. Pixel data often contains the
+ * header bytes, so frame_sync() prefers a header that passes its check, and
+ * only falls back on the header bytes alone when too little data is left to
+ * check it, or when no header in the buffer passes the check. Header
+ * candidates are found 32 (AVX2) or 16 (SSE2) bytes at a time where the
+ * compiler allows, with memchr() elsewhere.
+ */
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* what frame_sync() has seen of one scan */
+struct frame_stats {
+	unsigned long frames;		/* headers found */
+	unsigned long misaligned;	/* headers found only after skipping bytes */
+	unsigned long skipped;		/* bytes skipped to find them */
+	unsigned long rejected;		/* header bytes that failed the check, passed over */
+	unsigned long fallbacks;	/* headers taken though they failed the check */
+	unsigned long shorts;		/* frames too short to dump */
+};
+
+static void frame_stats_reset (struct frame_stats *st)
+{
+	memset(st, 0, sizeof(*st));
+}
+
+static void frame_stats_print (FILE *f, struct frame_stats *st)
+{
+	if (st->misaligned || st->rejected || st->fallbacks || st->shorts)
+		fprintf(f, "  resync: %lu frames, %lu misaligned (%lu bytes skipped), %lu false headers, %lu unconfirmed, %lu short\n",
+			st->frames, st->misaligned, st->skipped, st->rejected, st->fallbacks, st->shorts);
+}
+
+/* is there a header here? */
+static int frame_magic (const unsigned char *d)
+{
+	return (d[0] == 0x01) && ((d[1] == 0xfe) || (d[1] == 0x01));
+}
+
+/* does a frame start here? 1 if so, 0 if not, -1 if only its check fails:
+ * the sequence numbers of an image line disagree, or no header follows an
+ * info line */
+static int frame_header (const unsigned char *d, int length)
+{
+	if (!frame_magic(d))
+		return 0;
+	if (d[1] == 0x01) {
+		if (length < FRAME_SIZE + 2)
+			return 1;
+		return frame_magic(d + FRAME_SIZE) ? 1 : -1;
+	}
+	if (length < 276)
+		return 1;
+	if ((d[2] == d[275]) && (d[3] == d[274]))
+		return 1;
+	return -1;
+}
+
+/* take the header at data + i if it checks out, else count it in *rejects
+ * and remember the first one that doesn't in *first */
+static int frame_try (const unsigned char *data, int length, int i, int *first, int *rejects)
+{
+	int r = frame_header(data + i, length - i);
+	if (r < 0) {
+		if (*first < 0)
+			*first = i;
+		(*rejects)++;
+	}
+	return r > 0;
+}
+
+/* Offset of the frame header in data, or length if there is none. *rejects
+ * is set to the number of false headers before it; *fallback is set when it
+ * is the first of them, taken for want of one that checks out. Nothing is
+ * counted in the stats here, as the caller may look at the same bytes again
+ * once more data has come in. */
+static int frame_sync (const unsigned char *data, int length, int *rejects, int *fallback)
+{
+	const unsigned char *p;
+	unsigned int m;
+	int i = 0, first = -1;
+
+	*rejects = 0;
+	*fallback = 0;
+
+#if defined(__AVX2__)
+	const __m256i one32 = _mm256_set1_epi8(0x01), fe32 = _mm256_set1_epi8(0xfe);
+	for (; i + 33 <= length; i += 32) {
+		__m256i a = _mm256_loadu_si256((const __m256i *)(data + i));
+		__m256i b = _mm256_loadu_si256((const __m256i *)(data + i + 1));
+		m = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, one32),
+			_mm256_or_si256(_mm256_cmpeq_epi8(b, fe32), _mm256_cmpeq_epi8(b, one32))));
+		for (; m; m &= m - 1)
+			if (frame_try(data, length, i + __builtin_ctz(m), &first, rejects))
+				return i + __builtin_ctz(m);
+	}
+#endif
+#if defined(__SSE2__)
+	const __m128i one16 = _mm_set1_epi8(0x01), fe16 = _mm_set1_epi8(0xfe);
+	for (; i + 17 <= length; i += 16) {
+		__m128i a = _mm_loadu_si128((const __m128i *)(data + i));
+		__m128i b = _mm_loadu_si128((const __m128i *)(data + i + 1));
+		m = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, one16),
+			_mm_or_si128(_mm_cmpeq_epi8(b, fe16), _mm_cmpeq_epi8(b, one16))));
+		for (; m; m &= m - 1)
+			if (frame_try(data, length, i + __builtin_ctz(m), &first, rejects))
+				return i + __builtin_ctz(m);
+	}
+#endif
+	for (; i + 1 < length; i = p - data + 1) {
+		p = memchr(data + i, 0x01, length - 1 - i);
+		if (p == NULL)
+			break;
+		if (frame_try(data, length, p - data, &first, rejects))
+			return p - data;
+	}
+	if (first < 0)
+		return length;
+	*rejects = 0;
+	*fallback = 1;
+	return first;
+}
+
+/* A scan being dumped as it streams in. Only the bytes not printed yet are
+ * kept, never more than DUMP_WINDOW of them, so memory stays bounded however
+ * long the swipe is. */
+#define DUMP_WINDOW (2 * 292)
+
+struct frame_dump {
+	FILE *f;
+	struct frame_stats st;
+	unsigned char buf[DUMP_WINDOW];
+	int len;
+
+	/* bytes skipped since the last frame, frames printed, and bytes seen */
+	int skip;
+	int n;
+	unsigned long total;
+};
+
+/* drop the first n bytes of the window */
+static void dump_consume (struct frame_dump *d, int n)
+{
+	memmove(d->buf, d->buf + n, d->len - n);
+	d->len -= n;
+}
+
+/* Print the frames in the window. Until the scan is over, a header is only
+ * taken with a whole frame and the next header behind it in the window;
+ * one closer to the end waits for more data. */
+static void dump_run (struct frame_dump *d, int last)
+{
+	int i, rejects, fallback;
+
+	while ((d->len > 0) && (last || (d->len == DUMP_WINDOW))) {
+		i = frame_sync(d->buf, d->len, &rejects, &fallback);
+		d->st.rejected += rejects;
+		if (!last && (i + FRAME_SIZE + 2 > d->len)) {
+			/* keep the last byte, it may start a header */
+			if (i == d->len)
+				i--;
+			d->skip += i;
+			dump_consume(d, i);
+			continue;
+		}
+		d->st.fallbacks += fallback;
+		d->skip += i;
+		dump_consume(d, i);
+
+		// warn if we skipped any data
+		if (d->skip > 0) {
+			fprintf(d->f, "*** Frame misalignment, skipped %d bytes!!\n", d->skip);
+			d->st.skipped += d->skip;
+			if (d->len > 0)
+				d->st.misaligned++;
+			d->skip = 0;
+		}
+		if (d->len == 0)
+			break;
+		d->st.frames++;
+
+		// dump short frames as raw data
+		if (d->len < FRAME_SIZE) {
+			fprintf(d->f, "*** Short frame, dumping as %d raw bytes!!\n", d->len);
+			dump_buffer(d->f, d->buf, d->len, "");
+			d->st.shorts++;
+			dump_consume(d, d->len);
+			break;
+		}
+
+		dump_frame_1(d->f, d->buf, d->n++);
+		dump_consume(d, FRAME_SIZE);
+	}
+}
+
+/* Print a scan to f as it arrives, each frame in turn, resyncing on the
+ * frame headers wherever bytes have gone missing, even across lines, and a
+ * summary once it is over */
+static void dump_scan_begin (FILE *f, struct frame_dump *d)
+{
+	d->f = f;
+	d->len = 0;
+	d->skip = 0;
+	d->n = 0;
+	d->total = 0;
+	frame_stats_reset(&d->st);
+	fprintf(f, "  {\n");
+}
+
+static void dump_scan_data (struct frame_dump *d, const unsigned char *data, int length)
+{
+	int k;
+
+	d->total += length;
+	while (length > 0) {
+		k = DUMP_WINDOW - d->len;
+		if (k > length)
+			k = length;
+		memcpy(d->buf + d->len, data, k);
+		d->len += k;
+		data += k;
+		length -= k;
+		dump_run(d, 0);
+	}
+}
+
+static void dump_scan_end (struct frame_dump *d)
+{
+	dump_run(d, 1);
+	fprintf(d->f, "  }\n");
+	fprintf(d->f, "  %lu frames in %lu bytes%s\n", d->total/FRAME_SIZE, d->total, (d->total%FRAME_SIZE) ? " (incomplete frames(s)?)" : "");
+	frame_stats_print(d->f, &d->st);
+}
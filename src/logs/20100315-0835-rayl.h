@@ -1,10574 +0,0 @@
-int PREFIX_unchecked (struct vfs_dev *dev)
-{
-	_(  Peek (dev, 0x00001fe8, 0x04));
-	_(  Peek (dev, 0x00001fec, 0x04));
-	_(  Peek (dev, 0x00001ff0, 0x04));
-	_(  Peek (dev, 0x00001ff4, 0x04));
-	_(  Peek (dev, 0x00001ff8, 0x04));
-	_(  Peek (dev, 0x00001ffc, 0x04));
-	_(  GetParam (dev, 0x002e));
-	_(  GetVersion (dev));
-	_(  GetParam (dev, 0x0028));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0011));
-	_(  GetParam (dev, 0x0054));
-	_(  GetParam (dev, 0x0001));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetPrint (dev, 0x0001, type_0));
-	_(  LoadImage (dev));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0004, 0x0000));
-	_(  SetParam (dev, 0x0005, 0x0000));
-	_(  SetParam (dev, 0x0006, 0x0000));
-	_(  SetParam (dev, 0x0007, 0x0000));
-	_(  SetParam (dev, 0x000a, 0x0002));
-	_(  SetParam (dev, 0x000b, 0x010b));
-	_(  SetParam (dev, 0x000c, 0x010c));
-	_(  SetParam (dev, 0x000d, 0x010d));
-	_(  SetParam (dev, 0x000e, 0x0001));
-	_(  SetParam (dev, 0x0010, 0x0000));
-	_(  SetParam (dev, 0x0012, 0x0040));
-	_(  SetParam (dev, 0x0015, 0x04b0));
-	_(  SetParam (dev, 0x0016, 0x001b));
-	_(  SetParam (dev, 0x0017, 0x0001));
-	_(  SetParam (dev, 0x0018, 0x0003));
-	_(  SetParam (dev, 0x0019, 0x0001));
-	_(  SetParam (dev, 0x001a, 0x0000));
-	_(  SetParam (dev, 0x001b, 0x0004));
-	_(  SetParam (dev, 0x001d, 0x010c));
-	_(  SetParam (dev, 0x001e, 0x010d));
-	_(  SetParam (dev, 0x001f, 0x0000));
-	_(  SetParam (dev, 0x0020, 0x0000));
-	_(  SetParam (dev, 0x0021, 0x0001));
-	_(  SetParam (dev, 0x0022, 0x0001));
-	_(  SetParam (dev, 0x0023, 0x0001));
-	_(  SetParam (dev, 0x0024, 0x0000));
-	_(  SetParam (dev, 0x002c, 0x0046));
-	_(  SetParam (dev, 0x002d, 0x002a));
-	_(  SetParam (dev, 0x002f, 0x010e));
-	_(  SetParam (dev, 0x0030, 0x010f));
-	_(  SetParam (dev, 0x0032, 0x0004));
-	_(  SetParam (dev, 0x0033, 0x0003));
-	_(  SetParam (dev, 0x0034, 0x0005));
-	_(  SetParam (dev, 0x0035, 0x0010));
-	_(  SetParam (dev, 0x0036, 0x000a));
-	_(  SetParam (dev, 0x0037, 0x0018));
-	_(  SetParam (dev, 0x0038, 0x001e));
-	_(  SetParam (dev, 0x0039, 0x00b2));
-	_(  SetParam (dev, 0x003a, 0x0080));
-	_(  SetParam (dev, 0x003b, 0x0000));
-	_(  SetParam (dev, 0x003e, 0x01f4));
-	_(  SetParam (dev, 0x003f, 0x001a));
-	_(  SetParam (dev, 0x0040, 0x00f8));
-	_(  SetParam (dev, 0x0042, 0x0001));
-	_(  SetParam (dev, 0x0043, 0x0004));
-	_(  SetParam (dev, 0x0044, 0x0010));
-	_(  SetParam (dev, 0x0045, 0x0005));
-	_(  SetParam (dev, 0x0046, 0x00f5));
-	_(  SetParam (dev, 0x0047, 0x000c));
-	_(  SetParam (dev, 0x0048, 0x0000));
-	_(  SetParam (dev, 0x0049, 0x0000));
-	_(  SetParam (dev, 0x0053, 0x0000));
-	_(  SetParam (dev, 0x0056, 0x00b4));
-	_(  SetParam (dev, 0x0057, 0x0096));
-	_(  SetParam (dev, 0x0058, 0x008c));
-	_(  SetParam (dev, 0x0059, 0x0064));
-	_(  SetParam (dev, 0x005b, 0x0001));
-	_(  SetParam (dev, 0x005c, 0x0001));
-	_(  SetParam (dev, 0x005d, 0x0020));
-	_(  SetParam (dev, 0x005e, 0x0064));
-	_(  SetParam (dev, 0x005f, 0x00c8));
-	_(  SetParam (dev, 0x0060, 0x00c8));
-	_(  SetParam (dev, 0x0062, 0x0000));
-	_(  SetParam (dev, 0x0064, 0x011a));
-	_(  SetParam (dev, 0x0069, 0x0014));
-	_(  GetParam (dev, 0x002a));
-	_(  GetParam (dev, 0x003c));
-	_(  GetParam (dev, 0x004a));
-	_(  GetParam (dev, 0x0041));
-	_(  GetVersion (dev));
-	_(  SetParam (dev, 0x0063, 0x0001));
-	_(  SensorSpiTrans (dev, 0x05, 0x00, 0xab, 0x00, 0x00, 0x00, 0x00));
-	_(  SetParam (dev, 0x0064, 0x0118));
-	_(  GetConfig (dev));
-	_(  SetParam (dev, 0x0046, 0x00f5));
-	_(  SetParam (dev, 0x006d, 0x0032));
-	_(  SetParam (dev, 0x006e, 0x0003));
-	_(  GetParam (dev, 0x0052));
-	_(  SetParam (dev, 0x0052, 0x0320));
-	_(  GetPrint (dev, 0x0001, type_2));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0052, 0x1eb4));
-	_(  Peek (dev, 0x00ff502c, 0x02));
-	_(  Peek (dev, 0x00ff502e, 0x02));
-	_(  Poke (dev, 0x000005f6, 0x00000001, 0x01));
-	_(  Peek (dev, 0x00ff503e, 0x01));
-	_(  Poke (dev, 0x00ff503e, 0x00000000, 0x01));
-	_(  Peek (dev, 0x00ff9802, 0x01));
-	_(  Peek (dev, 0x00ff9800, 0x01));
-	_(  Peek (dev, 0x00ff9806, 0x01));
-	_(  Poke (dev, 0x00ff9806, 0x00000000, 0x01));
-	_(  GetPrint (dev, 0x0064, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x000005f6, 0x00000000, 0x01));
-	_(  Peek (dev, 0x00ff503e, 0x01));
-	_(  Poke (dev, 0x00ff503e, 0x00000010, 0x01));
-	_(  Peek (dev, 0x00ff9802, 0x01));
-	_(  Peek (dev, 0x00ff9800, 0x01));
-	_(  Peek (dev, 0x00ff9806, 0x01));
-	_(  GetPrint (dev, 0x0064, type_0));
-	_(  LoadImage (dev));
-	_(  Peek (dev, 0x00ff5038, 0x01));
-	_(  Peek (dev, 0x00ff500e, 0x02));
-	_(  Peek (dev, 0x00ff5032, 0x01));
-	_(  Poke (dev, 0x00ff5032, 0x00000012, 0x01));
-	_(  Poke (dev, 0x00ff500e, 0x00004000, 0x02));
-	_(  Poke (dev, 0x00ff5038, 0x0000000f, 0x01));
-	_(  SetParam (dev, 0x0062, 0x0000));
-	_(  SetParam (dev, 0x0077, 0x0000));
-	_(  SetParam (dev, 0x0076, 0x0000));
-	_(  SetParam (dev, 0x0078, 0x0000));
-	_(  GetPrint (dev, 0x0002, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x000005f6, 0x00000001, 0x01));
-	_(  Peek (dev, 0x00ff503e, 0x01));
-	_(  Poke (dev, 0x00ff503e, 0x00000000, 0x01));
-	_(  Peek (dev, 0x00ff9802, 0x01));
-	_(  Peek (dev, 0x00ff9800, 0x01));
-	_(  Peek (dev, 0x00ff9806, 0x01));
-	_(  Poke (dev, 0x00ff5038, 0x0000000e, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x00ff5038, 0x0000000d, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x00ff5038, 0x0000000c, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x00ff5038, 0x0000000b, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x00ff5038, 0x0000000a, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x00ff5038, 0x00000009, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x000005f6, 0x00000000, 0x01));
-	_(  Peek (dev, 0x00ff503e, 0x01));
-	_(  Poke (dev, 0x00ff503e, 0x00000010, 0x01));
-	_(  Peek (dev, 0x00ff9802, 0x01));
-	_(  Peek (dev, 0x00ff9800, 0x01));
-	_(  Peek (dev, 0x00ff9806, 0x01));
-	_(  Poke (dev, 0x00ff9806, 0x00000000, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0077, 0x0009));
-	_(  SetParam (dev, 0x0076, 0x0012));
-	_(  SetParam (dev, 0x0078, 0x2230));
-	_(  Poke (dev, 0x00ff5038, 0x00000014, 0x01));
-	_(  Poke (dev, 0x00ff500e, 0x000021bc, 0x02));
-	_(  Poke (dev, 0x00ff5032, 0x00000031, 0x01));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetVersion (dev));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x1388, type_1));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetConfig (dev));
-	_(  GetParam (dev, 0x002e));
-	_(  GetVersion (dev));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x1388, type_1));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetConfig (dev));
-	_(  GetParam (dev, 0x002e));
-	_(  GetVersion (dev));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x1388, type_1));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  GetVersion (dev));
-	_(  GetVersion (dev));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x1388, type_1));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetConfig (dev));
-	_(  GetParam (dev, 0x002e));
-	_(  GetVersion (dev));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x1388, type_1));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetConfig (dev));
-	_(  GetParam (dev, 0x002e));
-	_(  GetVersion (dev));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x1388, type_1));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetConfig (dev));
-	_(  GetParam (dev, 0x002e));
-	_(  GetVersion (dev));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x1388, type_1));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetConfig (dev));
-	_(  GetParam (dev, 0x002e));
-	_(  GetVersion (dev));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x1388, type_1));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  Peek (dev, 0x00001fe8, 0x04));
-	_(  Peek (dev, 0x00001fec, 0x04));
-	_(  Peek (dev, 0x00001ff0, 0x04));
-	_(  Peek (dev, 0x00001ff4, 0x04));
-	_(  Peek (dev, 0x00001ff8, 0x04));
-	_(  Peek (dev, 0x00001ffc, 0x04));
-	_(  GetParam (dev, 0x002e));
-	_(  GetVersion (dev));
-	_(  GetParam (dev, 0x0028));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0011));
-	_(  GetParam (dev, 0x0054));
-	_(  GetParam (dev, 0x0001));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetPrint (dev, 0x0001, type_0));
-	_(  LoadImage (dev));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0004, 0x0000));
-	_(  SetParam (dev, 0x0005, 0x0000));
-	_(  SetParam (dev, 0x0006, 0x0000));
-	_(  SetParam (dev, 0x0007, 0x0000));
-	_(  SetParam (dev, 0x000a, 0x0002));
-	_(  SetParam (dev, 0x000b, 0x010b));
-	_(  SetParam (dev, 0x000c, 0x010c));
-	_(  SetParam (dev, 0x000d, 0x010d));
-	_(  SetParam (dev, 0x000e, 0x0001));
-	_(  SetParam (dev, 0x0010, 0x0000));
-	_(  SetParam (dev, 0x0012, 0x0040));
-	_(  SetParam (dev, 0x0015, 0x04b0));
-	_(  SetParam (dev, 0x0016, 0x001b));
-	_(  SetParam (dev, 0x0017, 0x0001));
-	_(  SetParam (dev, 0x0018, 0x0003));
-	_(  SetParam (dev, 0x0019, 0x0001));
-	_(  SetParam (dev, 0x001a, 0x0000));
-	_(  SetParam (dev, 0x001b, 0x0004));
-	_(  SetParam (dev, 0x001d, 0x010c));
-	_(  SetParam (dev, 0x001e, 0x010d));
-	_(  SetParam (dev, 0x001f, 0x0000));
-	_(  SetParam (dev, 0x0020, 0x0000));
-	_(  SetParam (dev, 0x0021, 0x0001));
-	_(  SetParam (dev, 0x0022, 0x0001));
-	_(  SetParam (dev, 0x0023, 0x0001));
-	_(  SetParam (dev, 0x0024, 0x0000));
-	_(  SetParam (dev, 0x002c, 0x0046));
-	_(  SetParam (dev, 0x002d, 0x002a));
-	_(  SetParam (dev, 0x002f, 0x010e));
-	_(  SetParam (dev, 0x0030, 0x010f));
-	_(  SetParam (dev, 0x0032, 0x0004));
-	_(  SetParam (dev, 0x0033, 0x0003));
-	_(  SetParam (dev, 0x0034, 0x0005));
-	_(  SetParam (dev, 0x0035, 0x0010));
-	_(  SetParam (dev, 0x0036, 0x000a));
-	_(  SetParam (dev, 0x0037, 0x0018));
-	_(  SetParam (dev, 0x0038, 0x001e));
-	_(  SetParam (dev, 0x0039, 0x00b2));
-	_(  SetParam (dev, 0x003a, 0x0080));
-	_(  SetParam (dev, 0x003b, 0x0000));
-	_(  SetParam (dev, 0x003e, 0x01f4));
-	_(  SetParam (dev, 0x003f, 0x001a));
-	_(  SetParam (dev, 0x0040, 0x00f8));
-	_(  SetParam (dev, 0x0042, 0x0001));
-	_(  SetParam (dev, 0x0043, 0x0004));
-	_(  SetParam (dev, 0x0044, 0x0010));
-	_(  SetParam (dev, 0x0045, 0x0005));
-	_(  SetParam (dev, 0x0046, 0x00f5));
-	_(  SetParam (dev, 0x0047, 0x000c));
-	_(  SetParam (dev, 0x0048, 0x0000));
-	_(  SetParam (dev, 0x0049, 0x0000));
-	_(  SetParam (dev, 0x0053, 0x0000));
-	_(  SetParam (dev, 0x0056, 0x00b4));
-	_(  SetParam (dev, 0x0057, 0x0096));
-	_(  SetParam (dev, 0x0058, 0x008c));
-	_(  SetParam (dev, 0x0059, 0x0064));
-	_(  SetParam (dev, 0x005b, 0x0001));
-	_(  SetParam (dev, 0x005c, 0x0001));
-	_(  SetParam (dev, 0x005d, 0x0020));
-	_(  SetParam (dev, 0x005e, 0x0064));
-	_(  SetParam (dev, 0x005f, 0x00c8));
-	_(  SetParam (dev, 0x0060, 0x00c8));
-	_(  SetParam (dev, 0x0062, 0x0000));
-	_(  SetParam (dev, 0x0064, 0x011a));
-	_(  SetParam (dev, 0x0069, 0x0014));
-	_(  GetParam (dev, 0x002a));
-	_(  GetParam (dev, 0x003c));
-	_(  GetParam (dev, 0x004a));
-	_(  GetParam (dev, 0x0041));
-	_(  GetVersion (dev));
-	_(  SetParam (dev, 0x0063, 0x0001));
-	_(  SensorSpiTrans (dev, 0x05, 0x00, 0xab, 0x00, 0x00, 0x00, 0x00));
-	_(  SetParam (dev, 0x0064, 0x0118));
-	_(  GetConfig (dev));
-	_(  SetParam (dev, 0x0046, 0x00f5));
-	_(  SetParam (dev, 0x006d, 0x0032));
-	_(  SetParam (dev, 0x006e, 0x0003));
-	_(  GetParam (dev, 0x0052));
-	_(  SetParam (dev, 0x0052, 0x0320));
-	_(  GetPrint (dev, 0x0001, type_2));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0052, 0x1eb4));
-	_(  Peek (dev, 0x00ff502c, 0x02));
-	_(  Peek (dev, 0x00ff502e, 0x02));
-	_(  Poke (dev, 0x000005f6, 0x00000001, 0x01));
-	_(  Peek (dev, 0x00ff503e, 0x01));
-	_(  Poke (dev, 0x00ff503e, 0x00000000, 0x01));
-	_(  Peek (dev, 0x00ff9802, 0x01));
-	_(  Peek (dev, 0x00ff9800, 0x01));
-	_(  Peek (dev, 0x00ff9806, 0x01));
-	_(  Poke (dev, 0x00ff9806, 0x00000000, 0x01));
-	_(  GetPrint (dev, 0x0064, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x000005f6, 0x00000000, 0x01));
-	_(  Peek (dev, 0x00ff503e, 0x01));
-	_(  Poke (dev, 0x00ff503e, 0x00000010, 0x01));
-	_(  Peek (dev, 0x00ff9802, 0x01));
-	_(  Peek (dev, 0x00ff9800, 0x01));
-	_(  Peek (dev, 0x00ff9806, 0x01));
-	_(  GetPrint (dev, 0x0064, type_0));
-	_(  LoadImage (dev));
-	_(  Peek (dev, 0x00ff5038, 0x01));
-	_(  Peek (dev, 0x00ff500e, 0x02));
-	_(  Peek (dev, 0x00ff5032, 0x01));
-	_(  Poke (dev, 0x00ff5032, 0x00000012, 0x01));
-	_(  Poke (dev, 0x00ff500e, 0x00004000, 0x02));
-	_(  Poke (dev, 0x00ff5038, 0x0000000f, 0x01));
-	_(  SetParam (dev, 0x0062, 0x0000));
-	_(  SetParam (dev, 0x0077, 0x0000));
-	_(  SetParam (dev, 0x0076, 0x0000));
-	_(  SetParam (dev, 0x0078, 0x0000));
-	_(  GetPrint (dev, 0x0002, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x000005f6, 0x00000001, 0x01));
-	_(  Peek (dev, 0x00ff503e, 0x01));
-	_(  Poke (dev, 0x00ff503e, 0x00000000, 0x01));
-	_(  Peek (dev, 0x00ff9802, 0x01));
-	_(  Peek (dev, 0x00ff9800, 0x01));
-	_(  Peek (dev, 0x00ff9806, 0x01));
-	_(  Poke (dev, 0x00ff5038, 0x0000000e, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x00ff5038, 0x0000000d, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x00ff5038, 0x0000000c, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x00ff5038, 0x0000000b, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x00ff5038, 0x0000000a, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x00ff5038, 0x00000009, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x00ff5038, 0x00000008, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x000005f6, 0x00000000, 0x01));
-	_(  Peek (dev, 0x00ff503e, 0x01));
-	_(  Poke (dev, 0x00ff503e, 0x00000010, 0x01));
-	_(  Peek (dev, 0x00ff9802, 0x01));
-	_(  Peek (dev, 0x00ff9800, 0x01));
-	_(  Peek (dev, 0x00ff9806, 0x01));
-	_(  Poke (dev, 0x00ff9806, 0x00000000, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0077, 0x0008));
-	_(  SetParam (dev, 0x0076, 0x0012));
-	_(  SetParam (dev, 0x0078, 0x21f0));
-	_(  Poke (dev, 0x00ff5038, 0x00000014, 0x01));
-	_(  Poke (dev, 0x00ff500e, 0x000021bc, 0x02));
-	_(  Poke (dev, 0x00ff5032, 0x00000031, 0x01));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetVersion (dev));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x1388, type_1));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetConfig (dev));
-	_(  GetParam (dev, 0x002e));
-	_(  GetVersion (dev));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x1388, type_1));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetConfig (dev));
-	_(  GetParam (dev, 0x002e));
-	_(  GetVersion (dev));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x1388, type_1));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	return 0;
-}
-int PREFIX_checked (struct vfs_dev *dev)
-{
-	__(    6,    Peek (dev, 0x00001fe8, 0x04));
-	__(    8,    Peek (dev, 0x00001fec, 0x04));
-	__(   10,    Peek (dev, 0x00001ff0, 0x04));
-	__(   12,    Peek (dev, 0x00001ff4, 0x04));
-	__(   14,    Peek (dev, 0x00001ff8, 0x04));
-	__(   16,    Peek (dev, 0x00001ffc, 0x04));
-	__(   18,    GetParam (dev, 0x002e));
-	__(   20,    GetVersion (dev));
-	__(   22,    GetParam (dev, 0x0028));
-	__(   24,    GetParam (dev, 0x0014));
-	__(   26,    GetParam (dev, 0x0011));
-	__(   28,    GetParam (dev, 0x0054));
-	__(   30,    GetParam (dev, 0x0001));
-	__(   32,    GetParam (dev, 0x0014));
-	__(   34,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__(   37,    GetPrint (dev, 0x0001, type_0));
-	 _(          LoadImage (dev));
-	__(   40,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__(   43,    SetParam (dev, 0x0004, 0x0000));
-	__(   45,    SetParam (dev, 0x0005, 0x0000));
-	__(   47,    SetParam (dev, 0x0006, 0x0000));
-	__(   49,    SetParam (dev, 0x0007, 0x0000));
-	__(   51,    SetParam (dev, 0x000a, 0x0002));
-	__(   53,    SetParam (dev, 0x000b, 0x010b));
-	__(   55,    SetParam (dev, 0x000c, 0x010c));
-	__(   57,    SetParam (dev, 0x000d, 0x010d));
-	__(   59,    SetParam (dev, 0x000e, 0x0001));
-	__(   61,    SetParam (dev, 0x0010, 0x0000));
-	__(   63,    SetParam (dev, 0x0012, 0x0040));
-	__(   65,    SetParam (dev, 0x0015, 0x04b0));
-	__(   67,    SetParam (dev, 0x0016, 0x001b));
-	__(   69,    SetParam (dev, 0x0017, 0x0001));
-	__(   71,    SetParam (dev, 0x0018, 0x0003));
-	__(   73,    SetParam (dev, 0x0019, 0x0001));
-	__(   75,    SetParam (dev, 0x001a, 0x0000));
-	__(   77,    SetParam (dev, 0x001b, 0x0004));
-	__(   79,    SetParam (dev, 0x001d, 0x010c));
-	__(   81,    SetParam (dev, 0x001e, 0x010d));
-	__(   83,    SetParam (dev, 0x001f, 0x0000));
-	__(   85,    SetParam (dev, 0x0020, 0x0000));
-	__(   87,    SetParam (dev, 0x0021, 0x0001));
-	__(   89,    SetParam (dev, 0x0022, 0x0001));
-	__(   91,    SetParam (dev, 0x0023, 0x0001));
-	__(   93,    SetParam (dev, 0x0024, 0x0000));
-	__(   95,    SetParam (dev, 0x002c, 0x0046));
-	__(   97,    SetParam (dev, 0x002d, 0x002a));
-	__(   99,    SetParam (dev, 0x002f, 0x010e));
-	__(  101,    SetParam (dev, 0x0030, 0x010f));
-	__(  103,    SetParam (dev, 0x0032, 0x0004));
-	__(  105,    SetParam (dev, 0x0033, 0x0003));
-	__(  107,    SetParam (dev, 0x0034, 0x0005));
-	__(  109,    SetParam (dev, 0x0035, 0x0010));
-	__(  111,    SetParam (dev, 0x0036, 0x000a));
-	__(  113,    SetParam (dev, 0x0037, 0x0018));
-	__(  115,    SetParam (dev, 0x0038, 0x001e));
-	__(  117,    SetParam (dev, 0x0039, 0x00b2));
-	__(  119,    SetParam (dev, 0x003a, 0x0080));
-	__(  121,    SetParam (dev, 0x003b, 0x0000));
-	__(  123,    SetParam (dev, 0x003e, 0x01f4));
-	__(  125,    SetParam (dev, 0x003f, 0x001a));
-	__(  127,    SetParam (dev, 0x0040, 0x00f8));
-	__(  129,    SetParam (dev, 0x0042, 0x0001));
-	__(  131,    SetParam (dev, 0x0043, 0x0004));
-	__(  133,    SetParam (dev, 0x0044, 0x0010));
-	__(  135,    SetParam (dev, 0x0045, 0x0005));
-	__(  137,    SetParam (dev, 0x0046, 0x00f5));
-	__(  139,    SetParam (dev, 0x0047, 0x000c));
-	__(  141,    SetParam (dev, 0x0048, 0x0000));
-	__(  143,    SetParam (dev, 0x0049, 0x0000));
-	__(  145,    SetParam (dev, 0x0053, 0x0000));
-	__(  147,    SetParam (dev, 0x0056, 0x00b4));
-	__(  149,    SetParam (dev, 0x0057, 0x0096));
-	__(  151,    SetParam (dev, 0x0058, 0x008c));
-	__(  153,    SetParam (dev, 0x0059, 0x0064));
-	__(  155,    SetParam (dev, 0x005b, 0x0001));
-	__(  157,    SetParam (dev, 0x005c, 0x0001));
-	__(  159,    SetParam (dev, 0x005d, 0x0020));
-	__(  161,    SetParam (dev, 0x005e, 0x0064));
-	__(  163,    SetParam (dev, 0x005f, 0x00c8));
-	__(  165,    SetParam (dev, 0x0060, 0x00c8));
-	__(  167,    SetParam (dev, 0x0062, 0x0000));
-	__(  169,    SetParam (dev, 0x0064, 0x011a));
-	__(  171,    SetParam (dev, 0x0069, 0x0014));
-	__(  173,    GetParam (dev, 0x002a));
-	__(  175,    GetParam (dev, 0x003c));
-	__(  177,    GetParam (dev, 0x004a));
-	__(  179,    GetParam (dev, 0x0041));
-	__(  181,    GetVersion (dev));
-	__(  183,    SetParam (dev, 0x0063, 0x0001));
-	__(  185,    SensorSpiTrans (dev, 0x05, 0x00, 0xab, 0x00, 0x00, 0x00, 0x00));
-	__(  187,    SetParam (dev, 0x0064, 0x0118));
-	__(  189,    GetConfig (dev));
-	__(  191,    SetParam (dev, 0x0046, 0x00f5));
-	__(  193,    SetParam (dev, 0x006d, 0x0032));
-	__(  195,    SetParam (dev, 0x006e, 0x0003));
-	__(  197,    GetParam (dev, 0x0052));
-	__(  199,    SetParam (dev, 0x0052, 0x0320));
-	__(  201,    GetPrint (dev, 0x0001, type_2));
-	 _(          LoadImage (dev));
-	__(  204,    SetParam (dev, 0x0052, 0x1eb4));
-	__(  206,    Peek (dev, 0x00ff502c, 0x02));
-	__(  208,    Peek (dev, 0x00ff502e, 0x02));
-	__(  210,    Poke (dev, 0x000005f6, 0x00000001, 0x01));
-	__(  212,    Peek (dev, 0x00ff503e, 0x01));
-	__(  214,    Poke (dev, 0x00ff503e, 0x00000000, 0x01));
-	__(  216,    Peek (dev, 0x00ff9802, 0x01));
-	__(  218,    Peek (dev, 0x00ff9800, 0x01));
-	__(  220,    Peek (dev, 0x00ff9806, 0x01));
-	__(  222,    Poke (dev, 0x00ff9806, 0x00000000, 0x01));
-	__(  224,    GetPrint (dev, 0x0064, type_0));
-	 _(          LoadImage (dev));
-	__(  227,    Poke (dev, 0x000005f6, 0x00000000, 0x01));
-	__(  229,    Peek (dev, 0x00ff503e, 0x01));
-	__(  231,    Poke (dev, 0x00ff503e, 0x00000010, 0x01));
-	__(  233,    Peek (dev, 0x00ff9802, 0x01));
-	__(  235,    Peek (dev, 0x00ff9800, 0x01));
-	__(  237,    Peek (dev, 0x00ff9806, 0x01));
-	__(  239,    GetPrint (dev, 0x0064, type_0));
-	 _(          LoadImage (dev));
-	__(  242,    Peek (dev, 0x00ff5038, 0x01));
-	__(  244,    Peek (dev, 0x00ff500e, 0x02));
-	__(  246,    Peek (dev, 0x00ff5032, 0x01));
-	__(  248,    Poke (dev, 0x00ff5032, 0x00000012, 0x01));
-	__(  250,    Poke (dev, 0x00ff500e, 0x00004000, 0x02));
-	__(  252,    Poke (dev, 0x00ff5038, 0x0000000f, 0x01));
-	__(  254,    SetParam (dev, 0x0062, 0x0000));
-	__(  256,    SetParam (dev, 0x0077, 0x0000));
-	__(  258,    SetParam (dev, 0x0076, 0x0000));
-	__(  260,    SetParam (dev, 0x0078, 0x0000));
-	__(  262,    GetPrint (dev, 0x0002, type_0));
-	 _(          LoadImage (dev));
-	__(  265,    Poke (dev, 0x000005f6, 0x00000001, 0x01));
-	__(  267,    Peek (dev, 0x00ff503e, 0x01));
-	__(  269,    Poke (dev, 0x00ff503e, 0x00000000, 0x01));
-	__(  271,    Peek (dev, 0x00ff9802, 0x01));
-	__(  273,    Peek (dev, 0x00ff9800, 0x01));
-	__(  275,    Peek (dev, 0x00ff9806, 0x01));
-	__(  277,    Poke (dev, 0x00ff5038, 0x0000000e, 0x01));
-	__(  279,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__(  282,    Poke (dev, 0x00ff5038, 0x0000000d, 0x01));
-	__(  284,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__(  287,    Poke (dev, 0x00ff5038, 0x0000000c, 0x01));
-	__(  289,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__(  292,    Poke (dev, 0x00ff5038, 0x0000000b, 0x01));
-	__(  294,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__(  297,    Poke (dev, 0x00ff5038, 0x0000000a, 0x01));
-	__(  299,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__(  302,    Poke (dev, 0x00ff5038, 0x00000009, 0x01));
-	__(  304,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__(  307,    Poke (dev, 0x000005f6, 0x00000000, 0x01));
-	__(  309,    Peek (dev, 0x00ff503e, 0x01));
-	__(  311,    Poke (dev, 0x00ff503e, 0x00000010, 0x01));
-	__(  313,    Peek (dev, 0x00ff9802, 0x01));
-	__(  315,    Peek (dev, 0x00ff9800, 0x01));
-	__(  317,    Peek (dev, 0x00ff9806, 0x01));
-	__(  319,    Poke (dev, 0x00ff9806, 0x00000000, 0x01));
-	__(  321,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__(  324,    SetParam (dev, 0x0077, 0x0009));
-	__(  326,    SetParam (dev, 0x0076, 0x0012));
-	__(  328,    SetParam (dev, 0x0078, 0x2230));
-	__(  330,    Poke (dev, 0x00ff5038, 0x00000014, 0x01));
-	__(  332,    Poke (dev, 0x00ff500e, 0x000021bc, 0x02));
-	__(  334,    Poke (dev, 0x00ff5032, 0x00000031, 0x01));
-	__(  336,    SetParam (dev, 0x0062, 0x0032));
-	__(  338,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__(  341,    SetParam (dev, 0x0062, 0x0032));
-	__(  343,    GetVersion (dev));
-	__(  345,    SetParam (dev, 0x0055, 0x0008));
-	__(  347,    GetParam (dev, 0x0014));
-	__(  349,    GetParam (dev, 0x0011));
-	__(  351,    SetParam (dev, 0x0062, 0x0032));
-	__(  353,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__(  356,    GetParam (dev, 0x0014));
-	__(  358,    GetParam (dev, 0x0014));
-	__(  360,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__(  363,    GetParam (dev, 0x0011));
-	__(  365,    SetParam (dev, 0x0062, 0x0032));
-	__(  367,    GetPrint (dev, 0x1388, type_1));
-	__(  369,    GetFingerState (dev));
-	__(  371,    GetFingerState (dev));
-	__(  373,    GetFingerState (dev));
-	__(  375,    GetFingerState (dev));
-	__(  377,    GetFingerState (dev));
-	__(  379,    GetFingerState (dev));
-	__(  381,    GetFingerState (dev));
-	__(  383,    GetFingerState (dev));
-	__(  385,    GetFingerState (dev));
-	__(  387,    GetFingerState (dev));
-	__(  389,    GetFingerState (dev));
-	__(  391,    GetFingerState (dev));
-	__(  393,    GetFingerState (dev));
-	__(  395,    GetFingerState (dev));
-	__(  397,    GetFingerState (dev));
-	__(  399,    GetFingerState (dev));
-	 _(          LoadImage (dev));
-	__(  402,    GetParam (dev, 0x0014));
-	__(  404,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__(  407,    GetParam (dev, 0x0011));
-	__(  409,    SetParam (dev, 0x0062, 0x0032));
-	__(  411,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__(  414,    GetConfig (dev));
-	__(  416,    GetParam (dev, 0x002e));
-	__(  418,    GetVersion (dev));
-	__(  420,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__(  423,    SetParam (dev, 0x0055, 0x0008));
-	__(  425,    SetParam (dev, 0x0055, 0x0008));
-	__(  427,    SetParam (dev, 0x0055, 0x0008));
-	__(  429,    GetParam (dev, 0x0014));
-	__(  431,    GetParam (dev, 0x0011));
-	__(  433,    SetParam (dev, 0x0062, 0x0032));
-	__(  435,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__(  438,    GetParam (dev, 0x0014));
-	__(  440,    GetParam (dev, 0x0014));
-	__(  442,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__(  445,    GetParam (dev, 0x0011));
-	__(  447,    SetParam (dev, 0x0062, 0x0032));
-	__(  449,    GetPrint (dev, 0x1388, type_1));
-	__(  451,    GetFingerState (dev));
-	__(  453,    GetFingerState (dev));
-	__(  455,    GetFingerState (dev));
-	__(  457,    GetFingerState (dev));
-	__(  459,    GetFingerState (dev));
-	__(  461,    GetFingerState (dev));
-	__(  463,    GetFingerState (dev));
-	__(  465,    GetFingerState (dev));
-	__(  467,    GetFingerState (dev));
-	__(  469,    GetFingerState (dev));
-	__(  471,    GetFingerState (dev));
-	__(  473,    GetFingerState (dev));
-	__(  475,    GetFingerState (dev));
-	__(  477,    GetFingerState (dev));
-	__(  479,    GetFingerState (dev));
-	__(  481,    GetFingerState (dev));
-	__(  483,    GetFingerState (dev));
-	__(  485,    GetFingerState (dev));
-	__(  487,    GetFingerState (dev));
-	__(  489,    GetFingerState (dev));
-	__(  491,    GetFingerState (dev));
-	__(  493,    GetFingerState (dev));
-	__(  495,    GetFingerState (dev));
-	__(  497,    GetFingerState (dev));
-	__(  499,    GetFingerState (dev));
-	__(  501,    GetFingerState (dev));
-	__(  503,    GetFingerState (dev));
-	__(  505,    GetFingerState (dev));
-	__(  507,    GetFingerState (dev));
-	__(  509,    GetFingerState (dev));
-	__(  511,    GetFingerState (dev));
-	__(  513,    GetFingerState (dev));
-	__(  515,    GetFingerState (dev));
-	__(  517,    GetFingerState (dev));
-	__(  519,    GetFingerState (dev));
-	__(  521,    GetFingerState (dev));
-	__(  523,    GetFingerState (dev));
-	__(  525,    GetFingerState (dev));
-	__(  527,    GetFingerState (dev));
-	__(  529,    GetFingerState (dev));
-	__(  531,    GetFingerState (dev));
-	__(  533,    GetFingerState (dev));
-	__(  535,    GetFingerState (dev));
-	__(  537,    GetFingerState (dev));
-	__(  539,    GetFingerState (dev));
-	__(  541,    GetFingerState (dev));
-	__(  543,    GetFingerState (dev));
-	__(  545,    GetFingerState (dev));
-	__(  547,    GetFingerState (dev));
-	__(  549,    GetFingerState (dev));
-	__(  551,    GetFingerState (dev));
-	__(  553,    GetFingerState (dev));
-	__(  555,    GetFingerState (dev));
-	__(  557,    GetFingerState (dev));
-	__(  559,    GetFingerState (dev));
-	__(  561,    GetFingerState (dev));
-	__(  563,    GetFingerState (dev));
-	__(  565,    GetFingerState (dev));
-	__(  567,    GetFingerState (dev));
-	__(  569,    GetFingerState (dev));
-	__(  571,    GetFingerState (dev));
-	__(  573,    GetFingerState (dev));
-	__(  575,    GetFingerState (dev));
-	__(  577,    GetFingerState (dev));
-	__(  579,    GetFingerState (dev));
-	__(  581,    GetFingerState (dev));
-	__(  583,    GetFingerState (dev));
-	__(  585,    GetFingerState (dev));
-	__(  587,    GetFingerState (dev));
-	__(  589,    GetFingerState (dev));
-	__(  591,    GetFingerState (dev));
-	__(  593,    GetFingerState (dev));
-	__(  595,    GetFingerState (dev));
-	__(  597,    GetFingerState (dev));
-	__(  599,    GetFingerState (dev));
-	__(  601,    GetFingerState (dev));
-	__(  603,    GetFingerState (dev));
-	__(  605,    GetFingerState (dev));
-	__(  607,    GetFingerState (dev));
-	__(  609,    GetFingerState (dev));
-	__(  611,    GetFingerState (dev));
-	__(  613,    GetFingerState (dev));
-	__(  615,    GetFingerState (dev));
-	__(  617,    GetFingerState (dev));
-	__(  619,    GetFingerState (dev));
-	__(  621,    GetFingerState (dev));
-	__(  623,    GetFingerState (dev));
-	__(  625,    GetFingerState (dev));
-	__(  627,    GetFingerState (dev));
-	__(  629,    GetFingerState (dev));
-	__(  631,    GetFingerState (dev));
-	__(  633,    GetFingerState (dev));
-	__(  635,    GetFingerState (dev));
-	__(  637,    GetFingerState (dev));
-	__(  639,    GetFingerState (dev));
-	__(  641,    GetFingerState (dev));
-	__(  643,    GetFingerState (dev));
-	__(  645,    GetFingerState (dev));
-	__(  647,    GetFingerState (dev));
-	__(  649,    GetFingerState (dev));
-	__(  651,    GetFingerState (dev));
-	__(  653,    GetFingerState (dev));
-	__(  655,    GetFingerState (dev));
-	__(  657,    GetFingerState (dev));
-	__(  659,    GetFingerState (dev));
-	__(  661,    GetFingerState (dev));
-	__(  663,    GetFingerState (dev));
-	__(  665,    GetFingerState (dev));
-	__(  667,    GetFingerState (dev));
-	__(  669,    GetFingerState (dev));
-	__(  671,    GetFingerState (dev));
-	__(  673,    GetFingerState (dev));
-	__(  675,    GetFingerState (dev));
-	__(  677,    GetFingerState (dev));
-	__(  679,    GetFingerState (dev));
-	__(  681,    GetFingerState (dev));
-	__(  683,    GetFingerState (dev));
-	__(  685,    GetFingerState (dev));
-	__(  687,    GetFingerState (dev));
-	__(  689,    GetFingerState (dev));
-	__(  691,    GetFingerState (dev));
-	__(  693,    GetFingerState (dev));
-	__(  695,    GetFingerState (dev));
-	__(  697,    GetFingerState (dev));
-	__(  699,    GetFingerState (dev));
-	__(  701,    GetFingerState (dev));
-	__(  703,    GetFingerState (dev));
-	__(  705,    GetFingerState (dev));
-	__(  707,    GetFingerState (dev));
-	__(  709,    GetFingerState (dev));
-	__(  711,    GetFingerState (dev));
-	__(  713,    GetFingerState (dev));
-	__(  715,    GetFingerState (dev));
-	__(  717,    GetFingerState (dev));
-	__(  719,    GetFingerState (dev));
-	__(  721,    GetFingerState (dev));
-	__(  723,    GetFingerState (dev));
-	__(  725,    GetFingerState (dev));
-	__(  727,    GetFingerState (dev));
-	__(  729,    GetFingerState (dev));
-	__(  731,    GetFingerState (dev));
-	__(  733,    GetFingerState (dev));
-	__(  735,    GetFingerState (dev));
-	__(  737,    GetFingerState (dev));
-	__(  739,    GetFingerState (dev));
-	__(  741,    GetFingerState (dev));
-	__(  743,    GetFingerState (dev));
-	__(  745,    GetFingerState (dev));
-	__(  747,    GetFingerState (dev));
-	__(  749,    GetFingerState (dev));
-	__(  751,    GetFingerState (dev));
-	__(  753,    GetFingerState (dev));
-	__(  755,    GetFingerState (dev));
-	__(  757,    GetFingerState (dev));
-	__(  759,    GetFingerState (dev));
-	__(  761,    GetFingerState (dev));
-	__(  763,    GetFingerState (dev));
-	__(  765,    GetFingerState (dev));
-	__(  767,    GetFingerState (dev));
-	__(  769,    GetFingerState (dev));
-	__(  771,    GetFingerState (dev));
-	__(  773,    GetFingerState (dev));
-	__(  775,    GetFingerState (dev));
-	__(  777,    GetFingerState (dev));
-	__(  779,    GetFingerState (dev));
-	__(  781,    GetFingerState (dev));
-	__(  783,    GetFingerState (dev));
-	__(  785,    GetFingerState (dev));
-	__(  787,    GetFingerState (dev));
-	__(  789,    GetFingerState (dev));
-	__(  791,    GetFingerState (dev));
-	__(  793,    GetFingerState (dev));
-	__(  795,    GetFingerState (dev));
-	__(  797,    GetFingerState (dev));
-	__(  799,    GetFingerState (dev));
-	__(  801,    GetFingerState (dev));
-	__(  803,    GetFingerState (dev));
-	__(  805,    GetFingerState (dev));
-	__(  807,    GetFingerState (dev));
-	__(  809,    GetFingerState (dev));
-	__(  811,    GetFingerState (dev));
-	__(  813,    GetFingerState (dev));
-	__(  815,    GetFingerState (dev));
-	__(  817,    GetFingerState (dev));
-	__(  819,    GetFingerState (dev));
-	__(  821,    GetFingerState (dev));
-	__(  823,    GetFingerState (dev));
-	__(  825,    GetFingerState (dev));
-	__(  827,    GetFingerState (dev));
-	__(  829,    GetFingerState (dev));
-	__(  831,    GetFingerState (dev));
-	__(  833,    GetFingerState (dev));
-	__(  835,    GetFingerState (dev));
-	__(  837,    GetFingerState (dev));
-	__(  839,    GetFingerState (dev));
-	__(  841,    GetFingerState (dev));
-	__(  843,    GetFingerState (dev));
-	__(  845,    GetFingerState (dev));
-	__(  847,    GetFingerState (dev));
-	__(  849,    GetFingerState (dev));
-	__(  851,    GetFingerState (dev));
-	__(  853,    GetFingerState (dev));
-	__(  855,    GetFingerState (dev));
-	__(  857,    GetFingerState (dev));
-	__(  859,    GetFingerState (dev));
-	__(  861,    GetFingerState (dev));
-	__(  863,    GetFingerState (dev));
-	__(  865,    GetFingerState (dev));
-	__(  867,    GetFingerState (dev));
-	__(  869,    GetFingerState (dev));
-	__(  871,    GetFingerState (dev));
-	__(  873,    GetFingerState (dev));
-	__(  875,    GetFingerState (dev));
-	__(  877,    GetFingerState (dev));
-	__(  879,    GetFingerState (dev));
-	__(  881,    GetFingerState (dev));
-	__(  883,    GetFingerState (dev));
-	__(  885,    GetFingerState (dev));
-	__(  887,    GetFingerState (dev));
-	__(  889,    GetFingerState (dev));
-	__(  891,    GetFingerState (dev));
-	__(  893,    GetFingerState (dev));
-	__(  895,    GetFingerState (dev));
-	__(  897,    GetFingerState (dev));
-	__(  899,    GetFingerState (dev));
-	__(  901,    GetFingerState (dev));
-	__(  903,    GetFingerState (dev));
-	__(  905,    GetFingerState (dev));
-	__(  907,    GetFingerState (dev));
-	__(  909,    GetFingerState (dev));
-	__(  911,    GetFingerState (dev));
-	__(  913,    GetFingerState (dev));
-	__(  915,    GetFingerState (dev));
-	__(  917,    GetFingerState (dev));
-	__(  919,    GetFingerState (dev));
-	__(  921,    GetFingerState (dev));
-	__(  923,    GetFingerState (dev));
-	__(  925,    GetFingerState (dev));
-	__(  927,    GetFingerState (dev));
-	__(  929,    GetFingerState (dev));
-	__(  931,    GetFingerState (dev));
-	__(  933,    GetFingerState (dev));
-	__(  935,    GetFingerState (dev));
-	__(  937,    GetFingerState (dev));
-	__(  939,    GetFingerState (dev));
-	__(  941,    GetFingerState (dev));
-	__(  943,    GetFingerState (dev));
-	__(  945,    GetFingerState (dev));
-	__(  947,    GetFingerState (dev));
-	__(  949,    GetFingerState (dev));
-	__(  951,    GetFingerState (dev));
-	__(  953,    GetFingerState (dev));
-	__(  955,    GetFingerState (dev));
-	__(  957,    GetFingerState (dev));
-	__(  959,    GetFingerState (dev));
-	__(  961,    GetFingerState (dev));
-	__(  963,    GetFingerState (dev));
-	__(  965,    GetFingerState (dev));
-	__(  967,    GetFingerState (dev));
-	__(  969,    GetFingerState (dev));
-	__(  971,    GetFingerState (dev));
-	__(  973,    GetFingerState (dev));
-	__(  975,    GetFingerState (dev));
-	__(  977,    GetFingerState (dev));
-	__(  979,    GetFingerState (dev));
-	__(  981,    GetFingerState (dev));
-	__(  983,    GetFingerState (dev));
-	__(  985,    GetFingerState (dev));
-	__(  987,    GetFingerState (dev));
-	__(  989,    GetFingerState (dev));
-	__(  991,    GetFingerState (dev));
-	__(  993,    GetFingerState (dev));
-	__(  995,    GetFingerState (dev));
-	__(  997,    GetFingerState (dev));
-	__(  999,    GetFingerState (dev));
-	__( 1001,    GetFingerState (dev));
-	__( 1003,    GetFingerState (dev));
-	__( 1005,    GetFingerState (dev));
-	__( 1007,    GetFingerState (dev));
-	__( 1009,    GetFingerState (dev));
-	__( 1011,    GetFingerState (dev));
-	__( 1013,    GetFingerState (dev));
-	__( 1015,    GetFingerState (dev));
-	__( 1017,    GetFingerState (dev));
-	__( 1019,    GetFingerState (dev));
-	__( 1021,    GetFingerState (dev));
-	__( 1023,    GetFingerState (dev));
-	__( 1025,    GetFingerState (dev));
-	__( 1027,    GetFingerState (dev));
-	__( 1029,    GetFingerState (dev));
-	__( 1031,    GetFingerState (dev));
-	__( 1033,    GetFingerState (dev));
-	__( 1035,    GetFingerState (dev));
-	__( 1037,    GetFingerState (dev));
-	__( 1039,    GetFingerState (dev));
-	__( 1041,    GetFingerState (dev));
-	__( 1043,    GetFingerState (dev));
-	__( 1045,    GetFingerState (dev));
-	__( 1047,    GetFingerState (dev));
-	__( 1049,    GetFingerState (dev));
-	__( 1051,    GetFingerState (dev));
-	__( 1053,    GetFingerState (dev));
-	__( 1055,    GetFingerState (dev));
-	__( 1057,    GetFingerState (dev));
-	__( 1059,    GetFingerState (dev));
-	__( 1061,    GetFingerState (dev));
-	__( 1063,    GetFingerState (dev));
-	__( 1065,    GetFingerState (dev));
-	__( 1067,    GetFingerState (dev));
-	__( 1069,    GetFingerState (dev));
-	__( 1071,    GetFingerState (dev));
-	__( 1073,    GetFingerState (dev));
-	__( 1075,    GetFingerState (dev));
-	__( 1077,    GetFingerState (dev));
-	__( 1079,    GetFingerState (dev));
-	__( 1081,    GetFingerState (dev));
-	__( 1083,    GetFingerState (dev));
-	__( 1085,    GetFingerState (dev));
-	__( 1087,    GetFingerState (dev));
-	__( 1089,    GetFingerState (dev));
-	__( 1091,    GetFingerState (dev));
-	__( 1093,    GetFingerState (dev));
-	__( 1095,    GetFingerState (dev));
-	__( 1097,    GetFingerState (dev));
-	__( 1099,    GetFingerState (dev));
-	__( 1101,    GetFingerState (dev));
-	__( 1103,    GetFingerState (dev));
-	__( 1105,    GetFingerState (dev));
-	__( 1107,    GetFingerState (dev));
-	__( 1109,    GetFingerState (dev));
-	__( 1111,    GetFingerState (dev));
-	__( 1113,    GetFingerState (dev));
-	__( 1115,    GetFingerState (dev));
-	__( 1117,    GetFingerState (dev));
-	__( 1119,    GetFingerState (dev));
-	__( 1121,    GetFingerState (dev));
-	__( 1123,    GetFingerState (dev));
-	 _(          LoadImage (dev));
-	__( 1126,    GetParam (dev, 0x0014));
-	__( 1128,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 1131,    GetParam (dev, 0x0011));
-	__( 1133,    SetParam (dev, 0x0062, 0x0032));
-	__( 1135,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__( 1138,    GetConfig (dev));
-	__( 1140,    GetParam (dev, 0x002e));
-	__( 1142,    GetVersion (dev));
-	__( 1144,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 1147,    SetParam (dev, 0x0055, 0x0008));
-	__( 1149,    SetParam (dev, 0x0055, 0x0008));
-	__( 1151,    SetParam (dev, 0x0055, 0x0008));
-	__( 1153,    GetParam (dev, 0x0014));
-	__( 1155,    GetParam (dev, 0x0011));
-	__( 1157,    SetParam (dev, 0x0062, 0x0032));
-	__( 1159,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__( 1162,    GetParam (dev, 0x0014));
-	__( 1164,    GetParam (dev, 0x0014));
-	__( 1166,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 1169,    GetParam (dev, 0x0011));
-	__( 1171,    SetParam (dev, 0x0062, 0x0032));
-	__( 1173,    GetPrint (dev, 0x1388, type_1));
-	__( 1175,    GetFingerState (dev));
-	__( 1177,    GetFingerState (dev));
-	__( 1179,    GetFingerState (dev));
-	__( 1181,    GetFingerState (dev));
-	__( 1183,    GetFingerState (dev));
-	__( 1185,    GetFingerState (dev));
-	__( 1187,    GetFingerState (dev));
-	__( 1189,    GetFingerState (dev));
-	__( 1191,    GetFingerState (dev));
-	__( 1193,    GetFingerState (dev));
-	__( 1195,    GetFingerState (dev));
-	__( 1197,    GetFingerState (dev));
-	__( 1199,    GetFingerState (dev));
-	__( 1201,    GetFingerState (dev));
-	__( 1203,    GetFingerState (dev));
-	__( 1205,    GetFingerState (dev));
-	__( 1207,    GetFingerState (dev));
-	__( 1209,    GetFingerState (dev));
-	__( 1211,    GetFingerState (dev));
-	__( 1213,    GetFingerState (dev));
-	__( 1215,    GetFingerState (dev));
-	__( 1217,    GetFingerState (dev));
-	__( 1219,    GetFingerState (dev));
-	__( 1221,    GetFingerState (dev));
-	__( 1223,    GetFingerState (dev));
-	__( 1225,    GetFingerState (dev));
-	__( 1227,    GetFingerState (dev));
-	__( 1229,    GetFingerState (dev));
-	__( 1231,    GetFingerState (dev));
-	__( 1233,    GetFingerState (dev));
-	__( 1235,    GetFingerState (dev));
-	__( 1237,    GetFingerState (dev));
-	__( 1239,    GetFingerState (dev));
-	__( 1241,    GetFingerState (dev));
-	__( 1243,    GetFingerState (dev));
-	__( 1245,    GetFingerState (dev));
-	__( 1247,    GetFingerState (dev));
-	__( 1249,    GetFingerState (dev));
-	__( 1251,    GetFingerState (dev));
-	__( 1253,    GetFingerState (dev));
-	__( 1255,    GetFingerState (dev));
-	__( 1257,    GetFingerState (dev));
-	__( 1259,    GetFingerState (dev));
-	__( 1261,    GetFingerState (dev));
-	__( 1263,    GetFingerState (dev));
-	__( 1265,    GetFingerState (dev));
-	__( 1267,    GetFingerState (dev));
-	__( 1269,    GetFingerState (dev));
-	__( 1271,    GetFingerState (dev));
-	__( 1273,    GetFingerState (dev));
-	__( 1275,    GetFingerState (dev));
-	__( 1277,    GetFingerState (dev));
-	__( 1279,    GetFingerState (dev));
-	__( 1281,    GetFingerState (dev));
-	__( 1283,    GetFingerState (dev));
-	__( 1285,    GetFingerState (dev));
-	__( 1287,    GetFingerState (dev));
-	__( 1289,    GetFingerState (dev));
-	__( 1291,    GetFingerState (dev));
-	__( 1293,    GetFingerState (dev));
-	__( 1295,    GetFingerState (dev));
-	__( 1297,    GetFingerState (dev));
-	__( 1299,    GetFingerState (dev));
-	__( 1301,    GetFingerState (dev));
-	__( 1303,    GetFingerState (dev));
-	__( 1305,    GetFingerState (dev));
-	__( 1307,    GetFingerState (dev));
-	__( 1309,    GetFingerState (dev));
-	__( 1311,    GetFingerState (dev));
-	__( 1313,    GetFingerState (dev));
-	__( 1315,    GetFingerState (dev));
-	__( 1317,    GetFingerState (dev));
-	__( 1319,    GetFingerState (dev));
-	__( 1321,    GetFingerState (dev));
-	__( 1323,    GetFingerState (dev));
-	__( 1325,    GetFingerState (dev));
-	__( 1327,    GetFingerState (dev));
-	__( 1329,    GetFingerState (dev));
-	__( 1331,    GetFingerState (dev));
-	__( 1333,    GetFingerState (dev));
-	__( 1335,    GetFingerState (dev));
-	__( 1337,    GetFingerState (dev));
-	__( 1339,    GetFingerState (dev));
-	__( 1341,    GetFingerState (dev));
-	__( 1343,    GetFingerState (dev));
-	__( 1345,    GetFingerState (dev));
-	__( 1347,    GetFingerState (dev));
-	__( 1349,    GetFingerState (dev));
-	__( 1351,    GetFingerState (dev));
-	__( 1353,    GetFingerState (dev));
-	__( 1355,    GetFingerState (dev));
-	__( 1357,    GetFingerState (dev));
-	__( 1359,    GetFingerState (dev));
-	__( 1361,    GetFingerState (dev));
-	__( 1363,    GetFingerState (dev));
-	__( 1365,    GetFingerState (dev));
-	__( 1367,    GetFingerState (dev));
-	__( 1369,    GetFingerState (dev));
-	__( 1371,    GetFingerState (dev));
-	__( 1373,    GetFingerState (dev));
-	__( 1375,    GetFingerState (dev));
-	__( 1377,    GetFingerState (dev));
-	__( 1379,    GetFingerState (dev));
-	__( 1381,    GetFingerState (dev));
-	__( 1383,    GetFingerState (dev));
-	__( 1385,    GetFingerState (dev));
-	__( 1387,    GetFingerState (dev));
-	__( 1389,    GetFingerState (dev));
-	__( 1391,    GetFingerState (dev));
-	__( 1393,    GetFingerState (dev));
-	__( 1395,    GetFingerState (dev));
-	__( 1397,    GetFingerState (dev));
-	__( 1399,    GetFingerState (dev));
-	__( 1401,    GetFingerState (dev));
-	__( 1403,    GetFingerState (dev));
-	__( 1405,    GetFingerState (dev));
-	__( 1407,    GetFingerState (dev));
-	__( 1409,    GetFingerState (dev));
-	__( 1411,    GetFingerState (dev));
-	__( 1413,    GetFingerState (dev));
-	__( 1415,    GetFingerState (dev));
-	__( 1417,    GetFingerState (dev));
-	__( 1419,    GetFingerState (dev));
-	__( 1421,    GetFingerState (dev));
-	__( 1423,    GetFingerState (dev));
-	__( 1425,    GetFingerState (dev));
-	__( 1427,    GetFingerState (dev));
-	__( 1429,    GetFingerState (dev));
-	__( 1431,    GetFingerState (dev));
-	__( 1433,    GetFingerState (dev));
-	__( 1435,    GetFingerState (dev));
-	__( 1437,    GetFingerState (dev));
-	__( 1439,    GetFingerState (dev));
-	__( 1441,    GetFingerState (dev));
-	__( 1443,    GetFingerState (dev));
-	__( 1445,    GetFingerState (dev));
-	__( 1447,    GetFingerState (dev));
-	__( 1449,    GetFingerState (dev));
-	__( 1451,    GetFingerState (dev));
-	__( 1453,    GetFingerState (dev));
-	__( 1547,    GetFingerState (dev));
-	__( 1549,    GetFingerState (dev));
-	__( 1551,    GetFingerState (dev));
-	__( 1553,    GetFingerState (dev));
-	__( 1555,    GetFingerState (dev));
-	__( 1557,    GetFingerState (dev));
-	__( 1559,    GetFingerState (dev));
-	__( 1561,    GetFingerState (dev));
-	__( 1563,    GetFingerState (dev));
-	__( 1565,    GetFingerState (dev));
-	__( 1567,    GetFingerState (dev));
-	__( 1569,    GetFingerState (dev));
-	__( 1571,    GetFingerState (dev));
-	__( 1573,    GetFingerState (dev));
-	__( 1575,    GetFingerState (dev));
-	__( 1577,    GetFingerState (dev));
-	__( 1579,    GetFingerState (dev));
-	__( 1581,    GetFingerState (dev));
-	__( 1583,    GetFingerState (dev));
-	__( 1585,    GetFingerState (dev));
-	__( 1587,    GetFingerState (dev));
-	__( 1589,    GetFingerState (dev));
-	__( 1591,    GetFingerState (dev));
-	__( 1593,    GetFingerState (dev));
-	__( 1595,    GetFingerState (dev));
-	__( 1597,    GetFingerState (dev));
-	__( 1599,    GetFingerState (dev));
-	__( 1601,    GetFingerState (dev));
-	__( 1603,    GetFingerState (dev));
-	__( 1605,    GetFingerState (dev));
-	__( 1607,    GetFingerState (dev));
-	__( 1609,    GetFingerState (dev));
-	__( 1611,    GetFingerState (dev));
-	__( 1613,    GetFingerState (dev));
-	__( 1615,    GetFingerState (dev));
-	__( 1617,    GetFingerState (dev));
-	__( 1619,    GetFingerState (dev));
-	__( 1621,    GetFingerState (dev));
-	__( 1623,    GetFingerState (dev));
-	__( 1625,    GetFingerState (dev));
-	__( 1627,    GetFingerState (dev));
-	__( 1629,    GetFingerState (dev));
-	__( 1631,    GetFingerState (dev));
-	__( 1633,    GetFingerState (dev));
-	__( 1635,    GetFingerState (dev));
-	__( 1637,    GetFingerState (dev));
-	__( 1639,    GetFingerState (dev));
-	__( 1641,    GetFingerState (dev));
-	__( 1643,    GetFingerState (dev));
-	__( 1645,    GetFingerState (dev));
-	__( 1647,    GetFingerState (dev));
-	__( 1649,    GetFingerState (dev));
-	__( 1651,    GetFingerState (dev));
-	__( 1653,    GetFingerState (dev));
-	__( 1655,    GetFingerState (dev));
-	__( 1657,    GetFingerState (dev));
-	__( 1659,    GetFingerState (dev));
-	__( 1661,    GetFingerState (dev));
-	__( 1663,    GetFingerState (dev));
-	__( 1665,    GetFingerState (dev));
-	__( 1667,    GetFingerState (dev));
-	__( 1669,    GetFingerState (dev));
-	__( 1671,    GetFingerState (dev));
-	__( 1673,    GetFingerState (dev));
-	__( 1675,    GetFingerState (dev));
-	__( 1677,    GetFingerState (dev));
-	__( 1679,    GetFingerState (dev));
-	__( 1681,    GetFingerState (dev));
-	__( 1683,    GetFingerState (dev));
-	__( 1685,    GetFingerState (dev));
-	__( 1687,    GetFingerState (dev));
-	__( 1689,    GetFingerState (dev));
-	__( 1691,    GetFingerState (dev));
-	__( 1693,    GetFingerState (dev));
-	__( 1695,    GetFingerState (dev));
-	__( 1697,    GetFingerState (dev));
-	__( 1699,    GetFingerState (dev));
-	__( 1701,    GetFingerState (dev));
-	__( 1703,    GetFingerState (dev));
-	__( 1705,    GetFingerState (dev));
-	__( 1707,    GetFingerState (dev));
-	__( 1709,    GetFingerState (dev));
-	__( 1711,    GetFingerState (dev));
-	__( 1713,    GetFingerState (dev));
-	__( 1715,    GetFingerState (dev));
-	__( 1717,    GetFingerState (dev));
-	__( 1719,    GetFingerState (dev));
-	__( 1721,    GetFingerState (dev));
-	__( 1723,    GetFingerState (dev));
-	__( 1725,    GetFingerState (dev));
-	__( 1727,    GetFingerState (dev));
-	__( 1729,    GetFingerState (dev));
-	__( 1731,    GetFingerState (dev));
-	__( 1733,    GetFingerState (dev));
-	__( 1735,    GetFingerState (dev));
-	__( 1737,    GetFingerState (dev));
-	__( 1739,    GetFingerState (dev));
-	__( 1741,    GetFingerState (dev));
-	__( 1743,    GetFingerState (dev));
-	__( 1745,    GetFingerState (dev));
-	__( 1747,    GetFingerState (dev));
-	__( 1749,    GetFingerState (dev));
-	__( 1751,    GetFingerState (dev));
-	__( 1753,    GetFingerState (dev));
-	__( 1755,    GetFingerState (dev));
-	__( 1757,    GetFingerState (dev));
-	__( 1759,    GetFingerState (dev));
-	__( 1761,    GetFingerState (dev));
-	__( 1763,    GetFingerState (dev));
-	__( 1765,    GetFingerState (dev));
-	__( 1767,    GetFingerState (dev));
-	__( 1769,    GetFingerState (dev));
-	__( 1771,    GetFingerState (dev));
-	__( 1773,    GetFingerState (dev));
-	__( 1775,    GetFingerState (dev));
-	__( 1777,    GetFingerState (dev));
-	__( 1779,    GetFingerState (dev));
-	__( 1781,    GetFingerState (dev));
-	__( 1783,    GetFingerState (dev));
-	__( 1785,    GetFingerState (dev));
-	__( 1787,    GetFingerState (dev));
-	__( 1789,    GetFingerState (dev));
-	__( 1791,    GetFingerState (dev));
-	__( 1793,    GetFingerState (dev));
-	__( 1795,    GetFingerState (dev));
-	__( 1797,    GetFingerState (dev));
-	__( 1799,    GetFingerState (dev));
-	__( 1801,    GetFingerState (dev));
-	__( 1803,    GetFingerState (dev));
-	__( 1805,    GetFingerState (dev));
-	__( 1807,    GetFingerState (dev));
-	__( 1809,    GetFingerState (dev));
-	__( 1811,    GetFingerState (dev));
-	__( 1813,    GetFingerState (dev));
-	__( 1815,    GetFingerState (dev));
-	__( 1817,    GetFingerState (dev));
-	__( 1819,    GetFingerState (dev));
-	__( 1821,    GetFingerState (dev));
-	__( 1823,    GetFingerState (dev));
-	__( 1825,    GetFingerState (dev));
-	__( 1827,    GetFingerState (dev));
-	__( 1829,    GetFingerState (dev));
-	__( 1831,    GetFingerState (dev));
-	__( 1833,    GetFingerState (dev));
-	__( 1835,    GetFingerState (dev));
-	__( 1837,    GetFingerState (dev));
-	__( 1839,    GetFingerState (dev));
-	__( 1841,    GetFingerState (dev));
-	__( 1843,    GetFingerState (dev));
-	__( 1845,    GetFingerState (dev));
-	__( 1847,    GetFingerState (dev));
-	__( 1849,    GetFingerState (dev));
-	__( 1851,    GetFingerState (dev));
-	__( 1853,    GetFingerState (dev));
-	__( 1855,    GetFingerState (dev));
-	__( 1857,    GetFingerState (dev));
-	__( 1859,    GetFingerState (dev));
-	__( 1861,    GetFingerState (dev));
-	__( 1863,    GetFingerState (dev));
-	__( 1865,    GetFingerState (dev));
-	__( 1867,    GetFingerState (dev));
-	__( 1869,    GetFingerState (dev));
-	__( 1871,    GetFingerState (dev));
-	__( 1873,    GetFingerState (dev));
-	__( 1875,    GetFingerState (dev));
-	__( 1877,    GetFingerState (dev));
-	__( 1879,    GetFingerState (dev));
-	__( 1881,    GetFingerState (dev));
-	__( 1883,    GetFingerState (dev));
-	__( 1885,    GetFingerState (dev));
-	__( 1887,    GetFingerState (dev));
-	__( 1889,    GetFingerState (dev));
-	__( 1891,    GetFingerState (dev));
-	__( 1893,    GetFingerState (dev));
-	__( 1895,    GetFingerState (dev));
-	__( 1897,    GetFingerState (dev));
-	__( 1899,    GetFingerState (dev));
-	__( 1901,    GetFingerState (dev));
-	__( 1903,    GetFingerState (dev));
-	__( 1905,    GetFingerState (dev));
-	__( 1907,    GetFingerState (dev));
-	__( 1909,    GetFingerState (dev));
-	__( 1911,    GetFingerState (dev));
-	__( 1913,    GetFingerState (dev));
-	__( 1915,    GetFingerState (dev));
-	__( 1917,    GetFingerState (dev));
-	__( 1919,    GetFingerState (dev));
-	__( 1921,    GetFingerState (dev));
-	__( 1923,    GetFingerState (dev));
-	__( 1925,    GetFingerState (dev));
-	__( 1927,    GetFingerState (dev));
-	__( 1929,    GetFingerState (dev));
-	__( 1931,    GetFingerState (dev));
-	__( 1933,    GetFingerState (dev));
-	__( 1935,    GetFingerState (dev));
-	__( 1937,    GetFingerState (dev));
-	__( 1939,    GetFingerState (dev));
-	__( 1941,    GetFingerState (dev));
-	__( 1943,    GetFingerState (dev));
-	__( 1945,    GetFingerState (dev));
-	__( 1947,    GetFingerState (dev));
-	__( 1949,    GetFingerState (dev));
-	__( 1951,    GetFingerState (dev));
-	__( 1953,    GetFingerState (dev));
-	__( 1955,    GetFingerState (dev));
-	__( 1957,    GetFingerState (dev));
-	__( 1959,    GetFingerState (dev));
-	__( 1961,    GetFingerState (dev));
-	__( 1963,    GetFingerState (dev));
-	__( 1965,    GetFingerState (dev));
-	__( 1967,    GetFingerState (dev));
-	__( 1969,    GetFingerState (dev));
-	__( 1971,    GetFingerState (dev));
-	__( 1973,    GetFingerState (dev));
-	__( 1975,    GetFingerState (dev));
-	__( 1977,    GetFingerState (dev));
-	__( 1979,    GetFingerState (dev));
-	__( 1981,    GetFingerState (dev));
-	__( 1983,    GetFingerState (dev));
-	__( 1985,    GetFingerState (dev));
-	__( 1987,    GetFingerState (dev));
-	__( 1989,    GetFingerState (dev));
-	__( 1991,    GetFingerState (dev));
-	__( 1993,    GetFingerState (dev));
-	__( 1995,    GetFingerState (dev));
-	__( 1997,    GetFingerState (dev));
-	__( 1999,    GetFingerState (dev));
-	__( 2001,    GetFingerState (dev));
-	__( 2003,    GetFingerState (dev));
-	__( 2005,    GetFingerState (dev));
-	__( 2007,    GetFingerState (dev));
-	__( 2009,    GetFingerState (dev));
-	__( 2011,    GetFingerState (dev));
-	__( 2013,    GetFingerState (dev));
-	__( 2015,    GetFingerState (dev));
-	__( 2017,    GetFingerState (dev));
-	__( 2019,    GetFingerState (dev));
-	__( 2021,    GetFingerState (dev));
-	__( 2023,    GetFingerState (dev));
-	__( 2025,    GetFingerState (dev));
-	__( 2027,    GetFingerState (dev));
-	__( 2029,    GetFingerState (dev));
-	__( 2031,    GetFingerState (dev));
-	__( 2033,    GetFingerState (dev));
-	__( 2035,    GetFingerState (dev));
-	__( 2037,    GetFingerState (dev));
-	__( 2039,    GetFingerState (dev));
-	__( 2041,    GetFingerState (dev));
-	__( 2043,    GetFingerState (dev));
-	__( 2045,    GetFingerState (dev));
-	__( 2047,    GetFingerState (dev));
-	__( 2049,    GetFingerState (dev));
-	__( 2051,    GetFingerState (dev));
-	__( 2053,    GetFingerState (dev));
-	__( 2055,    GetFingerState (dev));
-	__( 2057,    GetFingerState (dev));
-	__( 2059,    GetFingerState (dev));
-	__( 2061,    GetFingerState (dev));
-	__( 2063,    GetFingerState (dev));
-	__( 2065,    GetFingerState (dev));
-	__( 2067,    GetFingerState (dev));
-	__( 2069,    GetFingerState (dev));
-	__( 2071,    GetFingerState (dev));
-	__( 2073,    GetFingerState (dev));
-	__( 2075,    GetFingerState (dev));
-	__( 2077,    GetFingerState (dev));
-	__( 2079,    GetFingerState (dev));
-	__( 2081,    GetFingerState (dev));
-	__( 2083,    GetFingerState (dev));
-	__( 2085,    GetFingerState (dev));
-	__( 2087,    GetFingerState (dev));
-	__( 2089,    GetFingerState (dev));
-	__( 2091,    GetFingerState (dev));
-	__( 2093,    GetFingerState (dev));
-	__( 2095,    GetFingerState (dev));
-	__( 2097,    GetFingerState (dev));
-	__( 2099,    GetFingerState (dev));
-	__( 2101,    GetFingerState (dev));
-	__( 2103,    GetFingerState (dev));
-	__( 2105,    GetFingerState (dev));
-	__( 2107,    GetFingerState (dev));
-	__( 2109,    GetFingerState (dev));
-	__( 2111,    GetFingerState (dev));
-	__( 2113,    GetFingerState (dev));
-	__( 2115,    GetFingerState (dev));
-	__( 2117,    GetFingerState (dev));
-	__( 2119,    GetFingerState (dev));
-	__( 2121,    GetFingerState (dev));
-	__( 2123,    GetFingerState (dev));
-	__( 2125,    GetFingerState (dev));
-	__( 2127,    GetFingerState (dev));
-	__( 2129,    GetFingerState (dev));
-	__( 2131,    GetFingerState (dev));
-	__( 2133,    GetFingerState (dev));
-	__( 2135,    GetFingerState (dev));
-	__( 2137,    GetFingerState (dev));
-	__( 2139,    GetFingerState (dev));
-	__( 2141,    GetFingerState (dev));
-	__( 2143,    GetFingerState (dev));
-	__( 2145,    GetFingerState (dev));
-	__( 2147,    GetFingerState (dev));
-	__( 2149,    GetFingerState (dev));
-	__( 2151,    GetFingerState (dev));
-	__( 2153,    GetFingerState (dev));
-	__( 2155,    GetFingerState (dev));
-	__( 2157,    GetFingerState (dev));
-	__( 2159,    GetFingerState (dev));
-	__( 2161,    GetFingerState (dev));
-	__( 2163,    GetFingerState (dev));
-	__( 2165,    GetFingerState (dev));
-	__( 2167,    GetFingerState (dev));
-	__( 2169,    GetFingerState (dev));
-	__( 2171,    GetFingerState (dev));
-	__( 2173,    GetFingerState (dev));
-	__( 2175,    GetFingerState (dev));
-	__( 2177,    GetFingerState (dev));
-	__( 2179,    GetFingerState (dev));
-	__( 2181,    GetFingerState (dev));
-	__( 2183,    GetFingerState (dev));
-	__( 2185,    GetFingerState (dev));
-	__( 2187,    GetFingerState (dev));
-	__( 2189,    GetFingerState (dev));
-	__( 2191,    GetFingerState (dev));
-	__( 2193,    GetFingerState (dev));
-	__( 2195,    GetFingerState (dev));
-	__( 2197,    GetFingerState (dev));
-	__( 2199,    GetFingerState (dev));
-	__( 2201,    GetFingerState (dev));
-	__( 2203,    GetFingerState (dev));
-	__( 2205,    GetFingerState (dev));
-	__( 2207,    GetFingerState (dev));
-	__( 2209,    GetFingerState (dev));
-	__( 2211,    GetFingerState (dev));
-	__( 2213,    GetFingerState (dev));
-	__( 2215,    GetFingerState (dev));
-	__( 2217,    GetFingerState (dev));
-	__( 2219,    GetFingerState (dev));
-	__( 2221,    GetFingerState (dev));
-	__( 2223,    GetFingerState (dev));
-	__( 2225,    GetFingerState (dev));
-	__( 2227,    GetFingerState (dev));
-	__( 2229,    GetFingerState (dev));
-	__( 2231,    GetFingerState (dev));
-	__( 2233,    GetFingerState (dev));
-	__( 2235,    GetFingerState (dev));
-	__( 2237,    GetFingerState (dev));
-	__( 2239,    GetFingerState (dev));
-	__( 2241,    GetFingerState (dev));
-	__( 2243,    GetFingerState (dev));
-	__( 2245,    GetFingerState (dev));
-	__( 2247,    GetFingerState (dev));
-	__( 2249,    GetFingerState (dev));
-	__( 2251,    GetFingerState (dev));
-	__( 2253,    GetFingerState (dev));
-	__( 2255,    GetFingerState (dev));
-	__( 2257,    GetFingerState (dev));
-	__( 2259,    GetFingerState (dev));
-	__( 2261,    GetFingerState (dev));
-	__( 2263,    GetFingerState (dev));
-	__( 2265,    GetFingerState (dev));
-	__( 2267,    GetFingerState (dev));
-	__( 2269,    GetFingerState (dev));
-	__( 2271,    GetFingerState (dev));
-	__( 2273,    GetFingerState (dev));
-	__( 2275,    GetFingerState (dev));
-	__( 2277,    GetFingerState (dev));
-	__( 2279,    GetFingerState (dev));
-	__( 2281,    GetFingerState (dev));
-	__( 2283,    GetFingerState (dev));
-	__( 2285,    GetFingerState (dev));
-	__( 2287,    GetFingerState (dev));
-	__( 2289,    GetFingerState (dev));
-	__( 2291,    GetFingerState (dev));
-	__( 2293,    GetFingerState (dev));
-	__( 2295,    GetFingerState (dev));
-	__( 2297,    GetFingerState (dev));
-	__( 2299,    GetFingerState (dev));
-	__( 2301,    GetFingerState (dev));
-	__( 2303,    GetFingerState (dev));
-	__( 2305,    GetFingerState (dev));
-	__( 2307,    GetFingerState (dev));
-	__( 2309,    GetFingerState (dev));
-	__( 2311,    GetFingerState (dev));
-	__( 2313,    GetFingerState (dev));
-	__( 2315,    GetFingerState (dev));
-	__( 2317,    GetFingerState (dev));
-	__( 2319,    GetFingerState (dev));
-	__( 2321,    GetFingerState (dev));
-	__( 2323,    GetFingerState (dev));
-	__( 2325,    GetFingerState (dev));
-	__( 2327,    GetFingerState (dev));
-	__( 2329,    GetFingerState (dev));
-	__( 2331,    GetFingerState (dev));
-	__( 2333,    GetFingerState (dev));
-	__( 2335,    GetFingerState (dev));
-	__( 2337,    GetFingerState (dev));
-	__( 2339,    GetFingerState (dev));
-	__( 2341,    GetFingerState (dev));
-	__( 2343,    GetFingerState (dev));
-	__( 2345,    GetFingerState (dev));
-	__( 2347,    GetFingerState (dev));
-	__( 2349,    GetFingerState (dev));
-	__( 2351,    GetFingerState (dev));
-	__( 2353,    GetFingerState (dev));
-	__( 2355,    GetFingerState (dev));
-	__( 2357,    GetFingerState (dev));
-	__( 2359,    GetFingerState (dev));
-	__( 2361,    GetFingerState (dev));
-	__( 2363,    GetFingerState (dev));
-	__( 2365,    GetFingerState (dev));
-	__( 2367,    GetFingerState (dev));
-	__( 2369,    GetFingerState (dev));
-	__( 2371,    GetFingerState (dev));
-	__( 2373,    GetFingerState (dev));
-	__( 2375,    GetFingerState (dev));
-	__( 2377,    GetFingerState (dev));
-	__( 2379,    GetFingerState (dev));
-	__( 2381,    GetFingerState (dev));
-	__( 2383,    GetFingerState (dev));
-	__( 2385,    GetFingerState (dev));
-	__( 2387,    GetFingerState (dev));
-	__( 2389,    GetFingerState (dev));
-	__( 2391,    GetFingerState (dev));
-	__( 2393,    GetFingerState (dev));
-	__( 2395,    GetFingerState (dev));
-	__( 2397,    GetFingerState (dev));
-	__( 2399,    GetFingerState (dev));
-	__( 2401,    GetFingerState (dev));
-	__( 2403,    GetFingerState (dev));
-	__( 2405,    GetFingerState (dev));
-	__( 2407,    GetFingerState (dev));
-	__( 2409,    GetFingerState (dev));
-	__( 2411,    GetFingerState (dev));
-	__( 2413,    GetFingerState (dev));
-	__( 2415,    GetFingerState (dev));
-	__( 2417,    GetFingerState (dev));
-	__( 2419,    GetFingerState (dev));
-	__( 2421,    GetFingerState (dev));
-	__( 2423,    GetFingerState (dev));
-	__( 2425,    GetFingerState (dev));
-	__( 2427,    GetFingerState (dev));
-	__( 2429,    GetFingerState (dev));
-	__( 2431,    GetFingerState (dev));
-	__( 2433,    GetFingerState (dev));
-	__( 2435,    GetFingerState (dev));
-	__( 2437,    GetFingerState (dev));
-	__( 2439,    GetFingerState (dev));
-	__( 2441,    GetFingerState (dev));
-	__( 2443,    GetFingerState (dev));
-	__( 2445,    GetFingerState (dev));
-	__( 2447,    GetFingerState (dev));
-	__( 2449,    GetFingerState (dev));
-	__( 2451,    GetFingerState (dev));
-	__( 2453,    GetFingerState (dev));
-	__( 2455,    GetFingerState (dev));
-	__( 2457,    GetFingerState (dev));
-	__( 2459,    GetFingerState (dev));
-	__( 2461,    GetFingerState (dev));
-	__( 2463,    GetFingerState (dev));
-	__( 2465,    GetFingerState (dev));
-	__( 2467,    GetFingerState (dev));
-	__( 2469,    GetFingerState (dev));
-	__( 2471,    GetFingerState (dev));
-	__( 2473,    GetFingerState (dev));
-	__( 2475,    GetFingerState (dev));
-	__( 2477,    GetFingerState (dev));
-	__( 2479,    GetFingerState (dev));
-	__( 2481,    GetFingerState (dev));
-	__( 2483,    GetFingerState (dev));
-	__( 2485,    GetFingerState (dev));
-	__( 2487,    GetFingerState (dev));
-	__( 2489,    GetFingerState (dev));
-	__( 2491,    GetFingerState (dev));
-	__( 2493,    GetFingerState (dev));
-	__( 2495,    GetFingerState (dev));
-	__( 2497,    GetFingerState (dev));
-	__( 2499,    GetFingerState (dev));
-	__( 2501,    GetFingerState (dev));
-	__( 2503,    GetFingerState (dev));
-	__( 2505,    GetFingerState (dev));
-	__( 2507,    GetFingerState (dev));
-	__( 2509,    GetFingerState (dev));
-	__( 2511,    GetFingerState (dev));
-	__( 2513,    GetFingerState (dev));
-	__( 2515,    GetFingerState (dev));
-	__( 2517,    GetFingerState (dev));
-	__( 2519,    GetFingerState (dev));
-	__( 2521,    GetFingerState (dev));
-	__( 2523,    GetFingerState (dev));
-	__( 2525,    GetFingerState (dev));
-	__( 2527,    GetFingerState (dev));
-	__( 2529,    GetFingerState (dev));
-	__( 2531,    GetFingerState (dev));
-	__( 2533,    GetFingerState (dev));
-	__( 2535,    GetFingerState (dev));
-	__( 2537,    GetFingerState (dev));
-	__( 2539,    GetFingerState (dev));
-	__( 2541,    GetFingerState (dev));
-	__( 2543,    GetFingerState (dev));
-	__( 2545,    GetFingerState (dev));
-	__( 2547,    GetFingerState (dev));
-	__( 2549,    GetFingerState (dev));
-	__( 2551,    GetFingerState (dev));
-	__( 2553,    GetFingerState (dev));
-	__( 2555,    GetFingerState (dev));
-	__( 2557,    GetFingerState (dev));
-	__( 2559,    GetFingerState (dev));
-	__( 2561,    GetFingerState (dev));
-	__( 2563,    GetFingerState (dev));
-	__( 2565,    GetFingerState (dev));
-	__( 2567,    GetFingerState (dev));
-	__( 2569,    GetFingerState (dev));
-	__( 2571,    GetFingerState (dev));
-	__( 2573,    GetFingerState (dev));
-	__( 2575,    GetFingerState (dev));
-	__( 2577,    GetFingerState (dev));
-	__( 2579,    GetFingerState (dev));
-	__( 2581,    GetFingerState (dev));
-	__( 2583,    GetFingerState (dev));
-	__( 2585,    GetFingerState (dev));
-	__( 2587,    GetFingerState (dev));
-	__( 2589,    GetFingerState (dev));
-	__( 2591,    GetFingerState (dev));
-	__( 2593,    GetFingerState (dev));
-	__( 2595,    GetFingerState (dev));
-	__( 2597,    GetFingerState (dev));
-	__( 2599,    GetFingerState (dev));
-	__( 2601,    GetFingerState (dev));
-	__( 2603,    GetFingerState (dev));
-	__( 2605,    GetFingerState (dev));
-	__( 2607,    GetFingerState (dev));
-	__( 2609,    GetFingerState (dev));
-	__( 2611,    GetFingerState (dev));
-	__( 2613,    GetFingerState (dev));
-	__( 2615,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 2618,    SetParam (dev, 0x0055, 0x0008));
-	__( 2620,    SetParam (dev, 0x0055, 0x0008));
-	__( 2622,    GetVersion (dev));
-	__( 2624,    GetVersion (dev));
-	__( 2626,    SetParam (dev, 0x0055, 0x0008));
-	__( 2628,    GetParam (dev, 0x0014));
-	__( 2630,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 2633,    GetParam (dev, 0x0011));
-	__( 2635,    SetParam (dev, 0x0062, 0x0032));
-	__( 2637,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__( 2640,    GetParam (dev, 0x0014));
-	__( 2642,    GetParam (dev, 0x0014));
-	__( 2644,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 2647,    GetParam (dev, 0x0011));
-	__( 2649,    SetParam (dev, 0x0062, 0x0032));
-	__( 2651,    GetPrint (dev, 0x1388, type_1));
-	__( 2653,    GetFingerState (dev));
-	__( 2655,    GetFingerState (dev));
-	__( 2657,    GetFingerState (dev));
-	__( 2659,    GetFingerState (dev));
-	__( 2661,    GetFingerState (dev));
-	__( 2663,    GetFingerState (dev));
-	__( 2665,    GetFingerState (dev));
-	__( 2667,    GetFingerState (dev));
-	__( 2669,    GetFingerState (dev));
-	__( 2671,    GetFingerState (dev));
-	__( 2673,    GetFingerState (dev));
-	__( 2675,    GetFingerState (dev));
-	__( 2677,    GetFingerState (dev));
-	__( 2679,    GetFingerState (dev));
-	__( 2681,    GetFingerState (dev));
-	__( 2683,    GetFingerState (dev));
-	__( 2685,    GetFingerState (dev));
-	__( 2687,    GetFingerState (dev));
-	__( 2689,    GetFingerState (dev));
-	__( 2691,    GetFingerState (dev));
-	__( 2693,    GetFingerState (dev));
-	__( 2695,    GetFingerState (dev));
-	__( 2697,    GetFingerState (dev));
-	__( 2699,    GetFingerState (dev));
-	__( 2701,    GetFingerState (dev));
-	__( 2703,    GetFingerState (dev));
-	__( 2705,    GetFingerState (dev));
-	__( 2707,    GetFingerState (dev));
-	__( 2709,    GetFingerState (dev));
-	__( 2711,    GetFingerState (dev));
-	__( 2713,    GetFingerState (dev));
-	__( 2715,    GetFingerState (dev));
-	__( 2717,    GetFingerState (dev));
-	__( 2719,    GetFingerState (dev));
-	__( 2721,    GetFingerState (dev));
-	__( 2723,    GetFingerState (dev));
-	__( 2725,    GetFingerState (dev));
-	__( 2727,    GetFingerState (dev));
-	__( 2729,    GetFingerState (dev));
-	__( 2731,    GetFingerState (dev));
-	__( 2733,    GetFingerState (dev));
-	__( 2735,    GetFingerState (dev));
-	__( 2737,    GetFingerState (dev));
-	 _(          LoadImage (dev));
-	__( 2740,    GetParam (dev, 0x0014));
-	__( 2742,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 2745,    GetParam (dev, 0x0011));
-	__( 2747,    SetParam (dev, 0x0062, 0x0032));
-	__( 2749,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__( 2752,    GetConfig (dev));
-	__( 2754,    GetParam (dev, 0x002e));
-	__( 2756,    GetVersion (dev));
-	__( 2758,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 2761,    SetParam (dev, 0x0055, 0x0008));
-	__( 2763,    SetParam (dev, 0x0055, 0x0008));
-	__( 2765,    SetParam (dev, 0x0055, 0x0008));
-	__( 2767,    GetParam (dev, 0x0014));
-	__( 2769,    GetParam (dev, 0x0011));
-	__( 2771,    SetParam (dev, 0x0062, 0x0032));
-	__( 2773,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__( 2776,    GetParam (dev, 0x0014));
-	__( 2778,    GetParam (dev, 0x0014));
-	__( 2780,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 2783,    GetParam (dev, 0x0011));
-	__( 2785,    SetParam (dev, 0x0062, 0x0032));
-	__( 2787,    GetPrint (dev, 0x1388, type_1));
-	__( 2789,    GetFingerState (dev));
-	__( 2791,    GetFingerState (dev));
-	__( 2793,    GetFingerState (dev));
-	__( 2795,    GetFingerState (dev));
-	__( 2797,    GetFingerState (dev));
-	__( 2799,    GetFingerState (dev));
-	__( 2801,    GetFingerState (dev));
-	__( 2803,    GetFingerState (dev));
-	__( 2805,    GetFingerState (dev));
-	__( 2807,    GetFingerState (dev));
-	__( 2809,    GetFingerState (dev));
-	__( 2811,    GetFingerState (dev));
-	__( 2813,    GetFingerState (dev));
-	__( 2815,    GetFingerState (dev));
-	__( 2817,    GetFingerState (dev));
-	__( 2819,    GetFingerState (dev));
-	__( 2821,    GetFingerState (dev));
-	__( 2823,    GetFingerState (dev));
-	__( 2825,    GetFingerState (dev));
-	__( 2827,    GetFingerState (dev));
-	__( 2829,    GetFingerState (dev));
-	__( 2831,    GetFingerState (dev));
-	__( 2833,    GetFingerState (dev));
-	__( 2835,    GetFingerState (dev));
-	__( 2837,    GetFingerState (dev));
-	__( 2839,    GetFingerState (dev));
-	__( 2841,    GetFingerState (dev));
-	__( 2843,    GetFingerState (dev));
-	__( 2845,    GetFingerState (dev));
-	__( 2847,    GetFingerState (dev));
-	__( 2849,    GetFingerState (dev));
-	__( 2851,    GetFingerState (dev));
-	__( 2853,    GetFingerState (dev));
-	__( 2855,    GetFingerState (dev));
-	__( 2857,    GetFingerState (dev));
-	__( 2859,    GetFingerState (dev));
-	__( 2861,    GetFingerState (dev));
-	__( 2863,    GetFingerState (dev));
-	__( 2865,    GetFingerState (dev));
-	__( 2867,    GetFingerState (dev));
-	__( 2869,    GetFingerState (dev));
-	__( 2871,    GetFingerState (dev));
-	__( 2873,    GetFingerState (dev));
-	__( 2875,    GetFingerState (dev));
-	__( 2877,    GetFingerState (dev));
-	__( 2879,    GetFingerState (dev));
-	__( 2881,    GetFingerState (dev));
-	__( 2883,    GetFingerState (dev));
-	__( 2885,    GetFingerState (dev));
-	__( 2887,    GetFingerState (dev));
-	__( 2889,    GetFingerState (dev));
-	__( 2891,    GetFingerState (dev));
-	__( 2893,    GetFingerState (dev));
-	__( 2895,    GetFingerState (dev));
-	__( 2897,    GetFingerState (dev));
-	__( 2899,    GetFingerState (dev));
-	__( 2901,    GetFingerState (dev));
-	__( 2903,    GetFingerState (dev));
-	__( 2905,    GetFingerState (dev));
-	__( 2907,    GetFingerState (dev));
-	__( 2909,    GetFingerState (dev));
-	__( 2911,    GetFingerState (dev));
-	__( 2913,    GetFingerState (dev));
-	__( 2915,    GetFingerState (dev));
-	__( 2917,    GetFingerState (dev));
-	__( 2919,    GetFingerState (dev));
-	__( 2921,    GetFingerState (dev));
-	__( 2923,    GetFingerState (dev));
-	__( 2925,    GetFingerState (dev));
-	__( 2927,    GetFingerState (dev));
-	__( 2929,    GetFingerState (dev));
-	__( 2931,    GetFingerState (dev));
-	__( 2933,    GetFingerState (dev));
-	__( 2935,    GetFingerState (dev));
-	__( 2937,    GetFingerState (dev));
-	__( 2939,    GetFingerState (dev));
-	__( 2941,    GetFingerState (dev));
-	 _(          LoadImage (dev));
-	__( 2945,    GetParam (dev, 0x0014));
-	__( 2947,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 2950,    GetParam (dev, 0x0011));
-	__( 2952,    SetParam (dev, 0x0062, 0x0032));
-	__( 2954,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__( 2957,    GetConfig (dev));
-	__( 2959,    GetParam (dev, 0x002e));
-	__( 2961,    GetVersion (dev));
-	__( 2963,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 2966,    SetParam (dev, 0x0055, 0x0008));
-	__( 2968,    SetParam (dev, 0x0055, 0x0008));
-	__( 2970,    SetParam (dev, 0x0055, 0x0008));
-	__( 2972,    GetParam (dev, 0x0014));
-	__( 2974,    GetParam (dev, 0x0011));
-	__( 2976,    SetParam (dev, 0x0062, 0x0032));
-	__( 2978,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__( 2981,    GetParam (dev, 0x0014));
-	__( 2983,    GetParam (dev, 0x0014));
-	__( 2985,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 2988,    GetParam (dev, 0x0011));
-	__( 2990,    SetParam (dev, 0x0062, 0x0032));
-	__( 2992,    GetPrint (dev, 0x1388, type_1));
-	__( 2994,    GetFingerState (dev));
-	__( 2996,    GetFingerState (dev));
-	__( 2998,    GetFingerState (dev));
-	__( 3000,    GetFingerState (dev));
-	__( 3002,    GetFingerState (dev));
-	__( 3004,    GetFingerState (dev));
-	__( 3006,    GetFingerState (dev));
-	__( 3008,    GetFingerState (dev));
-	__( 3010,    GetFingerState (dev));
-	__( 3012,    GetFingerState (dev));
-	__( 3014,    GetFingerState (dev));
-	__( 3016,    GetFingerState (dev));
-	__( 3018,    GetFingerState (dev));
-	__( 3020,    GetFingerState (dev));
-	__( 3022,    GetFingerState (dev));
-	__( 3024,    GetFingerState (dev));
-	__( 3026,    GetFingerState (dev));
-	__( 3028,    GetFingerState (dev));
-	__( 3030,    GetFingerState (dev));
-	__( 3032,    GetFingerState (dev));
-	__( 3034,    GetFingerState (dev));
-	__( 3036,    GetFingerState (dev));
-	__( 3038,    GetFingerState (dev));
-	__( 3040,    GetFingerState (dev));
-	__( 3042,    GetFingerState (dev));
-	__( 3044,    GetFingerState (dev));
-	__( 3046,    GetFingerState (dev));
-	__( 3048,    GetFingerState (dev));
-	__( 3050,    GetFingerState (dev));
-	__( 3052,    GetFingerState (dev));
-	__( 3054,    GetFingerState (dev));
-	__( 3056,    GetFingerState (dev));
-	__( 3058,    GetFingerState (dev));
-	__( 3060,    GetFingerState (dev));
-	__( 3062,    GetFingerState (dev));
-	__( 3064,    GetFingerState (dev));
-	__( 3066,    GetFingerState (dev));
-	__( 3068,    GetFingerState (dev));
-	__( 3070,    GetFingerState (dev));
-	__( 3072,    GetFingerState (dev));
-	__( 3074,    GetFingerState (dev));
-	__( 3076,    GetFingerState (dev));
-	__( 3078,    GetFingerState (dev));
-	__( 3080,    GetFingerState (dev));
-	__( 3082,    GetFingerState (dev));
-	__( 3084,    GetFingerState (dev));
-	__( 3086,    GetFingerState (dev));
-	__( 3088,    GetFingerState (dev));
-	__( 3090,    GetFingerState (dev));
-	__( 3092,    GetFingerState (dev));
-	__( 3094,    GetFingerState (dev));
-	__( 3096,    GetFingerState (dev));
-	__( 3098,    GetFingerState (dev));
-	__( 3100,    GetFingerState (dev));
-	__( 3102,    GetFingerState (dev));
-	__( 3104,    GetFingerState (dev));
-	__( 3106,    GetFingerState (dev));
-	__( 3108,    GetFingerState (dev));
-	__( 3110,    GetFingerState (dev));
-	__( 3112,    GetFingerState (dev));
-	__( 3114,    GetFingerState (dev));
-	__( 3116,    GetFingerState (dev));
-	__( 3118,    GetFingerState (dev));
-	__( 3120,    GetFingerState (dev));
-	__( 3122,    GetFingerState (dev));
-	__( 3124,    GetFingerState (dev));
-	__( 3126,    GetFingerState (dev));
-	__( 3128,    GetFingerState (dev));
-	__( 3130,    GetFingerState (dev));
-	__( 3132,    GetFingerState (dev));
-	__( 3134,    GetFingerState (dev));
-	__( 3136,    GetFingerState (dev));
-	__( 3138,    GetFingerState (dev));
-	__( 3140,    GetFingerState (dev));
-	__( 3142,    GetFingerState (dev));
-	__( 3144,    GetFingerState (dev));
-	__( 3146,    GetFingerState (dev));
-	__( 3148,    GetFingerState (dev));
-	__( 3150,    GetFingerState (dev));
-	__( 3152,    GetFingerState (dev));
-	__( 3154,    GetFingerState (dev));
-	__( 3156,    GetFingerState (dev));
-	__( 3158,    GetFingerState (dev));
-	__( 3160,    GetFingerState (dev));
-	__( 3162,    GetFingerState (dev));
-	__( 3164,    GetFingerState (dev));
-	__( 3166,    GetFingerState (dev));
-	__( 3168,    GetFingerState (dev));
-	__( 3170,    GetFingerState (dev));
-	__( 3172,    GetFingerState (dev));
-	__( 3174,    GetFingerState (dev));
-	__( 3176,    GetFingerState (dev));
-	__( 3178,    GetFingerState (dev));
-	__( 3180,    GetFingerState (dev));
-	__( 3182,    GetFingerState (dev));
-	__( 3184,    GetFingerState (dev));
-	__( 3186,    GetFingerState (dev));
-	__( 3188,    GetFingerState (dev));
-	__( 3190,    GetFingerState (dev));
-	__( 3192,    GetFingerState (dev));
-	__( 3194,    GetFingerState (dev));
-	__( 3196,    GetFingerState (dev));
-	__( 3198,    GetFingerState (dev));
-	__( 3200,    GetFingerState (dev));
-	__( 3202,    GetFingerState (dev));
-	__( 3204,    GetFingerState (dev));
-	__( 3206,    GetFingerState (dev));
-	__( 3208,    GetFingerState (dev));
-	__( 3210,    GetFingerState (dev));
-	__( 3212,    GetFingerState (dev));
-	__( 3214,    GetFingerState (dev));
-	__( 3216,    GetFingerState (dev));
-	__( 3218,    GetFingerState (dev));
-	__( 3220,    GetFingerState (dev));
-	__( 3222,    GetFingerState (dev));
-	__( 3224,    GetFingerState (dev));
-	__( 3226,    GetFingerState (dev));
-	__( 3228,    GetFingerState (dev));
-	__( 3230,    GetFingerState (dev));
-	__( 3232,    GetFingerState (dev));
-	__( 3234,    GetFingerState (dev));
-	__( 3236,    GetFingerState (dev));
-	__( 3238,    GetFingerState (dev));
-	__( 3240,    GetFingerState (dev));
-	__( 3242,    GetFingerState (dev));
-	__( 3244,    GetFingerState (dev));
-	__( 3246,    GetFingerState (dev));
-	__( 3248,    GetFingerState (dev));
-	__( 3250,    GetFingerState (dev));
-	__( 3252,    GetFingerState (dev));
-	__( 3254,    GetFingerState (dev));
-	__( 3256,    GetFingerState (dev));
-	__( 3258,    GetFingerState (dev));
-	__( 3260,    GetFingerState (dev));
-	__( 3262,    GetFingerState (dev));
-	__( 3264,    GetFingerState (dev));
-	__( 3266,    GetFingerState (dev));
-	__( 3268,    GetFingerState (dev));
-	__( 3270,    GetFingerState (dev));
-	__( 3272,    GetFingerState (dev));
-	__( 3274,    GetFingerState (dev));
-	__( 3276,    GetFingerState (dev));
-	__( 3278,    GetFingerState (dev));
-	__( 3280,    GetFingerState (dev));
-	__( 3282,    GetFingerState (dev));
-	__( 3284,    GetFingerState (dev));
-	__( 3286,    GetFingerState (dev));
-	__( 3288,    GetFingerState (dev));
-	__( 3290,    GetFingerState (dev));
-	__( 3292,    GetFingerState (dev));
-	__( 3294,    GetFingerState (dev));
-	__( 3296,    GetFingerState (dev));
-	__( 3298,    GetFingerState (dev));
-	__( 3300,    GetFingerState (dev));
-	__( 3302,    GetFingerState (dev));
-	__( 3304,    GetFingerState (dev));
-	__( 3306,    GetFingerState (dev));
-	__( 3308,    GetFingerState (dev));
-	__( 3310,    GetFingerState (dev));
-	__( 3312,    GetFingerState (dev));
-	__( 3314,    GetFingerState (dev));
-	__( 3316,    GetFingerState (dev));
-	__( 3318,    GetFingerState (dev));
-	__( 3320,    GetFingerState (dev));
-	__( 3322,    GetFingerState (dev));
-	__( 3324,    GetFingerState (dev));
-	__( 3326,    GetFingerState (dev));
-	__( 3328,    GetFingerState (dev));
-	__( 3330,    GetFingerState (dev));
-	__( 3332,    GetFingerState (dev));
-	__( 3334,    GetFingerState (dev));
-	__( 3336,    GetFingerState (dev));
-	__( 3338,    GetFingerState (dev));
-	__( 3340,    GetFingerState (dev));
-	__( 3342,    GetFingerState (dev));
-	__( 3344,    GetFingerState (dev));
-	__( 3346,    GetFingerState (dev));
-	__( 3348,    GetFingerState (dev));
-	__( 3350,    GetFingerState (dev));
-	__( 3352,    GetFingerState (dev));
-	__( 3354,    GetFingerState (dev));
-	__( 3356,    GetFingerState (dev));
-	__( 3358,    GetFingerState (dev));
-	__( 3360,    GetFingerState (dev));
-	__( 3362,    GetFingerState (dev));
-	__( 3364,    GetFingerState (dev));
-	__( 3366,    GetFingerState (dev));
-	__( 3368,    GetFingerState (dev));
-	__( 3370,    GetFingerState (dev));
-	__( 3372,    GetFingerState (dev));
-	__( 3374,    GetFingerState (dev));
-	__( 3376,    GetFingerState (dev));
-	__( 3418,    GetFingerState (dev));
-	__( 3420,    GetFingerState (dev));
-	__( 3422,    GetFingerState (dev));
-	__( 3424,    GetFingerState (dev));
-	__( 3426,    GetFingerState (dev));
-	__( 3428,    GetFingerState (dev));
-	__( 3430,    GetFingerState (dev));
-	__( 3432,    GetFingerState (dev));
-	__( 3434,    GetFingerState (dev));
-	__( 3436,    GetFingerState (dev));
-	__( 3438,    GetFingerState (dev));
-	__( 3440,    GetFingerState (dev));
-	__( 3442,    GetFingerState (dev));
-	__( 3444,    GetFingerState (dev));
-	__( 3446,    GetFingerState (dev));
-	__( 3448,    GetFingerState (dev));
-	__( 3450,    GetFingerState (dev));
-	__( 3452,    GetFingerState (dev));
-	__( 3454,    GetFingerState (dev));
-	__( 3456,    GetFingerState (dev));
-	__( 3458,    GetFingerState (dev));
-	__( 3460,    GetFingerState (dev));
-	__( 3462,    GetFingerState (dev));
-	__( 3464,    GetFingerState (dev));
-	__( 3466,    GetFingerState (dev));
-	__( 3468,    GetFingerState (dev));
-	__( 3470,    GetFingerState (dev));
-	__( 3472,    GetFingerState (dev));
-	__( 3474,    GetFingerState (dev));
-	__( 3476,    GetFingerState (dev));
-	__( 3478,    GetFingerState (dev));
-	__( 3480,    GetFingerState (dev));
-	__( 3482,    GetFingerState (dev));
-	__( 3484,    GetFingerState (dev));
-	__( 3486,    GetFingerState (dev));
-	__( 3488,    GetFingerState (dev));
-	__( 3490,    GetFingerState (dev));
-	__( 3492,    GetFingerState (dev));
-	__( 3494,    GetFingerState (dev));
-	__( 3496,    GetFingerState (dev));
-	__( 3498,    GetFingerState (dev));
-	__( 3500,    GetFingerState (dev));
-	__( 3502,    GetFingerState (dev));
-	__( 3504,    GetFingerState (dev));
-	__( 3506,    GetFingerState (dev));
-	__( 3508,    GetFingerState (dev));
-	__( 3510,    GetFingerState (dev));
-	__( 3512,    GetFingerState (dev));
-	__( 3514,    GetFingerState (dev));
-	__( 3516,    GetFingerState (dev));
-	__( 3518,    GetFingerState (dev));
-	__( 3520,    GetFingerState (dev));
-	__( 3522,    GetFingerState (dev));
-	__( 3524,    GetFingerState (dev));
-	__( 3526,    GetFingerState (dev));
-	__( 3528,    GetFingerState (dev));
-	__( 3530,    GetFingerState (dev));
-	__( 3532,    GetFingerState (dev));
-	__( 3534,    GetFingerState (dev));
-	__( 3536,    GetFingerState (dev));
-	__( 3538,    GetFingerState (dev));
-	__( 3540,    GetFingerState (dev));
-	__( 3542,    GetFingerState (dev));
-	__( 3544,    GetFingerState (dev));
-	__( 3546,    GetFingerState (dev));
-	__( 3548,    GetFingerState (dev));
-	__( 3550,    GetFingerState (dev));
-	__( 3552,    GetFingerState (dev));
-	__( 3554,    GetFingerState (dev));
-	__( 3556,    GetFingerState (dev));
-	__( 3558,    GetFingerState (dev));
-	__( 3560,    GetFingerState (dev));
-	__( 3562,    GetFingerState (dev));
-	__( 3564,    GetFingerState (dev));
-	__( 3566,    GetFingerState (dev));
-	__( 3568,    GetFingerState (dev));
-	__( 3570,    GetFingerState (dev));
-	__( 3572,    GetFingerState (dev));
-	__( 3574,    GetFingerState (dev));
-	__( 3576,    GetFingerState (dev));
-	__( 3578,    GetFingerState (dev));
-	__( 3580,    GetFingerState (dev));
-	__( 3582,    GetFingerState (dev));
-	__( 3584,    GetFingerState (dev));
-	__( 3586,    GetFingerState (dev));
-	__( 3588,    GetFingerState (dev));
-	__( 3590,    GetFingerState (dev));
-	__( 3592,    GetFingerState (dev));
-	__( 3594,    GetFingerState (dev));
-	__( 3596,    GetFingerState (dev));
-	__( 3598,    GetFingerState (dev));
-	__( 3600,    GetFingerState (dev));
-	__( 3602,    GetFingerState (dev));
-	__( 3604,    GetFingerState (dev));
-	__( 3606,    GetFingerState (dev));
-	__( 3608,    GetFingerState (dev));
-	__( 3610,    GetFingerState (dev));
-	__( 3612,    GetFingerState (dev));
-	__( 3614,    GetFingerState (dev));
-	__( 3616,    GetFingerState (dev));
-	__( 3618,    GetFingerState (dev));
-	__( 3620,    GetFingerState (dev));
-	__( 3622,    GetFingerState (dev));
-	__( 3624,    GetFingerState (dev));
-	__( 3626,    GetFingerState (dev));
-	__( 3628,    GetFingerState (dev));
-	__( 3630,    GetFingerState (dev));
-	__( 3632,    GetFingerState (dev));
-	__( 3634,    GetFingerState (dev));
-	__( 3636,    GetFingerState (dev));
-	__( 3638,    GetFingerState (dev));
-	__( 3640,    GetFingerState (dev));
-	__( 3642,    GetFingerState (dev));
-	__( 3644,    GetFingerState (dev));
-	__( 3646,    GetFingerState (dev));
-	__( 3648,    GetFingerState (dev));
-	__( 3650,    GetFingerState (dev));
-	__( 3652,    GetFingerState (dev));
-	__( 3654,    GetFingerState (dev));
-	__( 3656,    GetFingerState (dev));
-	__( 3658,    GetFingerState (dev));
-	__( 3660,    GetFingerState (dev));
-	__( 3662,    GetFingerState (dev));
-	__( 3664,    GetFingerState (dev));
-	__( 3666,    GetFingerState (dev));
-	__( 3668,    GetFingerState (dev));
-	__( 3670,    GetFingerState (dev));
-	__( 3672,    GetFingerState (dev));
-	__( 3674,    GetFingerState (dev));
-	__( 3676,    GetFingerState (dev));
-	__( 3678,    GetFingerState (dev));
-	__( 3680,    GetFingerState (dev));
-	__( 3682,    GetFingerState (dev));
-	__( 3684,    GetFingerState (dev));
-	__( 3686,    GetFingerState (dev));
-	__( 3688,    GetFingerState (dev));
-	__( 3690,    GetFingerState (dev));
-	__( 3692,    GetFingerState (dev));
-	__( 3694,    GetFingerState (dev));
-	__( 3696,    GetFingerState (dev));
-	__( 3698,    GetFingerState (dev));
-	__( 3700,    GetFingerState (dev));
-	__( 3702,    GetFingerState (dev));
-	__( 3704,    GetFingerState (dev));
-	__( 3706,    GetFingerState (dev));
-	__( 3708,    GetFingerState (dev));
-	__( 3710,    GetFingerState (dev));
-	__( 3712,    GetFingerState (dev));
-	__( 3714,    GetFingerState (dev));
-	__( 3716,    GetFingerState (dev));
-	__( 3718,    GetFingerState (dev));
-	__( 3720,    GetFingerState (dev));
-	__( 3722,    GetFingerState (dev));
-	__( 3724,    GetFingerState (dev));
-	__( 3726,    GetFingerState (dev));
-	__( 3728,    GetFingerState (dev));
-	__( 3730,    GetFingerState (dev));
-	__( 3732,    GetFingerState (dev));
-	__( 3734,    GetFingerState (dev));
-	__( 3736,    GetFingerState (dev));
-	__( 3738,    GetFingerState (dev));
-	__( 3740,    GetFingerState (dev));
-	__( 3742,    GetFingerState (dev));
-	__( 3744,    GetFingerState (dev));
-	__( 3746,    GetFingerState (dev));
-	__( 3748,    GetFingerState (dev));
-	__( 3750,    GetFingerState (dev));
-	__( 3752,    GetFingerState (dev));
-	__( 3754,    GetFingerState (dev));
-	__( 3756,    GetFingerState (dev));
-	__( 3758,    GetFingerState (dev));
-	__( 3760,    GetFingerState (dev));
-	__( 3762,    GetFingerState (dev));
-	__( 3764,    GetFingerState (dev));
-	__( 3766,    GetFingerState (dev));
-	__( 3768,    GetFingerState (dev));
-	__( 3770,    GetFingerState (dev));
-	__( 3772,    GetFingerState (dev));
-	__( 3774,    GetFingerState (dev));
-	__( 3776,    GetFingerState (dev));
-	__( 3778,    GetFingerState (dev));
-	__( 3780,    GetFingerState (dev));
-	__( 3782,    GetFingerState (dev));
-	__( 3784,    GetFingerState (dev));
-	__( 3786,    GetFingerState (dev));
-	__( 3788,    GetFingerState (dev));
-	__( 3790,    GetFingerState (dev));
-	__( 3792,    GetFingerState (dev));
-	__( 3794,    GetFingerState (dev));
-	__( 3796,    GetFingerState (dev));
-	__( 3798,    GetFingerState (dev));
-	__( 3800,    GetFingerState (dev));
-	__( 3802,    GetFingerState (dev));
-	__( 3804,    GetFingerState (dev));
-	__( 3806,    GetFingerState (dev));
-	__( 3808,    GetFingerState (dev));
-	__( 3810,    GetFingerState (dev));
-	__( 3812,    GetFingerState (dev));
-	__( 3814,    GetFingerState (dev));
-	__( 3816,    GetFingerState (dev));
-	__( 3818,    GetFingerState (dev));
-	__( 3820,    GetFingerState (dev));
-	__( 3822,    GetFingerState (dev));
-	__( 3824,    GetFingerState (dev));
-	__( 3826,    GetFingerState (dev));
-	__( 3828,    GetFingerState (dev));
-	__( 3830,    GetFingerState (dev));
-	__( 3832,    GetFingerState (dev));
-	__( 3834,    GetFingerState (dev));
-	__( 3836,    GetFingerState (dev));
-	__( 3838,    GetFingerState (dev));
-	__( 3840,    GetFingerState (dev));
-	__( 3842,    GetFingerState (dev));
-	__( 3844,    GetFingerState (dev));
-	__( 3846,    GetFingerState (dev));
-	__( 3848,    GetFingerState (dev));
-	__( 3850,    GetFingerState (dev));
-	__( 3852,    GetFingerState (dev));
-	__( 3854,    GetFingerState (dev));
-	__( 3856,    GetFingerState (dev));
-	__( 3858,    GetFingerState (dev));
-	__( 3860,    GetFingerState (dev));
-	__( 3862,    GetFingerState (dev));
-	__( 3864,    GetFingerState (dev));
-	__( 3866,    GetFingerState (dev));
-	__( 3868,    GetFingerState (dev));
-	__( 3870,    GetFingerState (dev));
-	__( 3872,    GetFingerState (dev));
-	__( 3874,    GetFingerState (dev));
-	__( 3876,    GetFingerState (dev));
-	__( 3878,    GetFingerState (dev));
-	__( 3880,    GetFingerState (dev));
-	__( 3882,    GetFingerState (dev));
-	__( 3884,    GetFingerState (dev));
-	__( 3886,    GetFingerState (dev));
-	__( 3888,    GetFingerState (dev));
-	__( 3890,    GetFingerState (dev));
-	__( 3892,    GetFingerState (dev));
-	__( 3894,    GetFingerState (dev));
-	__( 3896,    GetFingerState (dev));
-	__( 3898,    GetFingerState (dev));
-	__( 3900,    GetFingerState (dev));
-	__( 3902,    GetFingerState (dev));
-	__( 3904,    GetFingerState (dev));
-	__( 3906,    GetFingerState (dev));
-	__( 3908,    GetFingerState (dev));
-	__( 3910,    GetFingerState (dev));
-	__( 3912,    GetFingerState (dev));
-	__( 3914,    GetFingerState (dev));
-	__( 3916,    GetFingerState (dev));
-	__( 3918,    GetFingerState (dev));
-	__( 3920,    GetFingerState (dev));
-	__( 3922,    GetFingerState (dev));
-	__( 3924,    GetFingerState (dev));
-	__( 3926,    GetFingerState (dev));
-	__( 3928,    GetFingerState (dev));
-	__( 3930,    GetFingerState (dev));
-	__( 3932,    GetFingerState (dev));
-	__( 3934,    GetFingerState (dev));
-	__( 3936,    GetFingerState (dev));
-	__( 3938,    GetFingerState (dev));
-	__( 3940,    GetFingerState (dev));
-	__( 3942,    GetFingerState (dev));
-	__( 3944,    GetFingerState (dev));
-	__( 3946,    GetFingerState (dev));
-	__( 3948,    GetFingerState (dev));
-	__( 3950,    GetFingerState (dev));
-	__( 3952,    GetFingerState (dev));
-	__( 3954,    GetFingerState (dev));
-	__( 3956,    GetFingerState (dev));
-	 _(          LoadImage (dev));
-	__( 3960,    GetParam (dev, 0x0014));
-	__( 3962,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 3965,    GetParam (dev, 0x0011));
-	__( 3967,    SetParam (dev, 0x0062, 0x0032));
-	__( 3969,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__( 3972,    GetConfig (dev));
-	__( 3974,    GetParam (dev, 0x002e));
-	__( 3976,    GetVersion (dev));
-	__( 3978,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 3981,    SetParam (dev, 0x0055, 0x0008));
-	__( 3983,    SetParam (dev, 0x0055, 0x0008));
-	__( 3985,    SetParam (dev, 0x0055, 0x0008));
-	__( 3987,    GetParam (dev, 0x0014));
-	__( 3989,    GetParam (dev, 0x0011));
-	__( 3991,    SetParam (dev, 0x0062, 0x0032));
-	__( 3993,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__( 3996,    GetParam (dev, 0x0014));
-	__( 3998,    GetParam (dev, 0x0014));
-	__( 4000,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 4003,    GetParam (dev, 0x0011));
-	__( 4005,    SetParam (dev, 0x0062, 0x0032));
-	__( 4007,    GetPrint (dev, 0x1388, type_1));
-	__( 4009,    GetFingerState (dev));
-	__( 4011,    GetFingerState (dev));
-	__( 4013,    GetFingerState (dev));
-	__( 4015,    GetFingerState (dev));
-	__( 4017,    GetFingerState (dev));
-	__( 4019,    GetFingerState (dev));
-	__( 4021,    GetFingerState (dev));
-	__( 4023,    GetFingerState (dev));
-	__( 4025,    GetFingerState (dev));
-	__( 4027,    GetFingerState (dev));
-	__( 4029,    GetFingerState (dev));
-	__( 4031,    GetFingerState (dev));
-	__( 4033,    GetFingerState (dev));
-	__( 4035,    GetFingerState (dev));
-	__( 4037,    GetFingerState (dev));
-	__( 4039,    GetFingerState (dev));
-	__( 4041,    GetFingerState (dev));
-	__( 4043,    GetFingerState (dev));
-	__( 4045,    GetFingerState (dev));
-	__( 4047,    GetFingerState (dev));
-	__( 4049,    GetFingerState (dev));
-	__( 4051,    GetFingerState (dev));
-	__( 4053,    GetFingerState (dev));
-	__( 4055,    GetFingerState (dev));
-	__( 4057,    GetFingerState (dev));
-	__( 4059,    GetFingerState (dev));
-	__( 4061,    GetFingerState (dev));
-	__( 4063,    GetFingerState (dev));
-	__( 4065,    GetFingerState (dev));
-	__( 4067,    GetFingerState (dev));
-	__( 4069,    GetFingerState (dev));
-	__( 4071,    GetFingerState (dev));
-	__( 4073,    GetFingerState (dev));
-	__( 4075,    GetFingerState (dev));
-	__( 4077,    GetFingerState (dev));
-	__( 4079,    GetFingerState (dev));
-	__( 4081,    GetFingerState (dev));
-	__( 4083,    GetFingerState (dev));
-	__( 4085,    GetFingerState (dev));
-	__( 4087,    GetFingerState (dev));
-	__( 4089,    GetFingerState (dev));
-	__( 4091,    GetFingerState (dev));
-	__( 4093,    GetFingerState (dev));
-	__( 4095,    GetFingerState (dev));
-	__( 4097,    GetFingerState (dev));
-	__( 4099,    GetFingerState (dev));
-	__( 4101,    GetFingerState (dev));
-	__( 4103,    GetFingerState (dev));
-	__( 4105,    GetFingerState (dev));
-	__( 4107,    GetFingerState (dev));
-	__( 4109,    GetFingerState (dev));
-	__( 4111,    GetFingerState (dev));
-	__( 4113,    GetFingerState (dev));
-	__( 4115,    GetFingerState (dev));
-	__( 4117,    GetFingerState (dev));
-	__( 4119,    GetFingerState (dev));
-	__( 4121,    GetFingerState (dev));
-	__( 4123,    GetFingerState (dev));
-	__( 4125,    GetFingerState (dev));
-	__( 4127,    GetFingerState (dev));
-	__( 4129,    GetFingerState (dev));
-	__( 4131,    GetFingerState (dev));
-	__( 4133,    GetFingerState (dev));
-	__( 4135,    GetFingerState (dev));
-	__( 4137,    GetFingerState (dev));
-	__( 4139,    GetFingerState (dev));
-	__( 4141,    GetFingerState (dev));
-	__( 4143,    GetFingerState (dev));
-	__( 4145,    GetFingerState (dev));
-	__( 4147,    GetFingerState (dev));
-	__( 4149,    GetFingerState (dev));
-	__( 4151,    GetFingerState (dev));
-	__( 4153,    GetFingerState (dev));
-	__( 4155,    GetFingerState (dev));
-	__( 4157,    GetFingerState (dev));
-	__( 4159,    GetFingerState (dev));
-	__( 4161,    GetFingerState (dev));
-	__( 4163,    GetFingerState (dev));
-	__( 4165,    GetFingerState (dev));
-	__( 4167,    GetFingerState (dev));
-	__( 4169,    GetFingerState (dev));
-	__( 4171,    GetFingerState (dev));
-	__( 4173,    GetFingerState (dev));
-	__( 4175,    GetFingerState (dev));
-	__( 4177,    GetFingerState (dev));
-	__( 4179,    GetFingerState (dev));
-	__( 4181,    GetFingerState (dev));
-	__( 4183,    GetFingerState (dev));
-	__( 4185,    GetFingerState (dev));
-	__( 4187,    GetFingerState (dev));
-	__( 4189,    GetFingerState (dev));
-	__( 4191,    GetFingerState (dev));
-	__( 4193,    GetFingerState (dev));
-	__( 4195,    GetFingerState (dev));
-	__( 4197,    GetFingerState (dev));
-	__( 4199,    GetFingerState (dev));
-	__( 4201,    GetFingerState (dev));
-	__( 4203,    GetFingerState (dev));
-	__( 4205,    GetFingerState (dev));
-	__( 4207,    GetFingerState (dev));
-	__( 4209,    GetFingerState (dev));
-	__( 4211,    GetFingerState (dev));
-	__( 4213,    GetFingerState (dev));
-	__( 4215,    GetFingerState (dev));
-	__( 4217,    GetFingerState (dev));
-	__( 4219,    GetFingerState (dev));
-	__( 4221,    GetFingerState (dev));
-	__( 4223,    GetFingerState (dev));
-	__( 4225,    GetFingerState (dev));
-	__( 4227,    GetFingerState (dev));
-	__( 4229,    GetFingerState (dev));
-	__( 4231,    GetFingerState (dev));
-	__( 4233,    GetFingerState (dev));
-	__( 4235,    GetFingerState (dev));
-	__( 4237,    GetFingerState (dev));
-	__( 4239,    GetFingerState (dev));
-	__( 4241,    GetFingerState (dev));
-	__( 4243,    GetFingerState (dev));
-	__( 4245,    GetFingerState (dev));
-	__( 4247,    GetFingerState (dev));
-	__( 4249,    GetFingerState (dev));
-	__( 4251,    GetFingerState (dev));
-	__( 4253,    GetFingerState (dev));
-	__( 4255,    GetFingerState (dev));
-	__( 4257,    GetFingerState (dev));
-	__( 4259,    GetFingerState (dev));
-	__( 4261,    GetFingerState (dev));
-	__( 4263,    GetFingerState (dev));
-	__( 4265,    GetFingerState (dev));
-	__( 4267,    GetFingerState (dev));
-	__( 4269,    GetFingerState (dev));
-	__( 4271,    GetFingerState (dev));
-	__( 4273,    GetFingerState (dev));
-	__( 4275,    GetFingerState (dev));
-	__( 4277,    GetFingerState (dev));
-	__( 4279,    GetFingerState (dev));
-	 _(          LoadImage (dev));
-	__( 4283,    GetParam (dev, 0x0014));
-	__( 4285,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 4288,    GetParam (dev, 0x0011));
-	__( 4290,    SetParam (dev, 0x0062, 0x0032));
-	__( 4292,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__( 4295,    GetConfig (dev));
-	__( 4297,    GetParam (dev, 0x002e));
-	__( 4299,    GetVersion (dev));
-	__( 4301,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 4304,    SetParam (dev, 0x0055, 0x0008));
-	__( 4306,    SetParam (dev, 0x0055, 0x0008));
-	__( 4308,    SetParam (dev, 0x0055, 0x0008));
-	__( 4310,    GetParam (dev, 0x0014));
-	__( 4312,    GetParam (dev, 0x0011));
-	__( 4314,    SetParam (dev, 0x0062, 0x0032));
-	__( 4316,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__( 4319,    GetParam (dev, 0x0014));
-	__( 4321,    GetParam (dev, 0x0014));
-	__( 4323,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 4326,    GetParam (dev, 0x0011));
-	__( 4328,    SetParam (dev, 0x0062, 0x0032));
-	__( 4330,    GetPrint (dev, 0x1388, type_1));
-	__( 4332,    GetFingerState (dev));
-	__( 4334,    GetFingerState (dev));
-	__( 4336,    GetFingerState (dev));
-	__( 4338,    GetFingerState (dev));
-	__( 4340,    GetFingerState (dev));
-	__( 4342,    GetFingerState (dev));
-	__( 4344,    GetFingerState (dev));
-	__( 4346,    GetFingerState (dev));
-	__( 4348,    GetFingerState (dev));
-	__( 4350,    GetFingerState (dev));
-	__( 4352,    GetFingerState (dev));
-	__( 4354,    GetFingerState (dev));
-	__( 4356,    GetFingerState (dev));
-	__( 4358,    GetFingerState (dev));
-	__( 4360,    GetFingerState (dev));
-	__( 4362,    GetFingerState (dev));
-	__( 4364,    GetFingerState (dev));
-	__( 4366,    GetFingerState (dev));
-	__( 4368,    GetFingerState (dev));
-	__( 4370,    GetFingerState (dev));
-	__( 4372,    GetFingerState (dev));
-	__( 4374,    GetFingerState (dev));
-	__( 4376,    GetFingerState (dev));
-	__( 4378,    GetFingerState (dev));
-	__( 4380,    GetFingerState (dev));
-	__( 4382,    GetFingerState (dev));
-	__( 4384,    GetFingerState (dev));
-	__( 4386,    GetFingerState (dev));
-	__( 4388,    GetFingerState (dev));
-	__( 4390,    GetFingerState (dev));
-	__( 4392,    GetFingerState (dev));
-	__( 4394,    GetFingerState (dev));
-	__( 4396,    GetFingerState (dev));
-	__( 4398,    GetFingerState (dev));
-	__( 4400,    GetFingerState (dev));
-	__( 4402,    GetFingerState (dev));
-	__( 4404,    GetFingerState (dev));
-	__( 4406,    GetFingerState (dev));
-	__( 4408,    GetFingerState (dev));
-	__( 4410,    GetFingerState (dev));
-	__( 4412,    GetFingerState (dev));
-	__( 4414,    GetFingerState (dev));
-	__( 4416,    GetFingerState (dev));
-	__( 4418,    GetFingerState (dev));
-	__( 4420,    GetFingerState (dev));
-	__( 4422,    GetFingerState (dev));
-	__( 4424,    GetFingerState (dev));
-	__( 4426,    GetFingerState (dev));
-	__( 4428,    GetFingerState (dev));
-	__( 4430,    GetFingerState (dev));
-	__( 4432,    GetFingerState (dev));
-	__( 4434,    GetFingerState (dev));
-	__( 4436,    GetFingerState (dev));
-	__( 4438,    GetFingerState (dev));
-	__( 4440,    GetFingerState (dev));
-	__( 4442,    GetFingerState (dev));
-	__( 4444,    GetFingerState (dev));
-	__( 4446,    GetFingerState (dev));
-	__( 4448,    GetFingerState (dev));
-	__( 4450,    GetFingerState (dev));
-	__( 4452,    GetFingerState (dev));
-	__( 4454,    GetFingerState (dev));
-	__( 4456,    GetFingerState (dev));
-	__( 4458,    GetFingerState (dev));
-	__( 4460,    GetFingerState (dev));
-	__( 4462,    GetFingerState (dev));
-	__( 4464,    GetFingerState (dev));
-	__( 4466,    GetFingerState (dev));
-	__( 4468,    GetFingerState (dev));
-	__( 4470,    GetFingerState (dev));
-	__( 4472,    GetFingerState (dev));
-	__( 4474,    GetFingerState (dev));
-	__( 4476,    GetFingerState (dev));
-	__( 4478,    GetFingerState (dev));
-	__( 4480,    GetFingerState (dev));
-	__( 4482,    GetFingerState (dev));
-	__( 4484,    GetFingerState (dev));
-	__( 4486,    GetFingerState (dev));
-	__( 4488,    GetFingerState (dev));
-	__( 4490,    GetFingerState (dev));
-	__( 4492,    GetFingerState (dev));
-	__( 4494,    GetFingerState (dev));
-	__( 4496,    GetFingerState (dev));
-	__( 4498,    GetFingerState (dev));
-	__( 4500,    GetFingerState (dev));
-	__( 4502,    GetFingerState (dev));
-	__( 4504,    GetFingerState (dev));
-	__( 4506,    GetFingerState (dev));
-	__( 4508,    GetFingerState (dev));
-	__( 4510,    GetFingerState (dev));
-	__( 4512,    GetFingerState (dev));
-	__( 4514,    GetFingerState (dev));
-	__( 4516,    GetFingerState (dev));
-	__( 4518,    GetFingerState (dev));
-	__( 4520,    GetFingerState (dev));
-	__( 4522,    GetFingerState (dev));
-	__( 4524,    GetFingerState (dev));
-	__( 4526,    GetFingerState (dev));
-	__( 4528,    GetFingerState (dev));
-	__( 4530,    GetFingerState (dev));
-	__( 4532,    GetFingerState (dev));
-	__( 4534,    GetFingerState (dev));
-	__( 4536,    GetFingerState (dev));
-	__( 4538,    GetFingerState (dev));
-	__( 4540,    GetFingerState (dev));
-	__( 4542,    GetFingerState (dev));
-	__( 4544,    GetFingerState (dev));
-	__( 4546,    GetFingerState (dev));
-	__( 4548,    GetFingerState (dev));
-	__( 4550,    GetFingerState (dev));
-	__( 4552,    GetFingerState (dev));
-	__( 4554,    GetFingerState (dev));
-	__( 4556,    GetFingerState (dev));
-	__( 4558,    GetFingerState (dev));
-	__( 4560,    GetFingerState (dev));
-	__( 4562,    GetFingerState (dev));
-	__( 4564,    GetFingerState (dev));
-	__( 4566,    GetFingerState (dev));
-	__( 4568,    GetFingerState (dev));
-	__( 4570,    GetFingerState (dev));
-	__( 4572,    GetFingerState (dev));
-	__( 4574,    GetFingerState (dev));
-	__( 4576,    GetFingerState (dev));
-	__( 4578,    GetFingerState (dev));
-	__( 4580,    GetFingerState (dev));
-	__( 4582,    GetFingerState (dev));
-	__( 4584,    GetFingerState (dev));
-	__( 4586,    GetFingerState (dev));
-	__( 4588,    GetFingerState (dev));
-	__( 4590,    GetFingerState (dev));
-	__( 4592,    GetFingerState (dev));
-	__( 4594,    GetFingerState (dev));
-	__( 4596,    GetFingerState (dev));
-	__( 4598,    GetFingerState (dev));
-	__( 4600,    GetFingerState (dev));
-	__( 4602,    GetFingerState (dev));
-	__( 4604,    GetFingerState (dev));
-	__( 4606,    GetFingerState (dev));
-	__( 4608,    GetFingerState (dev));
-	__( 4610,    GetFingerState (dev));
-	__( 4612,    GetFingerState (dev));
-	__( 4614,    GetFingerState (dev));
-	__( 4616,    GetFingerState (dev));
-	__( 4618,    GetFingerState (dev));
-	__( 4620,    GetFingerState (dev));
-	__( 4622,    GetFingerState (dev));
-	__( 4624,    GetFingerState (dev));
-	__( 4626,    GetFingerState (dev));
-	__( 4628,    GetFingerState (dev));
-	__( 4630,    GetFingerState (dev));
-	__( 4632,    GetFingerState (dev));
-	__( 4634,    GetFingerState (dev));
-	__( 4636,    GetFingerState (dev));
-	__( 4638,    GetFingerState (dev));
-	__( 4640,    GetFingerState (dev));
-	__( 4642,    GetFingerState (dev));
-	__( 4714,    GetFingerState (dev));
-	__( 4716,    GetFingerState (dev));
-	__( 4718,    GetFingerState (dev));
-	__( 4720,    GetFingerState (dev));
-	__( 4722,    GetFingerState (dev));
-	__( 4724,    GetFingerState (dev));
-	__( 4726,    GetFingerState (dev));
-	__( 4728,    GetFingerState (dev));
-	__( 4730,    GetFingerState (dev));
-	__( 4732,    GetFingerState (dev));
-	__( 4734,    GetFingerState (dev));
-	__( 4736,    GetFingerState (dev));
-	__( 4738,    GetFingerState (dev));
-	__( 4740,    GetFingerState (dev));
-	__( 4742,    GetFingerState (dev));
-	__( 4744,    GetFingerState (dev));
-	__( 4746,    GetFingerState (dev));
-	__( 4748,    GetFingerState (dev));
-	__( 4750,    GetFingerState (dev));
-	__( 4752,    GetFingerState (dev));
-	__( 4754,    GetFingerState (dev));
-	__( 4756,    GetFingerState (dev));
-	__( 4758,    GetFingerState (dev));
-	__( 4760,    GetFingerState (dev));
-	__( 4762,    GetFingerState (dev));
-	__( 4764,    GetFingerState (dev));
-	__( 4766,    GetFingerState (dev));
-	__( 4768,    GetFingerState (dev));
-	__( 4770,    GetFingerState (dev));
-	__( 4772,    GetFingerState (dev));
-	__( 4774,    GetFingerState (dev));
-	__( 4776,    GetFingerState (dev));
-	__( 4778,    GetFingerState (dev));
-	__( 4780,    GetFingerState (dev));
-	__( 4782,    GetFingerState (dev));
-	__( 4784,    GetFingerState (dev));
-	__( 4786,    GetFingerState (dev));
-	__( 4788,    GetFingerState (dev));
-	__( 4790,    GetFingerState (dev));
-	__( 4792,    GetFingerState (dev));
-	__( 4794,    GetFingerState (dev));
-	__( 4796,    GetFingerState (dev));
-	__( 4798,    GetFingerState (dev));
-	__( 4800,    GetFingerState (dev));
-	__( 4802,    GetFingerState (dev));
-	__( 4804,    GetFingerState (dev));
-	__( 4806,    GetFingerState (dev));
-	__( 4808,    GetFingerState (dev));
-	__( 4810,    GetFingerState (dev));
-	__( 4812,    GetFingerState (dev));
-	__( 4814,    GetFingerState (dev));
-	__( 4816,    GetFingerState (dev));
-	__( 4818,    GetFingerState (dev));
-	__( 4820,    GetFingerState (dev));
-	__( 4822,    GetFingerState (dev));
-	__( 4824,    GetFingerState (dev));
-	__( 4826,    GetFingerState (dev));
-	__( 4828,    GetFingerState (dev));
-	__( 4830,    GetFingerState (dev));
-	__( 4832,    GetFingerState (dev));
-	__( 4834,    GetFingerState (dev));
-	__( 4836,    GetFingerState (dev));
-	__( 4838,    GetFingerState (dev));
-	__( 4840,    GetFingerState (dev));
-	__( 4842,    GetFingerState (dev));
-	__( 4844,    GetFingerState (dev));
-	__( 4846,    GetFingerState (dev));
-	__( 4848,    GetFingerState (dev));
-	__( 4850,    GetFingerState (dev));
-	__( 4852,    GetFingerState (dev));
-	__( 4854,    GetFingerState (dev));
-	__( 4856,    GetFingerState (dev));
-	__( 4858,    GetFingerState (dev));
-	__( 4860,    GetFingerState (dev));
-	__( 4862,    GetFingerState (dev));
-	__( 4864,    GetFingerState (dev));
-	__( 4866,    GetFingerState (dev));
-	__( 4868,    GetFingerState (dev));
-	__( 4870,    GetFingerState (dev));
-	__( 4872,    GetFingerState (dev));
-	__( 4874,    GetFingerState (dev));
-	__( 4876,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 4879,    SetParam (dev, 0x0055, 0x0008));
-	__( 4881,    SetParam (dev, 0x0055, 0x0008));
-	__( 4883,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 4887,    Peek (dev, 0x00001fe8, 0x04));
-	__( 4889,    Peek (dev, 0x00001fec, 0x04));
-	__( 4891,    Peek (dev, 0x00001ff0, 0x04));
-	__( 4893,    Peek (dev, 0x00001ff4, 0x04));
-	__( 4895,    Peek (dev, 0x00001ff8, 0x04));
-	__( 4897,    Peek (dev, 0x00001ffc, 0x04));
-	__( 4899,    GetParam (dev, 0x002e));
-	__( 4901,    GetVersion (dev));
-	__( 4903,    GetParam (dev, 0x0028));
-	__( 4905,    GetParam (dev, 0x0014));
-	__( 4907,    GetParam (dev, 0x0011));
-	__( 4909,    GetParam (dev, 0x0054));
-	__( 4911,    GetParam (dev, 0x0001));
-	__( 4913,    GetParam (dev, 0x0014));
-	__( 4915,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 4918,    GetPrint (dev, 0x0001, type_0));
-	 _(          LoadImage (dev));
-	__( 4921,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 4924,    SetParam (dev, 0x0004, 0x0000));
-	__( 4926,    SetParam (dev, 0x0005, 0x0000));
-	__( 4928,    SetParam (dev, 0x0006, 0x0000));
-	__( 4930,    SetParam (dev, 0x0007, 0x0000));
-	__( 4932,    SetParam (dev, 0x000a, 0x0002));
-	__( 4934,    SetParam (dev, 0x000b, 0x010b));
-	__( 4936,    SetParam (dev, 0x000c, 0x010c));
-	__( 4938,    SetParam (dev, 0x000d, 0x010d));
-	__( 4940,    SetParam (dev, 0x000e, 0x0001));
-	__( 4942,    SetParam (dev, 0x0010, 0x0000));
-	__( 4944,    SetParam (dev, 0x0012, 0x0040));
-	__( 4946,    SetParam (dev, 0x0015, 0x04b0));
-	__( 4948,    SetParam (dev, 0x0016, 0x001b));
-	__( 4950,    SetParam (dev, 0x0017, 0x0001));
-	__( 4952,    SetParam (dev, 0x0018, 0x0003));
-	__( 4954,    SetParam (dev, 0x0019, 0x0001));
-	__( 4956,    SetParam (dev, 0x001a, 0x0000));
-	__( 4958,    SetParam (dev, 0x001b, 0x0004));
-	__( 4960,    SetParam (dev, 0x001d, 0x010c));
-	__( 4962,    SetParam (dev, 0x001e, 0x010d));
-	__( 4964,    SetParam (dev, 0x001f, 0x0000));
-	__( 4966,    SetParam (dev, 0x0020, 0x0000));
-	__( 4968,    SetParam (dev, 0x0021, 0x0001));
-	__( 4970,    SetParam (dev, 0x0022, 0x0001));
-	__( 4972,    SetParam (dev, 0x0023, 0x0001));
-	__( 4974,    SetParam (dev, 0x0024, 0x0000));
-	__( 4976,    SetParam (dev, 0x002c, 0x0046));
-	__( 4978,    SetParam (dev, 0x002d, 0x002a));
-	__( 4980,    SetParam (dev, 0x002f, 0x010e));
-	__( 4982,    SetParam (dev, 0x0030, 0x010f));
-	__( 4984,    SetParam (dev, 0x0032, 0x0004));
-	__( 4986,    SetParam (dev, 0x0033, 0x0003));
-	__( 4988,    SetParam (dev, 0x0034, 0x0005));
-	__( 4990,    SetParam (dev, 0x0035, 0x0010));
-	__( 4992,    SetParam (dev, 0x0036, 0x000a));
-	__( 4994,    SetParam (dev, 0x0037, 0x0018));
-	__( 4996,    SetParam (dev, 0x0038, 0x001e));
-	__( 4998,    SetParam (dev, 0x0039, 0x00b2));
-	__( 5000,    SetParam (dev, 0x003a, 0x0080));
-	__( 5002,    SetParam (dev, 0x003b, 0x0000));
-	__( 5004,    SetParam (dev, 0x003e, 0x01f4));
-	__( 5006,    SetParam (dev, 0x003f, 0x001a));
-	__( 5008,    SetParam (dev, 0x0040, 0x00f8));
-	__( 5010,    SetParam (dev, 0x0042, 0x0001));
-	__( 5012,    SetParam (dev, 0x0043, 0x0004));
-	__( 5014,    SetParam (dev, 0x0044, 0x0010));
-	__( 5016,    SetParam (dev, 0x0045, 0x0005));
-	__( 5018,    SetParam (dev, 0x0046, 0x00f5));
-	__( 5020,    SetParam (dev, 0x0047, 0x000c));
-	__( 5022,    SetParam (dev, 0x0048, 0x0000));
-	__( 5024,    SetParam (dev, 0x0049, 0x0000));
-	__( 5026,    SetParam (dev, 0x0053, 0x0000));
-	__( 5028,    SetParam (dev, 0x0056, 0x00b4));
-	__( 5030,    SetParam (dev, 0x0057, 0x0096));
-	__( 5032,    SetParam (dev, 0x0058, 0x008c));
-	__( 5034,    SetParam (dev, 0x0059, 0x0064));
-	__( 5036,    SetParam (dev, 0x005b, 0x0001));
-	__( 5038,    SetParam (dev, 0x005c, 0x0001));
-	__( 5040,    SetParam (dev, 0x005d, 0x0020));
-	__( 5042,    SetParam (dev, 0x005e, 0x0064));
-	__( 5044,    SetParam (dev, 0x005f, 0x00c8));
-	__( 5046,    SetParam (dev, 0x0060, 0x00c8));
-	__( 5048,    SetParam (dev, 0x0062, 0x0000));
-	__( 5050,    SetParam (dev, 0x0064, 0x011a));
-	__( 5052,    SetParam (dev, 0x0069, 0x0014));
-	__( 5054,    GetParam (dev, 0x002a));
-	__( 5056,    GetParam (dev, 0x003c));
-	__( 5058,    GetParam (dev, 0x004a));
-	__( 5060,    GetParam (dev, 0x0041));
-	__( 5062,    GetVersion (dev));
-	__( 5064,    SetParam (dev, 0x0063, 0x0001));
-	__( 5066,    SensorSpiTrans (dev, 0x05, 0x00, 0xab, 0x00, 0x00, 0x00, 0x00));
-	__( 5068,    SetParam (dev, 0x0064, 0x0118));
-	__( 5070,    GetConfig (dev));
-	__( 5072,    SetParam (dev, 0x0046, 0x00f5));
-	__( 5074,    SetParam (dev, 0x006d, 0x0032));
-	__( 5076,    SetParam (dev, 0x006e, 0x0003));
-	__( 5078,    GetParam (dev, 0x0052));
-	__( 5080,    SetParam (dev, 0x0052, 0x0320));
-	__( 5082,    GetPrint (dev, 0x0001, type_2));
-	 _(          LoadImage (dev));
-	__( 5085,    SetParam (dev, 0x0052, 0x1eb4));
-	__( 5087,    Peek (dev, 0x00ff502c, 0x02));
-	__( 5089,    Peek (dev, 0x00ff502e, 0x02));
-	__( 5091,    Poke (dev, 0x000005f6, 0x00000001, 0x01));
-	__( 5093,    Peek (dev, 0x00ff503e, 0x01));
-	__( 5095,    Poke (dev, 0x00ff503e, 0x00000000, 0x01));
-	__( 5097,    Peek (dev, 0x00ff9802, 0x01));
-	__( 5099,    Peek (dev, 0x00ff9800, 0x01));
-	__( 5101,    Peek (dev, 0x00ff9806, 0x01));
-	__( 5103,    Poke (dev, 0x00ff9806, 0x00000000, 0x01));
-	__( 5105,    GetPrint (dev, 0x0064, type_0));
-	 _(          LoadImage (dev));
-	__( 5108,    Poke (dev, 0x000005f6, 0x00000000, 0x01));
-	__( 5110,    Peek (dev, 0x00ff503e, 0x01));
-	__( 5112,    Poke (dev, 0x00ff503e, 0x00000010, 0x01));
-	__( 5114,    Peek (dev, 0x00ff9802, 0x01));
-	__( 5116,    Peek (dev, 0x00ff9800, 0x01));
-	__( 5118,    Peek (dev, 0x00ff9806, 0x01));
-	__( 5120,    GetPrint (dev, 0x0064, type_0));
-	 _(          LoadImage (dev));
-	__( 5123,    Peek (dev, 0x00ff5038, 0x01));
-	__( 5125,    Peek (dev, 0x00ff500e, 0x02));
-	__( 5127,    Peek (dev, 0x00ff5032, 0x01));
-	__( 5129,    Poke (dev, 0x00ff5032, 0x00000012, 0x01));
-	__( 5131,    Poke (dev, 0x00ff500e, 0x00004000, 0x02));
-	__( 5133,    Poke (dev, 0x00ff5038, 0x0000000f, 0x01));
-	__( 5135,    SetParam (dev, 0x0062, 0x0000));
-	__( 5137,    SetParam (dev, 0x0077, 0x0000));
-	__( 5139,    SetParam (dev, 0x0076, 0x0000));
-	__( 5141,    SetParam (dev, 0x0078, 0x0000));
-	__( 5143,    GetPrint (dev, 0x0002, type_0));
-	 _(          LoadImage (dev));
-	__( 5146,    Poke (dev, 0x000005f6, 0x00000001, 0x01));
-	__( 5148,    Peek (dev, 0x00ff503e, 0x01));
-	__( 5150,    Poke (dev, 0x00ff503e, 0x00000000, 0x01));
-	__( 5152,    Peek (dev, 0x00ff9802, 0x01));
-	__( 5154,    Peek (dev, 0x00ff9800, 0x01));
-	__( 5156,    Peek (dev, 0x00ff9806, 0x01));
-	__( 5158,    Poke (dev, 0x00ff5038, 0x0000000e, 0x01));
-	__( 5160,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__( 5163,    Poke (dev, 0x00ff5038, 0x0000000d, 0x01));
-	__( 5165,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__( 5168,    Poke (dev, 0x00ff5038, 0x0000000c, 0x01));
-	__( 5170,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__( 5173,    Poke (dev, 0x00ff5038, 0x0000000b, 0x01));
-	__( 5175,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__( 5178,    Poke (dev, 0x00ff5038, 0x0000000a, 0x01));
-	__( 5180,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__( 5183,    Poke (dev, 0x00ff5038, 0x00000009, 0x01));
-	__( 5185,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__( 5188,    Poke (dev, 0x00ff5038, 0x00000008, 0x01));
-	__( 5190,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__( 5193,    Poke (dev, 0x000005f6, 0x00000000, 0x01));
-	__( 5195,    Peek (dev, 0x00ff503e, 0x01));
-	__( 5197,    Poke (dev, 0x00ff503e, 0x00000010, 0x01));
-	__( 5199,    Peek (dev, 0x00ff9802, 0x01));
-	__( 5201,    Peek (dev, 0x00ff9800, 0x01));
-	__( 5203,    Peek (dev, 0x00ff9806, 0x01));
-	__( 5205,    Poke (dev, 0x00ff9806, 0x00000000, 0x01));
-	__( 5207,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__( 5210,    SetParam (dev, 0x0077, 0x0008));
-	__( 5212,    SetParam (dev, 0x0076, 0x0012));
-	__( 5214,    SetParam (dev, 0x0078, 0x21f0));
-	__( 5216,    Poke (dev, 0x00ff5038, 0x00000014, 0x01));
-	__( 5218,    Poke (dev, 0x00ff500e, 0x000021bc, 0x02));
-	__( 5220,    Poke (dev, 0x00ff5032, 0x00000031, 0x01));
-	__( 5222,    SetParam (dev, 0x0062, 0x0032));
-	__( 5224,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 5227,    SetParam (dev, 0x0062, 0x0032));
-	__( 5229,    GetVersion (dev));
-	__( 5231,    SetParam (dev, 0x0055, 0x0008));
-	__( 5233,    GetParam (dev, 0x0014));
-	__( 5235,    GetParam (dev, 0x0011));
-	__( 5237,    SetParam (dev, 0x0062, 0x0032));
-	__( 5239,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__( 5242,    GetParam (dev, 0x0014));
-	__( 5244,    GetParam (dev, 0x0014));
-	__( 5246,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 5249,    GetParam (dev, 0x0011));
-	__( 5251,    SetParam (dev, 0x0062, 0x0032));
-	__( 5253,    GetPrint (dev, 0x1388, type_1));
-	__( 5255,    GetFingerState (dev));
-	__( 5257,    GetFingerState (dev));
-	__( 5259,    GetFingerState (dev));
-	__( 5261,    GetFingerState (dev));
-	__( 5263,    GetFingerState (dev));
-	__( 5265,    GetFingerState (dev));
-	__( 5267,    GetFingerState (dev));
-	__( 5269,    GetFingerState (dev));
-	__( 5271,    GetFingerState (dev));
-	__( 5273,    GetFingerState (dev));
-	__( 5275,    GetFingerState (dev));
-	__( 5277,    GetFingerState (dev));
-	__( 5279,    GetFingerState (dev));
-	__( 5281,    GetFingerState (dev));
-	__( 5283,    GetFingerState (dev));
-	__( 5285,    GetFingerState (dev));
-	__( 5287,    GetFingerState (dev));
-	__( 5289,    GetFingerState (dev));
-	__( 5291,    GetFingerState (dev));
-	__( 5293,    GetFingerState (dev));
-	__( 5295,    GetFingerState (dev));
-	__( 5297,    GetFingerState (dev));
-	__( 5299,    GetFingerState (dev));
-	__( 5301,    GetFingerState (dev));
-	__( 5303,    GetFingerState (dev));
-	__( 5305,    GetFingerState (dev));
-	__( 5307,    GetFingerState (dev));
-	__( 5309,    GetFingerState (dev));
-	__( 5311,    GetFingerState (dev));
-	__( 5313,    GetFingerState (dev));
-	__( 5315,    GetFingerState (dev));
-	__( 5317,    GetFingerState (dev));
-	__( 5319,    GetFingerState (dev));
-	__( 5321,    GetFingerState (dev));
-	__( 5323,    GetFingerState (dev));
-	__( 5325,    GetFingerState (dev));
-	__( 5327,    GetFingerState (dev));
-	__( 5329,    GetFingerState (dev));
-	__( 5331,    GetFingerState (dev));
-	__( 5333,    GetFingerState (dev));
-	__( 5335,    GetFingerState (dev));
-	__( 5337,    GetFingerState (dev));
-	__( 5339,    GetFingerState (dev));
-	__( 5341,    GetFingerState (dev));
-	__( 5343,    GetFingerState (dev));
-	__( 5345,    GetFingerState (dev));
-	__( 5347,    GetFingerState (dev));
-	__( 5349,    GetFingerState (dev));
-	__( 5351,    GetFingerState (dev));
-	__( 5353,    GetFingerState (dev));
-	__( 5355,    GetFingerState (dev));
-	__( 5357,    GetFingerState (dev));
-	__( 5359,    GetFingerState (dev));
-	__( 5361,    GetFingerState (dev));
-	__( 5363,    GetFingerState (dev));
-	__( 5365,    GetFingerState (dev));
-	__( 5367,    GetFingerState (dev));
-	__( 5369,    GetFingerState (dev));
-	__( 5371,    GetFingerState (dev));
-	__( 5373,    GetFingerState (dev));
-	__( 5375,    GetFingerState (dev));
-	__( 5377,    GetFingerState (dev));
-	__( 5379,    GetFingerState (dev));
-	__( 5381,    GetFingerState (dev));
-	__( 5383,    GetFingerState (dev));
-	__( 5385,    GetFingerState (dev));
-	__( 5387,    GetFingerState (dev));
-	__( 5389,    GetFingerState (dev));
-	__( 5391,    GetFingerState (dev));
-	__( 5393,    GetFingerState (dev));
-	__( 5395,    GetFingerState (dev));
-	__( 5397,    GetFingerState (dev));
-	__( 5399,    GetFingerState (dev));
-	__( 5401,    GetFingerState (dev));
-	__( 5403,    GetFingerState (dev));
-	__( 5405,    GetFingerState (dev));
-	__( 5407,    GetFingerState (dev));
-	__( 5409,    GetFingerState (dev));
-	__( 5411,    GetFingerState (dev));
-	__( 5413,    GetFingerState (dev));
-	__( 5415,    GetFingerState (dev));
-	__( 5417,    GetFingerState (dev));
-	__( 5419,    GetFingerState (dev));
-	__( 5421,    GetFingerState (dev));
-	__( 5423,    GetFingerState (dev));
-	__( 5425,    GetFingerState (dev));
-	__( 5427,    GetFingerState (dev));
-	__( 5429,    GetFingerState (dev));
-	__( 5431,    GetFingerState (dev));
-	__( 5433,    GetFingerState (dev));
-	__( 5435,    GetFingerState (dev));
-	__( 5437,    GetFingerState (dev));
-	__( 5439,    GetFingerState (dev));
-	__( 5441,    GetFingerState (dev));
-	__( 5443,    GetFingerState (dev));
-	__( 5445,    GetFingerState (dev));
-	__( 5447,    GetFingerState (dev));
-	__( 5449,    GetFingerState (dev));
-	__( 5451,    GetFingerState (dev));
-	__( 5453,    GetFingerState (dev));
-	__( 5455,    GetFingerState (dev));
-	__( 5457,    GetFingerState (dev));
-	__( 5459,    GetFingerState (dev));
-	__( 5461,    GetFingerState (dev));
-	__( 5463,    GetFingerState (dev));
-	__( 5465,    GetFingerState (dev));
-	__( 5467,    GetFingerState (dev));
-	__( 5469,    GetFingerState (dev));
-	__( 5471,    GetFingerState (dev));
-	__( 5473,    GetFingerState (dev));
-	__( 5475,    GetFingerState (dev));
-	__( 5477,    GetFingerState (dev));
-	__( 5479,    GetFingerState (dev));
-	__( 5481,    GetFingerState (dev));
-	__( 5483,    GetFingerState (dev));
-	__( 5485,    GetFingerState (dev));
-	__( 5487,    GetFingerState (dev));
-	__( 5489,    GetFingerState (dev));
-	__( 5491,    GetFingerState (dev));
-	__( 5493,    GetFingerState (dev));
-	__( 5495,    GetFingerState (dev));
-	__( 5497,    GetFingerState (dev));
-	__( 5499,    GetFingerState (dev));
-	__( 5501,    GetFingerState (dev));
-	__( 5503,    GetFingerState (dev));
-	__( 5505,    GetFingerState (dev));
-	__( 5507,    GetFingerState (dev));
-	__( 5509,    GetFingerState (dev));
-	__( 5511,    GetFingerState (dev));
-	__( 5513,    GetFingerState (dev));
-	__( 5515,    GetFingerState (dev));
-	__( 5517,    GetFingerState (dev));
-	__( 5519,    GetFingerState (dev));
-	__( 5521,    GetFingerState (dev));
-	__( 5523,    GetFingerState (dev));
-	__( 5525,    GetFingerState (dev));
-	__( 5527,    GetFingerState (dev));
-	__( 5529,    GetFingerState (dev));
-	__( 5531,    GetFingerState (dev));
-	__( 5533,    GetFingerState (dev));
-	__( 5535,    GetFingerState (dev));
-	__( 5537,    GetFingerState (dev));
-	__( 5539,    GetFingerState (dev));
-	__( 5541,    GetFingerState (dev));
-	__( 5543,    GetFingerState (dev));
-	__( 5545,    GetFingerState (dev));
-	__( 5547,    GetFingerState (dev));
-	__( 5549,    GetFingerState (dev));
-	__( 5551,    GetFingerState (dev));
-	__( 5553,    GetFingerState (dev));
-	__( 5555,    GetFingerState (dev));
-	__( 5557,    GetFingerState (dev));
-	__( 5559,    GetFingerState (dev));
-	__( 5561,    GetFingerState (dev));
-	__( 5563,    GetFingerState (dev));
-	__( 5565,    GetFingerState (dev));
-	__( 5567,    GetFingerState (dev));
-	__( 5569,    GetFingerState (dev));
-	__( 5571,    GetFingerState (dev));
-	__( 5573,    GetFingerState (dev));
-	__( 5575,    GetFingerState (dev));
-	__( 5577,    GetFingerState (dev));
-	__( 5579,    GetFingerState (dev));
-	__( 5581,    GetFingerState (dev));
-	__( 5583,    GetFingerState (dev));
-	__( 5585,    GetFingerState (dev));
-	__( 5587,    GetFingerState (dev));
-	__( 5589,    GetFingerState (dev));
-	__( 5591,    GetFingerState (dev));
-	__( 5593,    GetFingerState (dev));
-	__( 5595,    GetFingerState (dev));
-	__( 5597,    GetFingerState (dev));
-	__( 5599,    GetFingerState (dev));
-	__( 5601,    GetFingerState (dev));
-	__( 5603,    GetFingerState (dev));
-	__( 5605,    GetFingerState (dev));
-	__( 5607,    GetFingerState (dev));
-	__( 5609,    GetFingerState (dev));
-	__( 5611,    GetFingerState (dev));
-	__( 5613,    GetFingerState (dev));
-	__( 5615,    GetFingerState (dev));
-	__( 5617,    GetFingerState (dev));
-	__( 5619,    GetFingerState (dev));
-	__( 5621,    GetFingerState (dev));
-	__( 5623,    GetFingerState (dev));
-	__( 5625,    GetFingerState (dev));
-	__( 5627,    GetFingerState (dev));
-	__( 5629,    GetFingerState (dev));
-	__( 5631,    GetFingerState (dev));
-	__( 5633,    GetFingerState (dev));
-	__( 5635,    GetFingerState (dev));
-	__( 5637,    GetFingerState (dev));
-	__( 5639,    GetFingerState (dev));
-	__( 5641,    GetFingerState (dev));
-	__( 5643,    GetFingerState (dev));
-	__( 5645,    GetFingerState (dev));
-	__( 5647,    GetFingerState (dev));
-	__( 5649,    GetFingerState (dev));
-	__( 5651,    GetFingerState (dev));
-	__( 5653,    GetFingerState (dev));
-	__( 5655,    GetFingerState (dev));
-	__( 5657,    GetFingerState (dev));
-	__( 5659,    GetFingerState (dev));
-	__( 5661,    GetFingerState (dev));
-	__( 5663,    GetFingerState (dev));
-	__( 5665,    GetFingerState (dev));
-	__( 5667,    GetFingerState (dev));
-	__( 5669,    GetFingerState (dev));
-	__( 5671,    GetFingerState (dev));
-	__( 5673,    GetFingerState (dev));
-	__( 5675,    GetFingerState (dev));
-	__( 5677,    GetFingerState (dev));
-	__( 5679,    GetFingerState (dev));
-	__( 5681,    GetFingerState (dev));
-	__( 5683,    GetFingerState (dev));
-	__( 5685,    GetFingerState (dev));
-	__( 5687,    GetFingerState (dev));
-	__( 5689,    GetFingerState (dev));
-	__( 5691,    GetFingerState (dev));
-	__( 5693,    GetFingerState (dev));
-	__( 5695,    GetFingerState (dev));
-	__( 5697,    GetFingerState (dev));
-	__( 5699,    GetFingerState (dev));
-	__( 5701,    GetFingerState (dev));
-	__( 5703,    GetFingerState (dev));
-	__( 5705,    GetFingerState (dev));
-	__( 5707,    GetFingerState (dev));
-	__( 5709,    GetFingerState (dev));
-	__( 5711,    GetFingerState (dev));
-	__( 5713,    GetFingerState (dev));
-	__( 5715,    GetFingerState (dev));
-	__( 5717,    GetFingerState (dev));
-	__( 5719,    GetFingerState (dev));
-	__( 5721,    GetFingerState (dev));
-	__( 5723,    GetFingerState (dev));
-	__( 5725,    GetFingerState (dev));
-	__( 5727,    GetFingerState (dev));
-	__( 5729,    GetFingerState (dev));
-	__( 5731,    GetFingerState (dev));
-	__( 5733,    GetFingerState (dev));
-	__( 5735,    GetFingerState (dev));
-	__( 5737,    GetFingerState (dev));
-	__( 5739,    GetFingerState (dev));
-	__( 5741,    GetFingerState (dev));
-	__( 5743,    GetFingerState (dev));
-	__( 5745,    GetFingerState (dev));
-	__( 5747,    GetFingerState (dev));
-	__( 5749,    GetFingerState (dev));
-	__( 5751,    GetFingerState (dev));
-	__( 5753,    GetFingerState (dev));
-	__( 5755,    GetFingerState (dev));
-	__( 5757,    GetFingerState (dev));
-	__( 5759,    GetFingerState (dev));
-	__( 5761,    GetFingerState (dev));
-	__( 5763,    GetFingerState (dev));
-	__( 5765,    GetFingerState (dev));
-	__( 5767,    GetFingerState (dev));
-	__( 5769,    GetFingerState (dev));
-	__( 5771,    GetFingerState (dev));
-	__( 5773,    GetFingerState (dev));
-	__( 5775,    GetFingerState (dev));
-	__( 5777,    GetFingerState (dev));
-	__( 5779,    GetFingerState (dev));
-	__( 5781,    GetFingerState (dev));
-	__( 5783,    GetFingerState (dev));
-	__( 5785,    GetFingerState (dev));
-	__( 5787,    GetFingerState (dev));
-	__( 5789,    GetFingerState (dev));
-	__( 5791,    GetFingerState (dev));
-	__( 5793,    GetFingerState (dev));
-	__( 5795,    GetFingerState (dev));
-	__( 5797,    GetFingerState (dev));
-	__( 5799,    GetFingerState (dev));
-	__( 5801,    GetFingerState (dev));
-	__( 5803,    GetFingerState (dev));
-	__( 5805,    GetFingerState (dev));
-	__( 5807,    GetFingerState (dev));
-	__( 5809,    GetFingerState (dev));
-	__( 5811,    GetFingerState (dev));
-	__( 5813,    GetFingerState (dev));
-	__( 5815,    GetFingerState (dev));
-	__( 5817,    GetFingerState (dev));
-	__( 5819,    GetFingerState (dev));
-	__( 5821,    GetFingerState (dev));
-	__( 5823,    GetFingerState (dev));
-	__( 5825,    GetFingerState (dev));
-	__( 5827,    GetFingerState (dev));
-	__( 5829,    GetFingerState (dev));
-	__( 5831,    GetFingerState (dev));
-	__( 5833,    GetFingerState (dev));
-	__( 5835,    GetFingerState (dev));
-	__( 5837,    GetFingerState (dev));
-	__( 5839,    GetFingerState (dev));
-	__( 5841,    GetFingerState (dev));
-	__( 5843,    GetFingerState (dev));
-	__( 5845,    GetFingerState (dev));
-	__( 5847,    GetFingerState (dev));
-	__( 5849,    GetFingerState (dev));
-	__( 5851,    GetFingerState (dev));
-	__( 5853,    GetFingerState (dev));
-	__( 5855,    GetFingerState (dev));
-	__( 5857,    GetFingerState (dev));
-	__( 5859,    GetFingerState (dev));
-	__( 5861,    GetFingerState (dev));
-	__( 5863,    GetFingerState (dev));
-	__( 5865,    GetFingerState (dev));
-	__( 5867,    GetFingerState (dev));
-	__( 5869,    GetFingerState (dev));
-	__( 5871,    GetFingerState (dev));
-	__( 5873,    GetFingerState (dev));
-	__( 5875,    GetFingerState (dev));
-	__( 5877,    GetFingerState (dev));
-	__( 5879,    GetFingerState (dev));
-	__( 5881,    GetFingerState (dev));
-	__( 5883,    GetFingerState (dev));
-	__( 5885,    GetFingerState (dev));
-	__( 5887,    GetFingerState (dev));
-	__( 5889,    GetFingerState (dev));
-	__( 5891,    GetFingerState (dev));
-	__( 5893,    GetFingerState (dev));
-	__( 5895,    GetFingerState (dev));
-	__( 5897,    GetFingerState (dev));
-	__( 5899,    GetFingerState (dev));
-	__( 5901,    GetFingerState (dev));
-	__( 5903,    GetFingerState (dev));
-	__( 5905,    GetFingerState (dev));
-	__( 5907,    GetFingerState (dev));
-	__( 5909,    GetFingerState (dev));
-	__( 5911,    GetFingerState (dev));
-	__( 5913,    GetFingerState (dev));
-	__( 5915,    GetFingerState (dev));
-	__( 5917,    GetFingerState (dev));
-	__( 5919,    GetFingerState (dev));
-	__( 5921,    GetFingerState (dev));
-	__( 5923,    GetFingerState (dev));
-	__( 5925,    GetFingerState (dev));
-	__( 5927,    GetFingerState (dev));
-	__( 5929,    GetFingerState (dev));
-	__( 5931,    GetFingerState (dev));
-	__( 5933,    GetFingerState (dev));
-	__( 5935,    GetFingerState (dev));
-	__( 5937,    GetFingerState (dev));
-	__( 5939,    GetFingerState (dev));
-	__( 5941,    GetFingerState (dev));
-	__( 5943,    GetFingerState (dev));
-	__( 5945,    GetFingerState (dev));
-	__( 5947,    GetFingerState (dev));
-	__( 5949,    GetFingerState (dev));
-	__( 5951,    GetFingerState (dev));
-	__( 5953,    GetFingerState (dev));
-	__( 5955,    GetFingerState (dev));
-	__( 5957,    GetFingerState (dev));
-	__( 5959,    GetFingerState (dev));
-	__( 5961,    GetFingerState (dev));
-	__( 5963,    GetFingerState (dev));
-	__( 5965,    GetFingerState (dev));
-	__( 5967,    GetFingerState (dev));
-	__( 5969,    GetFingerState (dev));
-	__( 5971,    GetFingerState (dev));
-	__( 5973,    GetFingerState (dev));
-	__( 5975,    GetFingerState (dev));
-	__( 5977,    GetFingerState (dev));
-	__( 5979,    GetFingerState (dev));
-	__( 5981,    GetFingerState (dev));
-	__( 5983,    GetFingerState (dev));
-	__( 5985,    GetFingerState (dev));
-	__( 5987,    GetFingerState (dev));
-	__( 5989,    GetFingerState (dev));
-	__( 5991,    GetFingerState (dev));
-	__( 5993,    GetFingerState (dev));
-	__( 5995,    GetFingerState (dev));
-	__( 5997,    GetFingerState (dev));
-	__( 5999,    GetFingerState (dev));
-	__( 6001,    GetFingerState (dev));
-	__( 6003,    GetFingerState (dev));
-	__( 6005,    GetFingerState (dev));
-	__( 6007,    GetFingerState (dev));
-	__( 6009,    GetFingerState (dev));
-	__( 6011,    GetFingerState (dev));
-	__( 6013,    GetFingerState (dev));
-	__( 6015,    GetFingerState (dev));
-	__( 6017,    GetFingerState (dev));
-	__( 6019,    GetFingerState (dev));
-	__( 6021,    GetFingerState (dev));
-	__( 6023,    GetFingerState (dev));
-	__( 6025,    GetFingerState (dev));
-	__( 6027,    GetFingerState (dev));
-	__( 6029,    GetFingerState (dev));
-	__( 6031,    GetFingerState (dev));
-	__( 6033,    GetFingerState (dev));
-	__( 6035,    GetFingerState (dev));
-	__( 6037,    GetFingerState (dev));
-	__( 6039,    GetFingerState (dev));
-	__( 6041,    GetFingerState (dev));
-	__( 6043,    GetFingerState (dev));
-	__( 6045,    GetFingerState (dev));
-	__( 6047,    GetFingerState (dev));
-	__( 6049,    GetFingerState (dev));
-	__( 6051,    GetFingerState (dev));
-	__( 6053,    GetFingerState (dev));
-	__( 6055,    GetFingerState (dev));
-	__( 6057,    GetFingerState (dev));
-	__( 6059,    GetFingerState (dev));
-	__( 6061,    GetFingerState (dev));
-	__( 6063,    GetFingerState (dev));
-	__( 6065,    GetFingerState (dev));
-	__( 6067,    GetFingerState (dev));
-	__( 6069,    GetFingerState (dev));
-	__( 6071,    GetFingerState (dev));
-	__( 6073,    GetFingerState (dev));
-	__( 6075,    GetFingerState (dev));
-	__( 6077,    GetFingerState (dev));
-	__( 6079,    GetFingerState (dev));
-	__( 6081,    GetFingerState (dev));
-	__( 6083,    GetFingerState (dev));
-	__( 6085,    GetFingerState (dev));
-	__( 6087,    GetFingerState (dev));
-	__( 6089,    GetFingerState (dev));
-	__( 6091,    GetFingerState (dev));
-	__( 6093,    GetFingerState (dev));
-	__( 6095,    GetFingerState (dev));
-	__( 6097,    GetFingerState (dev));
-	__( 6099,    GetFingerState (dev));
-	__( 6101,    GetFingerState (dev));
-	__( 6103,    GetFingerState (dev));
-	__( 6105,    GetFingerState (dev));
-	__( 6107,    GetFingerState (dev));
-	__( 6109,    GetFingerState (dev));
-	__( 6111,    GetFingerState (dev));
-	__( 6113,    GetFingerState (dev));
-	__( 6115,    GetFingerState (dev));
-	__( 6117,    GetFingerState (dev));
-	__( 6119,    GetFingerState (dev));
-	__( 6121,    GetFingerState (dev));
-	__( 6123,    GetFingerState (dev));
-	__( 6125,    GetFingerState (dev));
-	__( 6127,    GetFingerState (dev));
-	__( 6129,    GetFingerState (dev));
-	__( 6131,    GetFingerState (dev));
-	__( 6133,    GetFingerState (dev));
-	__( 6135,    GetFingerState (dev));
-	__( 6137,    GetFingerState (dev));
-	__( 6139,    GetFingerState (dev));
-	__( 6141,    GetFingerState (dev));
-	__( 6143,    GetFingerState (dev));
-	__( 6145,    GetFingerState (dev));
-	__( 6147,    GetFingerState (dev));
-	__( 6149,    GetFingerState (dev));
-	__( 6151,    GetFingerState (dev));
-	__( 6153,    GetFingerState (dev));
-	__( 6155,    GetFingerState (dev));
-	__( 6157,    GetFingerState (dev));
-	__( 6159,    GetFingerState (dev));
-	__( 6161,    GetFingerState (dev));
-	__( 6163,    GetFingerState (dev));
-	__( 6165,    GetFingerState (dev));
-	__( 6167,    GetFingerState (dev));
-	__( 6169,    GetFingerState (dev));
-	__( 6171,    GetFingerState (dev));
-	__( 6173,    GetFingerState (dev));
-	__( 6175,    GetFingerState (dev));
-	__( 6177,    GetFingerState (dev));
-	__( 6179,    GetFingerState (dev));
-	__( 6181,    GetFingerState (dev));
-	__( 6183,    GetFingerState (dev));
-	__( 6185,    GetFingerState (dev));
-	__( 6187,    GetFingerState (dev));
-	__( 6189,    GetFingerState (dev));
-	__( 6191,    GetFingerState (dev));
-	__( 6193,    GetFingerState (dev));
-	__( 6195,    GetFingerState (dev));
-	__( 6197,    GetFingerState (dev));
-	__( 6199,    GetFingerState (dev));
-	__( 6201,    GetFingerState (dev));
-	__( 6203,    GetFingerState (dev));
-	__( 6205,    GetFingerState (dev));
-	__( 6207,    GetFingerState (dev));
-	__( 6209,    GetFingerState (dev));
-	__( 6211,    GetFingerState (dev));
-	__( 6213,    GetFingerState (dev));
-	__( 6215,    GetFingerState (dev));
-	__( 6217,    GetFingerState (dev));
-	__( 6219,    GetFingerState (dev));
-	__( 6221,    GetFingerState (dev));
-	__( 6223,    GetFingerState (dev));
-	__( 6225,    GetFingerState (dev));
-	__( 6227,    GetFingerState (dev));
-	__( 6229,    GetFingerState (dev));
-	__( 6231,    GetFingerState (dev));
-	__( 6233,    GetFingerState (dev));
-	__( 6235,    GetFingerState (dev));
-	__( 6237,    GetFingerState (dev));
-	__( 6239,    GetFingerState (dev));
-	__( 6241,    GetFingerState (dev));
-	__( 6243,    GetFingerState (dev));
-	__( 6245,    GetFingerState (dev));
-	__( 6247,    GetFingerState (dev));
-	__( 6249,    GetFingerState (dev));
-	__( 6251,    GetFingerState (dev));
-	__( 6253,    GetFingerState (dev));
-	__( 6255,    GetFingerState (dev));
-	__( 6257,    GetFingerState (dev));
-	__( 6259,    GetFingerState (dev));
-	__( 6261,    GetFingerState (dev));
-	__( 6263,    GetFingerState (dev));
-	__( 6265,    GetFingerState (dev));
-	__( 6267,    GetFingerState (dev));
-	__( 6269,    GetFingerState (dev));
-	__( 6271,    GetFingerState (dev));
-	__( 6273,    GetFingerState (dev));
-	__( 6275,    GetFingerState (dev));
-	__( 6277,    GetFingerState (dev));
-	__( 6279,    GetFingerState (dev));
-	__( 6281,    GetFingerState (dev));
-	__( 6283,    GetFingerState (dev));
-	__( 6285,    GetFingerState (dev));
-	__( 6287,    GetFingerState (dev));
-	__( 6289,    GetFingerState (dev));
-	__( 6291,    GetFingerState (dev));
-	__( 6293,    GetFingerState (dev));
-	__( 6295,    GetFingerState (dev));
-	__( 6297,    GetFingerState (dev));
-	__( 6299,    GetFingerState (dev));
-	__( 6301,    GetFingerState (dev));
-	 _(          LoadImage (dev));
-	__( 6305,    GetParam (dev, 0x0014));
-	__( 6307,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 6310,    GetParam (dev, 0x0011));
-	__( 6312,    SetParam (dev, 0x0062, 0x0032));
-	__( 6314,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__( 6317,    GetConfig (dev));
-	__( 6319,    GetParam (dev, 0x002e));
-	__( 6321,    GetVersion (dev));
-	__( 6323,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 6326,    SetParam (dev, 0x0055, 0x0008));
-	__( 6328,    SetParam (dev, 0x0055, 0x0008));
-	__( 6330,    SetParam (dev, 0x0055, 0x0008));
-	__( 6332,    GetParam (dev, 0x0014));
-	__( 6334,    GetParam (dev, 0x0011));
-	__( 6336,    SetParam (dev, 0x0062, 0x0032));
-	__( 6338,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__( 6341,    GetParam (dev, 0x0014));
-	__( 6343,    GetParam (dev, 0x0014));
-	__( 6345,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 6348,    GetParam (dev, 0x0011));
-	__( 6350,    SetParam (dev, 0x0062, 0x0032));
-	__( 6352,    GetPrint (dev, 0x1388, type_1));
-	__( 6354,    GetFingerState (dev));
-	__( 6356,    GetFingerState (dev));
-	__( 6358,    GetFingerState (dev));
-	__( 6360,    GetFingerState (dev));
-	__( 6362,    GetFingerState (dev));
-	__( 6364,    GetFingerState (dev));
-	__( 6366,    GetFingerState (dev));
-	__( 6368,    GetFingerState (dev));
-	__( 6370,    GetFingerState (dev));
-	__( 6372,    GetFingerState (dev));
-	__( 6374,    GetFingerState (dev));
-	__( 6376,    GetFingerState (dev));
-	__( 6378,    GetFingerState (dev));
-	__( 6380,    GetFingerState (dev));
-	__( 6382,    GetFingerState (dev));
-	__( 6384,    GetFingerState (dev));
-	__( 6386,    GetFingerState (dev));
-	__( 6388,    GetFingerState (dev));
-	__( 6390,    GetFingerState (dev));
-	__( 6392,    GetFingerState (dev));
-	__( 6394,    GetFingerState (dev));
-	__( 6396,    GetFingerState (dev));
-	__( 6398,    GetFingerState (dev));
-	__( 6400,    GetFingerState (dev));
-	__( 6402,    GetFingerState (dev));
-	__( 6404,    GetFingerState (dev));
-	__( 6406,    GetFingerState (dev));
-	__( 6408,    GetFingerState (dev));
-	__( 6410,    GetFingerState (dev));
-	__( 6412,    GetFingerState (dev));
-	__( 6414,    GetFingerState (dev));
-	__( 6416,    GetFingerState (dev));
-	__( 6418,    GetFingerState (dev));
-	__( 6420,    GetFingerState (dev));
-	__( 6422,    GetFingerState (dev));
-	__( 6424,    GetFingerState (dev));
-	__( 6426,    GetFingerState (dev));
-	__( 6428,    GetFingerState (dev));
-	__( 6430,    GetFingerState (dev));
-	__( 6432,    GetFingerState (dev));
-	__( 6434,    GetFingerState (dev));
-	__( 6436,    GetFingerState (dev));
-	__( 6438,    GetFingerState (dev));
-	__( 6440,    GetFingerState (dev));
-	__( 6442,    GetFingerState (dev));
-	__( 6444,    GetFingerState (dev));
-	__( 6446,    GetFingerState (dev));
-	__( 6448,    GetFingerState (dev));
-	__( 6450,    GetFingerState (dev));
-	__( 6452,    GetFingerState (dev));
-	__( 6454,    GetFingerState (dev));
-	__( 6456,    GetFingerState (dev));
-	__( 6458,    GetFingerState (dev));
-	__( 6460,    GetFingerState (dev));
-	__( 6462,    GetFingerState (dev));
-	__( 6464,    GetFingerState (dev));
-	__( 6466,    GetFingerState (dev));
-	__( 6468,    GetFingerState (dev));
-	__( 6470,    GetFingerState (dev));
-	__( 6472,    GetFingerState (dev));
-	__( 6474,    GetFingerState (dev));
-	__( 6476,    GetFingerState (dev));
-	__( 6478,    GetFingerState (dev));
-	__( 6480,    GetFingerState (dev));
-	__( 6482,    GetFingerState (dev));
-	__( 6484,    GetFingerState (dev));
-	__( 6486,    GetFingerState (dev));
-	__( 6488,    GetFingerState (dev));
-	__( 6490,    GetFingerState (dev));
-	__( 6492,    GetFingerState (dev));
-	__( 6494,    GetFingerState (dev));
-	__( 6496,    GetFingerState (dev));
-	__( 6498,    GetFingerState (dev));
-	__( 6500,    GetFingerState (dev));
-	__( 6502,    GetFingerState (dev));
-	__( 6504,    GetFingerState (dev));
-	__( 6506,    GetFingerState (dev));
-	__( 6508,    GetFingerState (dev));
-	__( 6510,    GetFingerState (dev));
-	__( 6512,    GetFingerState (dev));
-	__( 6514,    GetFingerState (dev));
-	__( 6516,    GetFingerState (dev));
-	__( 6518,    GetFingerState (dev));
-	__( 6520,    GetFingerState (dev));
-	__( 6522,    GetFingerState (dev));
-	__( 6524,    GetFingerState (dev));
-	__( 6526,    GetFingerState (dev));
-	__( 6528,    GetFingerState (dev));
-	__( 6530,    GetFingerState (dev));
-	__( 6532,    GetFingerState (dev));
-	__( 6534,    GetFingerState (dev));
-	__( 6536,    GetFingerState (dev));
-	__( 6538,    GetFingerState (dev));
-	__( 6540,    GetFingerState (dev));
-	__( 6542,    GetFingerState (dev));
-	__( 6544,    GetFingerState (dev));
-	__( 6546,    GetFingerState (dev));
-	__( 6548,    GetFingerState (dev));
-	__( 6550,    GetFingerState (dev));
-	__( 6552,    GetFingerState (dev));
-	__( 6554,    GetFingerState (dev));
-	__( 6556,    GetFingerState (dev));
-	__( 6558,    GetFingerState (dev));
-	__( 6560,    GetFingerState (dev));
-	__( 6562,    GetFingerState (dev));
-	__( 6564,    GetFingerState (dev));
-	__( 6566,    GetFingerState (dev));
-	__( 6568,    GetFingerState (dev));
-	__( 6570,    GetFingerState (dev));
-	__( 6572,    GetFingerState (dev));
-	__( 6574,    GetFingerState (dev));
-	__( 6576,    GetFingerState (dev));
-	__( 6578,    GetFingerState (dev));
-	__( 6580,    GetFingerState (dev));
-	__( 6582,    GetFingerState (dev));
-	__( 6584,    GetFingerState (dev));
-	__( 6586,    GetFingerState (dev));
-	__( 6588,    GetFingerState (dev));
-	__( 6590,    GetFingerState (dev));
-	__( 6592,    GetFingerState (dev));
-	__( 6594,    GetFingerState (dev));
-	__( 6596,    GetFingerState (dev));
-	__( 6598,    GetFingerState (dev));
-	__( 6600,    GetFingerState (dev));
-	__( 6602,    GetFingerState (dev));
-	__( 6604,    GetFingerState (dev));
-	__( 6606,    GetFingerState (dev));
-	__( 6608,    GetFingerState (dev));
-	__( 6610,    GetFingerState (dev));
-	__( 6612,    GetFingerState (dev));
-	__( 6614,    GetFingerState (dev));
-	__( 6616,    GetFingerState (dev));
-	__( 6618,    GetFingerState (dev));
-	__( 6620,    GetFingerState (dev));
-	__( 6622,    GetFingerState (dev));
-	__( 6624,    GetFingerState (dev));
-	__( 6626,    GetFingerState (dev));
-	__( 6628,    GetFingerState (dev));
-	__( 6630,    GetFingerState (dev));
-	__( 6632,    GetFingerState (dev));
-	__( 6634,    GetFingerState (dev));
-	__( 6636,    GetFingerState (dev));
-	__( 6638,    GetFingerState (dev));
-	__( 6640,    GetFingerState (dev));
-	__( 6642,    GetFingerState (dev));
-	__( 6644,    GetFingerState (dev));
-	__( 6646,    GetFingerState (dev));
-	__( 6648,    GetFingerState (dev));
-	__( 6650,    GetFingerState (dev));
-	__( 6652,    GetFingerState (dev));
-	__( 6654,    GetFingerState (dev));
-	__( 6656,    GetFingerState (dev));
-	__( 6658,    GetFingerState (dev));
-	__( 6660,    GetFingerState (dev));
-	__( 6662,    GetFingerState (dev));
-	__( 6664,    GetFingerState (dev));
-	__( 6666,    GetFingerState (dev));
-	__( 6668,    GetFingerState (dev));
-	__( 6670,    GetFingerState (dev));
-	__( 6672,    GetFingerState (dev));
-	__( 6674,    GetFingerState (dev));
-	__( 6676,    GetFingerState (dev));
-	__( 6678,    GetFingerState (dev));
-	__( 6680,    GetFingerState (dev));
-	__( 6682,    GetFingerState (dev));
-	__( 6684,    GetFingerState (dev));
-	__( 6686,    GetFingerState (dev));
-	__( 6688,    GetFingerState (dev));
-	__( 6690,    GetFingerState (dev));
-	__( 6692,    GetFingerState (dev));
-	__( 6694,    GetFingerState (dev));
-	__( 6696,    GetFingerState (dev));
-	__( 6698,    GetFingerState (dev));
-	__( 6700,    GetFingerState (dev));
-	__( 6702,    GetFingerState (dev));
-	__( 6704,    GetFingerState (dev));
-	__( 6706,    GetFingerState (dev));
-	__( 6708,    GetFingerState (dev));
-	__( 6710,    GetFingerState (dev));
-	__( 6712,    GetFingerState (dev));
-	__( 6714,    GetFingerState (dev));
-	__( 6716,    GetFingerState (dev));
-	__( 6718,    GetFingerState (dev));
-	__( 6720,    GetFingerState (dev));
-	__( 6722,    GetFingerState (dev));
-	__( 6724,    GetFingerState (dev));
-	__( 6726,    GetFingerState (dev));
-	__( 6728,    GetFingerState (dev));
-	__( 6730,    GetFingerState (dev));
-	__( 6732,    GetFingerState (dev));
-	__( 6734,    GetFingerState (dev));
-	__( 6736,    GetFingerState (dev));
-	__( 6738,    GetFingerState (dev));
-	__( 6740,    GetFingerState (dev));
-	__( 6742,    GetFingerState (dev));
-	__( 6744,    GetFingerState (dev));
-	__( 6746,    GetFingerState (dev));
-	__( 6748,    GetFingerState (dev));
-	__( 6750,    GetFingerState (dev));
-	__( 6752,    GetFingerState (dev));
-	__( 6754,    GetFingerState (dev));
-	__( 6756,    GetFingerState (dev));
-	__( 6758,    GetFingerState (dev));
-	__( 6760,    GetFingerState (dev));
-	__( 6762,    GetFingerState (dev));
-	__( 6764,    GetFingerState (dev));
-	__( 6766,    GetFingerState (dev));
-	__( 6768,    GetFingerState (dev));
-	__( 6770,    GetFingerState (dev));
-	__( 6772,    GetFingerState (dev));
-	__( 6774,    GetFingerState (dev));
-	__( 6776,    GetFingerState (dev));
-	__( 6778,    GetFingerState (dev));
-	__( 6780,    GetFingerState (dev));
-	__( 6782,    GetFingerState (dev));
-	__( 6784,    GetFingerState (dev));
-	__( 6786,    GetFingerState (dev));
-	__( 6788,    GetFingerState (dev));
-	__( 6790,    GetFingerState (dev));
-	__( 6792,    GetFingerState (dev));
-	__( 6794,    GetFingerState (dev));
-	__( 6796,    GetFingerState (dev));
-	__( 6798,    GetFingerState (dev));
-	__( 6800,    GetFingerState (dev));
-	 _(          LoadImage (dev));
-	__( 6804,    GetParam (dev, 0x0014));
-	__( 6806,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 6809,    GetParam (dev, 0x0011));
-	__( 6811,    SetParam (dev, 0x0062, 0x0032));
-	__( 6813,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__( 6816,    GetConfig (dev));
-	__( 6818,    GetParam (dev, 0x002e));
-	__( 6820,    GetVersion (dev));
-	__( 6822,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 6825,    SetParam (dev, 0x0055, 0x0008));
-	__( 6827,    SetParam (dev, 0x0055, 0x0008));
-	__( 6829,    SetParam (dev, 0x0055, 0x0008));
-	__( 6831,    GetParam (dev, 0x0014));
-	__( 6833,    GetParam (dev, 0x0011));
-	__( 6835,    SetParam (dev, 0x0062, 0x0032));
-	__( 6837,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__( 6840,    GetParam (dev, 0x0014));
-	__( 6842,    GetParam (dev, 0x0014));
-	__( 6844,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 6847,    GetParam (dev, 0x0011));
-	__( 6849,    SetParam (dev, 0x0062, 0x0032));
-	__( 6851,    GetPrint (dev, 0x1388, type_1));
-	__( 6853,    GetFingerState (dev));
-	__( 6855,    GetFingerState (dev));
-	__( 6857,    GetFingerState (dev));
-	__( 6859,    GetFingerState (dev));
-	__( 6861,    GetFingerState (dev));
-	__( 6863,    GetFingerState (dev));
-	__( 6865,    GetFingerState (dev));
-	__( 6867,    GetFingerState (dev));
-	__( 6869,    GetFingerState (dev));
-	__( 6871,    GetFingerState (dev));
-	__( 6873,    GetFingerState (dev));
-	__( 6875,    GetFingerState (dev));
-	__( 6877,    GetFingerState (dev));
-	__( 6879,    GetFingerState (dev));
-	__( 6881,    GetFingerState (dev));
-	__( 6883,    GetFingerState (dev));
-	__( 6885,    GetFingerState (dev));
-	__( 6887,    GetFingerState (dev));
-	__( 6889,    GetFingerState (dev));
-	__( 6891,    GetFingerState (dev));
-	__( 6893,    GetFingerState (dev));
-	__( 6895,    GetFingerState (dev));
-	__( 6897,    GetFingerState (dev));
-	__( 6899,    GetFingerState (dev));
-	__( 6901,    GetFingerState (dev));
-	__( 6903,    GetFingerState (dev));
-	__( 6905,    GetFingerState (dev));
-	__( 6907,    GetFingerState (dev));
-	__( 6909,    GetFingerState (dev));
-	__( 6911,    GetFingerState (dev));
-	__( 6913,    GetFingerState (dev));
-	__( 6915,    GetFingerState (dev));
-	__( 6917,    GetFingerState (dev));
-	__( 6919,    GetFingerState (dev));
-	__( 6921,    GetFingerState (dev));
-	__( 6923,    GetFingerState (dev));
-	__( 6925,    GetFingerState (dev));
-	__( 6927,    GetFingerState (dev));
-	__( 6929,    GetFingerState (dev));
-	__( 6931,    GetFingerState (dev));
-	__( 6933,    GetFingerState (dev));
-	__( 6935,    GetFingerState (dev));
-	__( 6937,    GetFingerState (dev));
-	__( 6939,    GetFingerState (dev));
-	__( 6941,    GetFingerState (dev));
-	__( 6943,    GetFingerState (dev));
-	__( 6945,    GetFingerState (dev));
-	__( 6947,    GetFingerState (dev));
-	__( 6949,    GetFingerState (dev));
-	__( 6951,    GetFingerState (dev));
-	__( 6953,    GetFingerState (dev));
-	__( 6955,    GetFingerState (dev));
-	__( 6957,    GetFingerState (dev));
-	__( 6959,    GetFingerState (dev));
-	__( 6961,    GetFingerState (dev));
-	__( 6963,    GetFingerState (dev));
-	__( 6965,    GetFingerState (dev));
-	__( 6967,    GetFingerState (dev));
-	__( 6969,    GetFingerState (dev));
-	__( 6971,    GetFingerState (dev));
-	__( 6973,    GetFingerState (dev));
-	__( 6975,    GetFingerState (dev));
-	__( 6977,    GetFingerState (dev));
-	__( 6979,    GetFingerState (dev));
-	__( 6981,    GetFingerState (dev));
-	__( 6983,    GetFingerState (dev));
-	__( 6985,    GetFingerState (dev));
-	__( 6987,    GetFingerState (dev));
-	__( 6989,    GetFingerState (dev));
-	__( 6991,    GetFingerState (dev));
-	__( 6993,    GetFingerState (dev));
-	__( 6995,    GetFingerState (dev));
-	__( 6997,    GetFingerState (dev));
-	__( 6999,    GetFingerState (dev));
-	__( 7001,    GetFingerState (dev));
-	__( 7003,    GetFingerState (dev));
-	__( 7005,    GetFingerState (dev));
-	__( 7007,    GetFingerState (dev));
-	__( 7009,    GetFingerState (dev));
-	__( 7011,    GetFingerState (dev));
-	__( 7013,    GetFingerState (dev));
-	__( 7015,    GetFingerState (dev));
-	__( 7017,    GetFingerState (dev));
-	__( 7019,    GetFingerState (dev));
-	__( 7021,    GetFingerState (dev));
-	__( 7023,    GetFingerState (dev));
-	__( 7025,    GetFingerState (dev));
-	__( 7027,    GetFingerState (dev));
-	__( 7029,    GetFingerState (dev));
-	__( 7031,    GetFingerState (dev));
-	__( 7033,    GetFingerState (dev));
-	__( 7035,    GetFingerState (dev));
-	__( 7037,    GetFingerState (dev));
-	__( 7039,    GetFingerState (dev));
-	__( 7041,    GetFingerState (dev));
-	__( 7043,    GetFingerState (dev));
-	__( 7045,    GetFingerState (dev));
-	__( 7047,    GetFingerState (dev));
-	__( 7049,    GetFingerState (dev));
-	__( 7051,    GetFingerState (dev));
-	__( 7053,    GetFingerState (dev));
-	__( 7055,    GetFingerState (dev));
-	__( 7057,    GetFingerState (dev));
-	__( 7059,    GetFingerState (dev));
-	__( 7061,    GetFingerState (dev));
-	__( 7063,    GetFingerState (dev));
-	__( 7065,    GetFingerState (dev));
-	__( 7067,    GetFingerState (dev));
-	__( 7069,    GetFingerState (dev));
-	__( 7071,    GetFingerState (dev));
-	__( 7073,    GetFingerState (dev));
-	__( 7075,    GetFingerState (dev));
-	__( 7077,    GetFingerState (dev));
-	__( 7079,    GetFingerState (dev));
-	__( 7081,    GetFingerState (dev));
-	__( 7083,    GetFingerState (dev));
-	__( 7085,    GetFingerState (dev));
-	__( 7087,    GetFingerState (dev));
-	__( 7089,    GetFingerState (dev));
-	__( 7091,    GetFingerState (dev));
-	__( 7093,    GetFingerState (dev));
-	__( 7095,    GetFingerState (dev));
-	__( 7097,    GetFingerState (dev));
-	__( 7099,    GetFingerState (dev));
-	__( 7101,    GetFingerState (dev));
-	__( 7103,    GetFingerState (dev));
-	__( 7105,    GetFingerState (dev));
-	__( 7107,    GetFingerState (dev));
-	__( 7109,    GetFingerState (dev));
-	__( 7111,    GetFingerState (dev));
-	__( 7113,    GetFingerState (dev));
-	__( 7115,    GetFingerState (dev));
-	__( 7117,    GetFingerState (dev));
-	__( 7119,    GetFingerState (dev));
-	__( 7121,    GetFingerState (dev));
-	__( 7123,    GetFingerState (dev));
-	__( 7125,    GetFingerState (dev));
-	__( 7127,    GetFingerState (dev));
-	__( 7129,    GetFingerState (dev));
-	__( 7131,    GetFingerState (dev));
-	__( 7133,    GetFingerState (dev));
-	__( 7135,    GetFingerState (dev));
-	__( 7137,    GetFingerState (dev));
-	__( 7139,    GetFingerState (dev));
-	__( 7141,    GetFingerState (dev));
-	__( 7143,    GetFingerState (dev));
-	__( 7145,    GetFingerState (dev));
-	__( 7147,    GetFingerState (dev));
-	__( 7149,    GetFingerState (dev));
-	__( 7151,    GetFingerState (dev));
-	__( 7153,    GetFingerState (dev));
-	__( 7155,    GetFingerState (dev));
-	__( 7157,    GetFingerState (dev));
-	__( 7159,    GetFingerState (dev));
-	__( 7161,    GetFingerState (dev));
-	__( 7163,    GetFingerState (dev));
-	__( 7165,    GetFingerState (dev));
-	__( 7167,    GetFingerState (dev));
-	__( 7169,    GetFingerState (dev));
-	__( 7171,    GetFingerState (dev));
-	__( 7173,    GetFingerState (dev));
-	__( 7175,    GetFingerState (dev));
-	__( 7177,    GetFingerState (dev));
-	__( 7179,    GetFingerState (dev));
-	__( 7181,    GetFingerState (dev));
-	__( 7183,    GetFingerState (dev));
-	__( 7185,    GetFingerState (dev));
-	__( 7187,    GetFingerState (dev));
-	__( 7189,    GetFingerState (dev));
-	__( 7191,    GetFingerState (dev));
-	__( 7193,    GetFingerState (dev));
-	__( 7195,    GetFingerState (dev));
-	__( 7197,    GetFingerState (dev));
-	__( 7199,    GetFingerState (dev));
-	__( 7201,    GetFingerState (dev));
-	__( 7203,    GetFingerState (dev));
-	__( 7205,    GetFingerState (dev));
-	__( 7207,    GetFingerState (dev));
-	__( 7209,    GetFingerState (dev));
-	__( 7211,    GetFingerState (dev));
-	__( 7213,    GetFingerState (dev));
-	__( 7215,    GetFingerState (dev));
-	__( 7217,    GetFingerState (dev));
-	__( 7219,    GetFingerState (dev));
-	__( 7221,    GetFingerState (dev));
-	__( 7223,    GetFingerState (dev));
-	return 0;
-}
-struct result_table PREFIX_results =
-{
-	7223,
-	{
-	[     6 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[     8 ] = {   8, "\x12\x00\x00\x00\x00\x00\x57\x21" },
-	[    10 ] = {   8, "\x12\x00\x00\x00\x9f\x29\x01\x00" },
-	[    12 ] = {   8, "\x12\x00\x00\x00\xdb\xdb\xdb\xdb" },
-	[    14 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[    16 ] = {   8, "\x12\x00\x00\x00\x20\x49\xfb\xd4" },
-	[    18 ] = {   6, "\x04\x00\x00\x00\x0a\x00" },
-	[    20 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[    22 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[    24 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[    26 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[    28 ] = {   6, "\x04\x00\x00\x00\x04\x00" },
-	[    30 ] = {   6, "\x04\x00\x00\x00\xf4\x01" },
-	[    32 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[    34 ] = {   4, "\x0e\x00\x00\x00" },
-	[    37 ] = {   4, "\x03\x00\x00\x00" },
-	[    40 ] = {   4, "\x0e\x00\x00\x00" },
-	[    43 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[    45 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[    47 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[    49 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[    51 ] = {   6, "\x05\x00\x00\x00\x02\x00" },
-	[    53 ] = {   6, "\x05\x00\x00\x00\x0b\x01" },
-	[    55 ] = {   6, "\x05\x00\x00\x00\x0c\x01" },
-	[    57 ] = {   6, "\x05\x00\x00\x00\x0d\x01" },
-	[    59 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[    61 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[    63 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[    65 ] = {   6, "\x05\x00\x00\x00\xb0\x04" },
-	[    67 ] = {   6, "\x05\x00\x00\x00\x1b\x00" },
-	[    69 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[    71 ] = {   6, "\x05\x00\x03\x00\x01\x00" },
-	[    73 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[    75 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[    77 ] = {   6, "\x05\x00\x00\x00\x04\x00" },
-	[    79 ] = {   6, "\x05\x00\x00\x00\x0c\x01" },
-	[    81 ] = {   6, "\x05\x00\x00\x00\x0d\x01" },
-	[    83 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[    85 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[    87 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[    89 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[    91 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[    93 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[    95 ] = {   6, "\x05\x00\x00\x00\x46\x00" },
-	[    97 ] = {   6, "\x05\x00\x03\x00\x46\x00" },
-	[    99 ] = {   6, "\x05\x00\x00\x00\x0e\x01" },
-	[   101 ] = {   6, "\x05\x00\x00\x00\x0f\x01" },
-	[   103 ] = {   6, "\x05\x00\x00\x00\x04\x00" },
-	[   105 ] = {   6, "\x05\x00\x00\x00\x03\x00" },
-	[   107 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   109 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   111 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   113 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   115 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   117 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   119 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   121 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   123 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   125 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   127 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   129 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[   131 ] = {   6, "\x05\x00\x03\x00\x01\x00" },
-	[   133 ] = {   6, "\x05\x00\x00\x00\x10\x00" },
-	[   135 ] = {   6, "\x05\x00\x00\x00\x05\x00" },
-	[   137 ] = {   6, "\x05\x00\x00\x00\xf5\x00" },
-	[   139 ] = {   6, "\x05\x00\x00\x00\x0c\x00" },
-	[   141 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   143 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   145 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   147 ] = {   6, "\x05\x00\x00\x00\xb4\x00" },
-	[   149 ] = {   6, "\x05\x00\x00\x00\x96\x00" },
-	[   151 ] = {   6, "\x05\x00\x00\x00\x8c\x00" },
-	[   153 ] = {   6, "\x05\x00\x00\x00\x64\x00" },
-	[   155 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[   157 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[   159 ] = {   6, "\x05\x00\x00\x00\x20\x00" },
-	[   161 ] = {   6, "\x05\x00\x00\x00\x64\x00" },
-	[   163 ] = {   6, "\x05\x00\x00\x00\xc8\x00" },
-	[   165 ] = {   6, "\x05\x00\x00\x00\xc8\x00" },
-	[   167 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   169 ] = {   6, "\x05\x00\x00\x00\x1a\x01" },
-	[   171 ] = {   6, "\x05\x00\x00\x00\x14\x00" },
-	[   173 ] = {   6, "\x04\x00\x03\x00\x14\x00" },
-	[   175 ] = {   6, "\x04\x00\x03\x00\x14\x00" },
-	[   177 ] = {   6, "\x04\x00\x00\x00\x6f\x00" },
-	[   179 ] = {   6, "\x04\x00\x03\x00\x6f\x00" },
-	[   181 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[   183 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[   185 ] = {   9, "\x14\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[   187 ] = {   6, "\x05\x00\x00\x00\x18\x01" },
-	[   189 ] = {  34, "\x06\x00\x00\x00\x00\x00\x08\x00\x0a\x0a\x11\x11\xe6\xdd\xe6\xe5\xf0\xee\xf0\xef\x03\x00\x31\x00\x20\x00\x12\x00\x14\x00\xff\xff\x85\x00" },
-	[   191 ] = {   6, "\x05\x00\x00\x00\xf5\x00" },
-	[   193 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[   195 ] = {   6, "\x05\x00\x00\x00\x03\x00" },
-	[   197 ] = {   6, "\x04\x00\x00\x00\xb4\x1e" },
-	[   199 ] = {   6, "\x05\x00\x00\x00\x20\x03" },
-	[   201 ] = {   4, "\x03\x00\x00\x00" },
-	[   204 ] = {   6, "\x05\x00\x00\x00\xb4\x1e" },
-	[   206 ] = {   8, "\x12\x00\x00\x00\xf0\xee\x00\x00" },
-	[   208 ] = {   8, "\x12\x00\x00\x00\xf0\xf0\x00\x00" },
-	[   210 ] = {   4, "\x13\x00\x00\x00" },
-	[   212 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[   214 ] = {   4, "\x13\x00\x00\x00" },
-	[   216 ] = {   8, "\x12\x00\x00\x00\xfb\x00\x00\x00" },
-	[   218 ] = {   8, "\x12\x00\x00\x00\x03\x00\x00\x00" },
-	[   220 ] = {   8, "\x12\x00\x00\x00\x10\x00\x00\x00" },
-	[   222 ] = {   4, "\x13\x00\x00\x00" },
-	[   224 ] = {   4, "\x03\x00\x00\x00" },
-	[   227 ] = {   4, "\x13\x00\x00\x00" },
-	[   229 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[   231 ] = {   4, "\x13\x00\x00\x00" },
-	[   233 ] = {   8, "\x12\x00\x00\x00\xfb\x00\x00\x00" },
-	[   235 ] = {   8, "\x12\x00\x00\x00\x03\x00\x00\x00" },
-	[   237 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[   239 ] = {   4, "\x03\x00\x00\x00" },
-	[   242 ] = {   8, "\x12\x00\x00\x00\x14\x00\x00\x00" },
-	[   244 ] = {   8, "\x12\x00\x00\x00\xbc\x21\x00\x00" },
-	[   246 ] = {   8, "\x12\x00\x00\x00\x31\x00\x00\x00" },
-	[   248 ] = {   4, "\x13\x00\x00\x00" },
-	[   250 ] = {   4, "\x13\x00\x00\x00" },
-	[   252 ] = {   4, "\x13\x00\x00\x00" },
-	[   254 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   256 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   258 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   260 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   262 ] = {   4, "\x03\x00\x00\x00" },
-	[   265 ] = {   4, "\x13\x00\x00\x00" },
-	[   267 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[   269 ] = {   4, "\x13\x00\x00\x00" },
-	[   271 ] = {   8, "\x12\x00\x00\x00\xfb\x00\x00\x00" },
-	[   273 ] = {   8, "\x12\x00\x00\x00\x03\x00\x00\x00" },
-	[   275 ] = {   8, "\x12\x00\x00\x00\x10\x00\x00\x00" },
-	[   277 ] = {   4, "\x13\x00\x00\x00" },
-	[   279 ] = {   4, "\x03\x00\x00\x00" },
-	[   282 ] = {   4, "\x13\x00\x00\x00" },
-	[   284 ] = {   4, "\x03\x00\x00\x00" },
-	[   287 ] = {   4, "\x13\x00\x00\x00" },
-	[   289 ] = {   4, "\x03\x00\x00\x00" },
-	[   292 ] = {   4, "\x13\x00\x00\x00" },
-	[   294 ] = {   4, "\x03\x00\x00\x00" },
-	[   297 ] = {   4, "\x13\x00\x00\x00" },
-	[   299 ] = {   4, "\x03\x00\x00\x00" },
-	[   302 ] = {   4, "\x13\x00\x00\x00" },
-	[   304 ] = {   4, "\x03\x00\x00\x00" },
-	[   307 ] = {   4, "\x13\x00\x00\x00" },
-	[   309 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[   311 ] = {   4, "\x13\x00\x00\x00" },
-	[   313 ] = {   8, "\x12\x00\x00\x00\xfb\x00\x00\x00" },
-	[   315 ] = {   8, "\x12\x00\x00\x00\x03\x00\x00\x00" },
-	[   317 ] = {   8, "\x12\x00\x00\x00\x10\x00\x00\x00" },
-	[   319 ] = {   4, "\x13\x00\x00\x00" },
-	[   321 ] = {   4, "\x03\x00\x00\x00" },
-	[   324 ] = {   6, "\x05\x00\x00\x00\x09\x00" },
-	[   326 ] = {   6, "\x05\x00\x00\x00\x12\x00" },
-	[   328 ] = {   6, "\x05\x00\x00\x00\x30\x22" },
-	[   330 ] = {   4, "\x13\x00\x00\x00" },
-	[   332 ] = {   4, "\x13\x00\x00\x00" },
-	[   334 ] = {   4, "\x13\x00\x00\x00" },
-	[   336 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[   338 ] = {   4, "\x0e\x00\x00\x00" },
-	[   341 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[   343 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[   345 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[   347 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[   349 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[   351 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[   353 ] = {   4, "\x03\x00\x00\x00" },
-	[   356 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[   358 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[   360 ] = {   4, "\x0e\x00\x00\x00" },
-	[   363 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[   365 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[   367 ] = {   4, "\x03\x00\x00\x00" },
-	[   369 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   371 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   373 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   375 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   377 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   379 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   381 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   383 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   385 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   387 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   389 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   391 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   393 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   395 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   397 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   399 ] = {   7, "\x16\x00\x00\x00\xff\xff\x02" },
-	[   402 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[   404 ] = {   4, "\x0e\x00\x00\x00" },
-	[   407 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[   409 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[   411 ] = {   4, "\x03\x00\x00\x00" },
-	[   414 ] = {  34, "\x06\x00\x00\x00\x00\x00\x08\x00\x0a\x0a\x12\x12\xe6\xdd\xe6\xe5\xf0\xee\xf0\xef\x03\x00\x31\x00\x20\x00\x12\x00\x14\x00\xff\xff\x85\x00" },
-	[   416 ] = {   6, "\x04\x00\x00\x00\x0a\x00" },
-	[   418 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[   420 ] = {   4, "\x0e\x00\x00\x00" },
-	[   423 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[   425 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[   427 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[   429 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[   431 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[   433 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[   435 ] = {   4, "\x03\x00\x00\x00" },
-	[   438 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[   440 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[   442 ] = {   4, "\x0e\x00\x00\x00" },
-	[   445 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[   447 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[   449 ] = {   4, "\x03\x00\x00\x00" },
-	[   451 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[   453 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[   455 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[   457 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[   459 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[   461 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[   463 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   465 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   467 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   469 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   471 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   473 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   475 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   477 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   479 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   481 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   483 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   485 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   487 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   489 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   491 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   493 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   495 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   497 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   499 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   501 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   503 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   505 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   507 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   509 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   511 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   513 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   515 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   517 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   519 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   521 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   523 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   525 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   527 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   529 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   531 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   533 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   535 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   537 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   539 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   541 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   543 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   545 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   547 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   549 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   551 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   553 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   555 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   557 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   559 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   561 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   563 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   565 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   567 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   569 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   571 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   573 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   575 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   577 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   579 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   581 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   583 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   585 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   587 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   589 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   591 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   593 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   595 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   597 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   599 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   601 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   603 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   605 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   607 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   609 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   611 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   613 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   615 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   617 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   619 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   621 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   623 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   625 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   627 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   629 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   631 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   633 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   635 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   637 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   639 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   641 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   643 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   645 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   647 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   649 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   651 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   653 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   655 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   657 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   659 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   661 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   663 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   665 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   667 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   669 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   671 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   673 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   675 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   677 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   679 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   681 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   683 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   685 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   687 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   689 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   691 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   693 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   695 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   697 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   699 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   701 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   703 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   705 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   707 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   709 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   711 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   713 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   715 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   717 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   719 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   721 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   723 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   725 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   727 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   729 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   731 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   733 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   735 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   737 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   739 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   741 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   743 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   745 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   747 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   749 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   751 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   753 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   755 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   757 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   759 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   761 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   763 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   765 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   767 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   769 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   771 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   773 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   775 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   777 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   779 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   781 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   783 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   785 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   787 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   789 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   791 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   793 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   795 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   797 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   799 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   801 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   803 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   805 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   807 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   809 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   811 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   813 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   815 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   817 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   819 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   821 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   823 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   825 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   827 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   829 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   831 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   833 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   835 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   837 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   839 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   841 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   843 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   845 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   847 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   849 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   851 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   853 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   855 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   857 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   859 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   861 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   863 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   865 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   867 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   869 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   871 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   873 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   875 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   877 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   879 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   881 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   883 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   885 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   887 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   889 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   891 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   893 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   895 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   897 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   899 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   901 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   903 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   905 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   907 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   909 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   911 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   913 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   915 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   917 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   919 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   921 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   923 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   925 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   927 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   929 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   931 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   933 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   935 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   937 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   939 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   941 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   943 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   945 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   947 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   949 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   951 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   953 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   955 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   957 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   959 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   961 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   963 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   965 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   967 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   969 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   971 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   973 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   975 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   977 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   979 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   981 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   983 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   985 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   987 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   989 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   991 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   993 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   995 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   997 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   999 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1001 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1003 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1005 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1007 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1009 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1011 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1013 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1015 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1017 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1019 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1021 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1023 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1025 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1027 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1029 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1031 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1033 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1035 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1037 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1039 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1041 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1043 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1045 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1047 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1049 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1051 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1053 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1055 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1057 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1059 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1061 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1063 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1065 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1067 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1069 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1071 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1073 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1075 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1077 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1079 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1081 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1083 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1085 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1087 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1089 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1091 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1093 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1095 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1097 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1099 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1101 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1103 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1105 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1107 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1109 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1111 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1113 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1115 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1117 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1119 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1121 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1123 ] = {   7, "\x16\x00\x00\x00\xff\xff\x02" },
-	[  1126 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  1128 ] = {   4, "\x0e\x00\x00\x00" },
-	[  1131 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  1133 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  1135 ] = {   4, "\x03\x00\x00\x00" },
-	[  1138 ] = {  34, "\x06\x00\x00\x00\x00\x00\x08\x00\x0a\x0a\x12\x12\xe6\xde\xe6\xe7\xf0\xee\xf0\xf0\x03\x00\x31\x00\x20\x00\x12\x00\x14\x00\xff\xff\x85\x00" },
-	[  1140 ] = {   6, "\x04\x00\x00\x00\x0a\x00" },
-	[  1142 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[  1144 ] = {   4, "\x0e\x00\x00\x00" },
-	[  1147 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  1149 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  1151 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  1153 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  1155 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  1157 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  1159 ] = {   4, "\x03\x00\x00\x00" },
-	[  1162 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  1164 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  1166 ] = {   4, "\x0e\x00\x00\x00" },
-	[  1169 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  1171 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  1173 ] = {   4, "\x03\x00\x00\x00" },
-	[  1175 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  1177 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  1179 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  1181 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  1183 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  1185 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1187 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1189 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1191 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1193 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1195 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1197 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1199 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1201 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1203 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1205 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1207 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1209 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1211 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1213 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1215 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1217 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1219 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1221 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1223 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1225 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1227 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1229 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1231 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1233 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1235 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1237 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1239 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1241 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1243 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1245 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1247 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1249 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1251 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1253 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1255 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1257 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1259 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1261 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1263 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1265 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1267 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1269 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1271 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1273 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1275 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1277 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1279 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1281 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1283 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1285 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1287 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1289 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1291 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1293 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1295 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1297 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1299 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1301 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1303 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1305 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1307 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1309 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1311 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1313 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1315 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1317 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1319 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1321 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1323 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1325 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1327 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1329 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1331 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1333 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1335 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1337 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1339 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1341 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1343 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1345 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1347 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1349 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1351 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1353 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1355 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1357 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1359 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1361 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1363 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1365 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1367 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1369 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1371 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1373 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1375 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1377 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1379 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1381 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1383 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1385 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1387 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1389 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1391 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1393 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1395 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1397 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1399 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1401 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1403 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1405 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1407 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1409 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1411 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1413 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1415 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1417 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1419 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1421 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1423 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1425 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1427 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1429 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1431 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1433 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1435 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1437 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1439 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1441 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1443 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1445 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1447 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1449 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1451 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1547 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1549 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1551 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1553 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1555 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1557 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1559 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1561 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1563 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1565 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1567 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1569 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1571 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1573 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1575 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1577 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1579 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1581 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1583 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1585 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1587 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1589 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1591 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1593 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1595 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1597 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1599 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1601 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1603 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1605 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1607 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1609 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1611 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1613 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1615 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1617 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1619 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1621 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1623 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1625 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1627 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1629 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1631 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1633 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1635 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1637 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1639 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1641 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1643 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1645 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1647 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1649 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1651 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1653 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1655 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1657 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1659 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1661 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1663 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1665 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1667 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1669 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1671 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1673 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1675 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1677 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1679 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1681 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1683 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1685 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1687 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1689 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1691 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1693 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1695 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1697 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1699 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1701 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1703 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1705 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1707 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1709 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1711 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1713 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1715 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1717 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1719 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1721 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1723 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1725 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1727 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1729 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1731 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1733 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1735 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1737 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1739 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1741 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1743 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1745 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1747 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1749 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1751 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1753 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1755 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1757 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1759 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1761 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1763 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1765 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1767 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1769 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1771 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1773 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1775 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1777 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1779 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1781 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1783 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1785 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1787 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1789 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1791 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1793 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1795 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1797 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1799 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1801 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1803 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1805 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1807 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1809 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1811 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1813 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1815 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1817 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1819 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1821 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1823 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1825 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1827 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1829 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1831 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1833 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1835 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1837 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1839 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1841 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1843 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1845 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1847 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1849 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1851 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1853 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1855 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1857 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1859 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1861 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1863 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1865 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1867 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1869 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1871 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1873 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1875 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1877 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1879 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1881 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1883 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1885 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1887 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1889 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1891 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1893 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1895 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1897 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1899 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1901 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1903 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1905 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1907 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1909 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1911 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1913 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1915 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1917 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1919 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1921 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1923 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1925 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1927 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1929 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1931 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1933 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1935 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1937 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1939 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1941 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1943 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1945 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1947 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1949 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1951 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1953 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1955 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1957 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1959 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1961 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1963 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1965 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1967 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1969 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1971 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1973 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1975 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1977 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1979 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1981 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1983 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1985 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1987 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1989 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1991 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1993 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1995 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1997 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1999 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2001 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2003 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2005 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2007 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2009 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2011 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2013 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2015 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2017 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2019 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2021 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2023 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2025 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2027 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2029 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2031 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2033 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2035 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2037 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2039 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2041 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2043 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2045 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2047 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2049 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2051 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2053 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2055 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2057 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2059 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2061 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2063 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2065 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2067 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2069 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2071 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2073 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2075 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2077 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2079 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2081 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2083 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2085 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2087 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2089 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2091 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2093 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2095 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2097 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2099 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2101 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2103 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2105 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2107 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2109 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2111 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2113 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2115 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2117 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2119 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2121 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2123 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2125 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2127 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2129 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2131 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2133 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2135 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2137 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2139 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2141 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2143 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2145 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2147 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2149 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2151 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2153 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2155 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2157 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2159 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2161 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2163 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2165 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2167 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2169 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2171 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2173 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2175 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2177 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2179 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2181 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2183 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2185 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2187 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2189 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2191 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2193 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2195 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2197 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2199 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2201 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2203 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2205 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2207 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2209 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2211 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2213 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2215 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2217 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2219 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2221 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2223 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2225 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2227 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2229 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2231 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2233 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2235 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2237 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2239 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2241 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2243 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2245 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2247 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2249 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2251 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2253 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2255 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2257 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2259 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2261 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2263 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2265 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2267 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2269 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2271 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2273 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2275 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2277 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2279 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2281 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2283 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2285 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2287 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2289 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2291 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2293 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2295 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2297 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2299 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2301 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2303 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2305 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2307 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2309 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2311 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2313 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2315 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2317 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2319 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2321 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2323 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2325 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2327 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2329 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2331 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2333 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2335 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2337 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2339 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2341 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2343 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2345 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2347 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2349 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2351 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2353 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2355 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2357 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2359 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2361 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2363 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2365 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2367 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2369 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2371 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2373 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2375 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2377 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2379 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2381 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2383 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2385 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2387 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2389 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2391 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2393 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2395 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2397 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2399 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2401 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2403 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2405 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2407 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2409 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2411 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2413 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2415 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2417 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2419 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2421 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2423 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2425 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2427 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2429 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2431 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2433 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2435 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2437 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2439 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2441 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2443 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2445 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2447 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2449 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2451 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2453 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2455 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2457 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2459 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2461 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2463 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2465 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2467 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2469 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2471 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2473 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2475 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2477 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2479 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2481 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2483 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2485 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2487 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2489 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2491 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2493 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2495 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2497 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2499 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2501 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2503 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2505 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2507 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2509 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2511 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2513 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2515 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2517 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2519 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2521 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2523 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2525 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2527 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2529 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2531 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2533 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2535 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2537 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2539 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2541 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2543 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2545 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2547 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2549 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2551 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2553 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2555 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2557 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2559 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2561 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2563 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2565 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2567 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2569 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2571 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2573 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2575 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2577 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2579 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2581 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2583 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2585 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2587 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2589 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2591 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2593 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2595 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2597 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2599 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2601 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2603 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2605 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2607 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2609 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2611 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2613 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2615 ] = {   4, "\x0e\x00\x00\x00" },
-	[  2618 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  2620 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  2622 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[  2624 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[  2626 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  2628 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  2630 ] = {   4, "\x0e\x00\x00\x00" },
-	[  2633 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  2635 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  2637 ] = {   4, "\x03\x00\x00\x00" },
-	[  2640 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  2642 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  2644 ] = {   4, "\x0e\x00\x00\x00" },
-	[  2647 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  2649 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  2651 ] = {   4, "\x03\x00\x00\x00" },
-	[  2653 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2655 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2657 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2659 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2661 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2663 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2665 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2667 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2669 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2671 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2673 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2675 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2677 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2679 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2681 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2683 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2685 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2687 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2689 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2691 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2693 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2695 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2697 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2699 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2701 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2703 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2705 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2707 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2709 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2711 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2713 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2715 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2717 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2719 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2721 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2723 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2725 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2727 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2729 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2731 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2733 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2735 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2737 ] = {   7, "\x16\x00\x00\x00\xff\xff\x02" },
-	[  2740 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  2742 ] = {   4, "\x0e\x00\x00\x00" },
-	[  2745 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  2747 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  2749 ] = {   4, "\x03\x00\x00\x00" },
-	[  2752 ] = {  34, "\x06\x00\x00\x00\x00\x00\x08\x00\x0a\x0a\x12\x12\xe6\xdd\xe6\xe5\xf0\xee\xf0\xef\x03\x00\x31\x00\x20\x00\x12\x00\x14\x00\xff\xff\x85\x00" },
-	[  2754 ] = {   6, "\x04\x00\x00\x00\x0a\x00" },
-	[  2756 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[  2758 ] = {   4, "\x0e\x00\x00\x00" },
-	[  2761 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  2763 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  2765 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  2767 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  2769 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  2771 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  2773 ] = {   4, "\x03\x00\x00\x00" },
-	[  2776 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  2778 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  2780 ] = {   4, "\x0e\x00\x00\x00" },
-	[  2783 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  2785 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  2787 ] = {   4, "\x03\x00\x00\x00" },
-	[  2789 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  2791 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  2793 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  2795 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  2797 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  2799 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2801 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2803 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2805 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2807 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2809 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2811 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2813 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2815 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2817 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2819 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2821 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2823 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2825 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2827 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2829 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2831 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2833 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2835 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2837 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2839 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2841 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2843 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2845 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2847 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2849 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2851 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2853 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2855 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2857 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2859 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2861 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2863 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2865 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2867 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2869 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2871 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2873 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2875 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2877 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2879 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2881 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2883 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2885 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2887 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2889 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2891 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2893 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2895 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2897 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2899 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2901 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2903 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2905 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2907 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2909 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2911 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2913 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2915 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2917 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2919 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2921 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2923 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2925 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2927 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2929 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2931 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2933 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2935 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2937 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2939 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2941 ] = {   7, "\x16\x00\x00\x00\xff\xff\x02" },
-	[  2945 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  2947 ] = {   4, "\x0e\x00\x00\x00" },
-	[  2950 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  2952 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  2954 ] = {   4, "\x03\x00\x00\x00" },
-	[  2957 ] = {  34, "\x06\x00\x00\x00\x00\x00\x08\x00\x0a\x0a\x12\x12\xe6\xde\xe6\xe7\xf0\xee\xf0\xef\x03\x00\x31\x00\x20\x00\x12\x00\x14\x00\xff\xff\x85\x00" },
-	[  2959 ] = {   6, "\x04\x00\x00\x00\x0a\x00" },
-	[  2961 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[  2963 ] = {   4, "\x0e\x00\x00\x00" },
-	[  2966 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  2968 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  2970 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  2972 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  2974 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  2976 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  2978 ] = {   4, "\x03\x00\x00\x00" },
-	[  2981 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  2983 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  2985 ] = {   4, "\x0e\x00\x00\x00" },
-	[  2988 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  2990 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  2992 ] = {   4, "\x03\x00\x00\x00" },
-	[  2994 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  2996 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  2998 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  3000 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  3002 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  3004 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3006 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3008 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3010 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3012 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3014 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3016 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3018 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3020 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3022 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3024 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3026 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3028 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3030 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3032 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3034 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3036 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3038 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3040 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3042 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3044 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3046 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3048 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3050 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3052 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3054 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3056 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3058 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3060 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3062 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3064 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3066 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3068 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3070 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3072 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3074 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3076 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3078 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3080 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3082 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3084 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3086 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3088 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3090 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3092 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3094 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3096 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3098 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3100 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3102 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3104 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3106 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3108 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3110 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3112 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3114 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3116 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3118 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3120 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3122 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3124 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3126 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3128 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3130 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3132 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3134 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3136 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3138 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3140 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3142 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3144 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3146 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3148 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3150 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3152 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3154 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3156 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3158 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3160 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3162 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3164 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3166 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3168 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3170 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3172 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3174 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3176 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3178 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3180 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3182 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3184 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3186 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3188 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3190 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3192 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3194 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3196 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3198 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3200 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3202 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3204 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3206 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3208 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3210 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3212 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3214 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3216 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3218 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3220 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3222 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3224 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3226 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3228 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3230 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3232 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3234 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3236 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3238 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3240 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3242 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3244 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3246 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3248 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3250 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3252 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3254 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3256 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3258 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3260 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3262 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3264 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3266 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3268 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3270 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3272 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3274 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3276 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3278 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3280 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3282 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3284 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3286 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3288 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3290 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3292 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3294 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3296 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3298 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3300 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3302 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3304 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3306 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3308 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3310 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3312 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3314 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3316 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3318 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3320 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3322 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3324 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3326 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3328 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3330 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3332 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3334 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3336 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3338 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3340 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3342 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3344 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3346 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3348 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3350 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3352 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3354 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3356 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3358 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3360 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3362 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3364 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3366 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3368 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3370 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3372 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3374 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3376 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3418 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3420 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3422 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3424 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3426 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3428 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3430 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3432 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3434 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3436 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3438 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3440 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3442 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3444 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3446 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3448 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3450 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3452 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3454 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3456 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3458 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3460 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3462 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3464 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3466 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3468 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3470 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3472 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3474 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3476 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3478 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3480 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3482 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3484 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3486 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3488 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3490 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3492 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3494 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3496 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3498 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3500 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3502 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3504 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3506 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3508 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3510 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3512 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3514 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3516 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3518 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3520 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3522 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3524 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3526 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3528 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3530 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3532 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3534 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3536 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3538 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3540 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3542 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3544 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3546 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3548 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3550 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3552 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3554 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3556 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3558 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3560 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3562 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3564 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3566 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3568 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3570 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3572 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3574 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3576 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3578 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3580 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3582 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3584 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3586 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3588 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3590 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3592 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3594 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3596 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3598 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3600 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3602 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3604 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3606 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3608 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3610 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3612 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3614 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3616 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3618 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3620 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3622 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3624 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3626 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3628 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3630 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3632 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3634 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3636 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3638 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3640 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3642 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3644 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3646 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3648 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3650 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3652 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3654 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3656 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3658 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3660 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3662 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3664 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3666 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3668 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3670 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3672 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3674 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3676 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3678 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3680 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3682 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3684 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3686 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3688 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3690 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3692 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3694 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3696 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3698 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3700 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3702 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3704 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3706 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3708 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3710 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3712 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3714 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3716 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3718 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3720 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3722 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3724 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3726 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3728 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3730 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3732 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3734 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3736 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3738 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3740 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3742 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3744 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3746 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3748 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3750 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3752 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3754 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3756 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3758 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3760 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3762 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3764 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3766 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3768 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3770 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3772 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3774 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3776 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3778 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3780 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3782 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3784 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3786 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3788 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3790 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3792 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3794 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3796 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3798 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3800 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3802 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3804 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3806 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3808 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3810 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3812 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3814 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3816 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3818 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3820 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3822 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3824 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3826 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3828 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3830 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3832 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3834 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3836 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3838 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3840 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3842 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3844 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3846 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3848 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3850 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3852 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3854 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3856 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3858 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3860 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3862 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3864 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3866 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3868 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3870 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3872 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3874 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3876 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3878 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3880 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3882 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3884 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3886 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3888 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3890 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3892 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3894 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3896 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3898 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3900 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3902 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3904 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3906 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3908 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3910 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3912 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3914 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3916 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3918 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3920 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3922 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3924 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3926 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3928 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3930 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3932 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3934 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3936 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3938 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3940 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3942 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3944 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3946 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3948 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3950 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3952 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3954 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3956 ] = {   7, "\x16\x00\x00\x00\xff\xff\x02" },
-	[  3960 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  3962 ] = {   4, "\x0e\x00\x00\x00" },
-	[  3965 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  3967 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  3969 ] = {   4, "\x03\x00\x00\x00" },
-	[  3972 ] = {  34, "\x06\x00\x00\x00\x00\x00\x08\x00\x0a\x0a\x11\x11\xe6\xde\xe6\xe7\xf0\xee\xf0\xf0\x03\x00\x31\x00\x20\x00\x12\x00\x14\x00\xff\xff\x85\x00" },
-	[  3974 ] = {   6, "\x04\x00\x00\x00\x0a\x00" },
-	[  3976 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[  3978 ] = {   4, "\x0e\x00\x00\x00" },
-	[  3981 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  3983 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  3985 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  3987 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  3989 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  3991 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  3993 ] = {   4, "\x03\x00\x00\x00" },
-	[  3996 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  3998 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  4000 ] = {   4, "\x0e\x00\x00\x00" },
-	[  4003 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  4005 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  4007 ] = {   4, "\x03\x00\x00\x00" },
-	[  4009 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  4011 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  4013 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  4015 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  4017 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  4019 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4021 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4023 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4025 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4027 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4029 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4031 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4033 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4035 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4037 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4039 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4041 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4043 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4045 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4047 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4049 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4051 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4053 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4055 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4057 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4059 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4061 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4063 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4065 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4067 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4069 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4071 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4073 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4075 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4077 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4079 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4081 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4083 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4085 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4087 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4089 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4091 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4093 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4095 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4097 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4099 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4101 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4103 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4105 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4107 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4109 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4111 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4113 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4115 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4117 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4119 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4121 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4123 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4125 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4127 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4129 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4131 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4133 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4135 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4137 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4139 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4141 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4143 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4145 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4147 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4149 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4151 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4153 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4155 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4157 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4159 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4161 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4163 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4165 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4167 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4169 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4171 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4173 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4175 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4177 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4179 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4181 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4183 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4185 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4187 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4189 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4191 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4193 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4195 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4197 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4199 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4201 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4203 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4205 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4207 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4209 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4211 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4213 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4215 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4217 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4219 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4221 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4223 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4225 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4227 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4229 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4231 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4233 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4235 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4237 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4239 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4241 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4243 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4245 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4247 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4249 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4251 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4253 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4255 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4257 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4259 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4261 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4263 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4265 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4267 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4269 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4271 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4273 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4275 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4277 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4279 ] = {   7, "\x16\x00\x00\x00\xff\xff\x02" },
-	[  4283 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  4285 ] = {   4, "\x0e\x00\x00\x00" },
-	[  4288 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  4290 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  4292 ] = {   4, "\x03\x00\x00\x00" },
-	[  4295 ] = {  34, "\x06\x00\x00\x00\x00\x00\x08\x00\x0a\x0a\x12\x12\xe6\xde\xe6\xe7\xf0\xee\xf0\xf0\x03\x00\x31\x00\x20\x00\x12\x00\x14\x00\xff\xff\x85\x00" },
-	[  4297 ] = {   6, "\x04\x00\x00\x00\x0a\x00" },
-	[  4299 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[  4301 ] = {   4, "\x0e\x00\x00\x00" },
-	[  4304 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  4306 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  4308 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  4310 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  4312 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  4314 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  4316 ] = {   4, "\x03\x00\x00\x00" },
-	[  4319 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  4321 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  4323 ] = {   4, "\x0e\x00\x00\x00" },
-	[  4326 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  4328 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  4330 ] = {   4, "\x03\x00\x00\x00" },
-	[  4332 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  4334 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  4336 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  4338 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  4340 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  4342 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4344 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4346 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4348 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4350 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4352 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4354 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4356 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4358 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4360 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4362 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4364 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4366 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4368 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4370 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4372 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4374 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4376 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4378 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4380 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4382 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4384 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4386 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4388 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4390 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4392 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4394 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4396 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4398 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4400 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4402 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4404 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4406 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4408 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4410 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4412 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4414 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4416 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4418 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4420 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4422 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4424 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4426 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4428 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4430 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4432 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4434 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4436 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4438 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4440 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4442 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4444 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4446 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4448 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4450 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4452 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4454 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4456 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4458 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4460 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4462 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4464 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4466 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4468 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4470 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4472 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4474 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4476 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4478 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4480 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4482 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4484 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4486 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4488 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4490 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4492 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4494 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4496 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4498 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4500 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4502 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4504 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4506 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4508 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4510 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4512 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4514 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4516 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4518 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4520 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4522 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4524 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4526 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4528 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4530 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4532 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4534 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4536 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4538 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4540 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4542 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4544 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4546 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4548 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4550 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4552 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4554 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4556 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4558 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4560 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4562 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4564 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4566 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4568 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4570 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4572 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4574 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4576 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4578 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4580 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4582 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4584 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4586 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4588 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4590 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4592 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4594 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4596 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4598 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4600 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4602 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4604 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4606 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4608 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4610 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4612 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4614 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4616 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4618 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4620 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4622 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4624 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4626 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4628 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4630 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4632 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4634 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4636 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4638 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4640 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4642 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4714 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4716 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4718 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4720 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4722 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4724 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4726 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4728 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4730 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4732 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4734 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4736 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4738 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4740 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4742 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4744 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4746 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4748 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4750 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4752 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4754 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4756 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4758 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4760 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4762 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4764 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4766 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4768 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4770 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4772 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4774 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4776 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4778 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4780 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4782 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4784 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4786 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4788 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4790 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4792 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4794 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4796 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4798 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4800 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4802 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4804 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4806 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4808 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4810 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4812 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4814 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4816 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4818 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4820 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4822 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4824 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4826 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4828 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4830 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4832 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4834 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4836 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4838 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4840 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4842 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4844 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4846 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4848 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4850 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4852 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4854 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4856 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4858 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4860 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4862 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4864 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4866 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4868 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4870 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4872 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4874 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4876 ] = {   4, "\x0e\x00\x00\x00" },
-	[  4879 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  4881 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  4883 ] = {   4, "\x0e\x00\x00\x00" },
-	[  4887 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[  4889 ] = {   8, "\x12\x00\x00\x00\x00\x00\x57\x21" },
-	[  4891 ] = {   8, "\x12\x00\x00\x00\x9f\x29\x01\x00" },
-	[  4893 ] = {   8, "\x12\x00\x00\x00\xdb\xdb\xdb\xdb" },
-	[  4895 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[  4897 ] = {   8, "\x12\x00\x00\x00\x20\x49\xfb\xd4" },
-	[  4899 ] = {   6, "\x04\x00\x00\x00\x0a\x00" },
-	[  4901 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[  4903 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  4905 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  4907 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  4909 ] = {   6, "\x04\x00\x00\x00\x04\x00" },
-	[  4911 ] = {   6, "\x04\x00\x00\x00\xf4\x01" },
-	[  4913 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  4915 ] = {   4, "\x0e\x00\x00\x00" },
-	[  4918 ] = {   4, "\x03\x00\x00\x00" },
-	[  4921 ] = {   4, "\x0e\x00\x00\x00" },
-	[  4924 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[  4926 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[  4928 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[  4930 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[  4932 ] = {   6, "\x05\x00\x00\x00\x02\x00" },
-	[  4934 ] = {   6, "\x05\x00\x00\x00\x0b\x01" },
-	[  4936 ] = {   6, "\x05\x00\x00\x00\x0c\x01" },
-	[  4938 ] = {   6, "\x05\x00\x00\x00\x0d\x01" },
-	[  4940 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[  4942 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[  4944 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[  4946 ] = {   6, "\x05\x00\x00\x00\xb0\x04" },
-	[  4948 ] = {   6, "\x05\x00\x00\x00\x1b\x00" },
-	[  4950 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[  4952 ] = {   6, "\x05\x00\x03\x00\x01\x00" },
-	[  4954 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[  4956 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[  4958 ] = {   6, "\x05\x00\x00\x00\x04\x00" },
-	[  4960 ] = {   6, "\x05\x00\x00\x00\x0c\x01" },
-	[  4962 ] = {   6, "\x05\x00\x00\x00\x0d\x01" },
-	[  4964 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[  4966 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[  4968 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[  4970 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[  4972 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[  4974 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[  4976 ] = {   6, "\x05\x00\x00\x00\x46\x00" },
-	[  4978 ] = {   6, "\x05\x00\x03\x00\x46\x00" },
-	[  4980 ] = {   6, "\x05\x00\x00\x00\x0e\x01" },
-	[  4982 ] = {   6, "\x05\x00\x00\x00\x0f\x01" },
-	[  4984 ] = {   6, "\x05\x00\x00\x00\x04\x00" },
-	[  4986 ] = {   6, "\x05\x00\x00\x00\x03\x00" },
-	[  4988 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[  4990 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[  4992 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[  4994 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[  4996 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[  4998 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[  5000 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[  5002 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[  5004 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[  5006 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[  5008 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[  5010 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[  5012 ] = {   6, "\x05\x00\x03\x00\x01\x00" },
-	[  5014 ] = {   6, "\x05\x00\x00\x00\x10\x00" },
-	[  5016 ] = {   6, "\x05\x00\x00\x00\x05\x00" },
-	[  5018 ] = {   6, "\x05\x00\x00\x00\xf5\x00" },
-	[  5020 ] = {   6, "\x05\x00\x00\x00\x0c\x00" },
-	[  5022 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[  5024 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[  5026 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[  5028 ] = {   6, "\x05\x00\x00\x00\xb4\x00" },
-	[  5030 ] = {   6, "\x05\x00\x00\x00\x96\x00" },
-	[  5032 ] = {   6, "\x05\x00\x00\x00\x8c\x00" },
-	[  5034 ] = {   6, "\x05\x00\x00\x00\x64\x00" },
-	[  5036 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[  5038 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[  5040 ] = {   6, "\x05\x00\x00\x00\x20\x00" },
-	[  5042 ] = {   6, "\x05\x00\x00\x00\x64\x00" },
-	[  5044 ] = {   6, "\x05\x00\x00\x00\xc8\x00" },
-	[  5046 ] = {   6, "\x05\x00\x00\x00\xc8\x00" },
-	[  5048 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[  5050 ] = {   6, "\x05\x00\x00\x00\x1a\x01" },
-	[  5052 ] = {   6, "\x05\x00\x00\x00\x14\x00" },
-	[  5054 ] = {   6, "\x04\x00\x03\x00\x14\x00" },
-	[  5056 ] = {   6, "\x04\x00\x03\x00\x14\x00" },
-	[  5058 ] = {   6, "\x04\x00\x00\x00\x6f\x00" },
-	[  5060 ] = {   6, "\x04\x00\x03\x00\x6f\x00" },
-	[  5062 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[  5064 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[  5066 ] = {   9, "\x14\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[  5068 ] = {   6, "\x05\x00\x00\x00\x18\x01" },
-	[  5070 ] = {  34, "\x06\x00\x00\x00\x00\x00\x08\x00\x0a\x0a\x12\x12\xe6\xde\xe6\xe7\xf0\xee\xf0\xf0\x03\x00\x31\x00\x20\x00\x12\x00\x14\x00\xff\xff\x85\x00" },
-	[  5072 ] = {   6, "\x05\x00\x00\x00\xf5\x00" },
-	[  5074 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  5076 ] = {   6, "\x05\x00\x00\x00\x03\x00" },
-	[  5078 ] = {   6, "\x04\x00\x00\x00\xb4\x1e" },
-	[  5080 ] = {   6, "\x05\x00\x00\x00\x20\x03" },
-	[  5082 ] = {   4, "\x03\x00\x00\x00" },
-	[  5085 ] = {   6, "\x05\x00\x00\x00\xb4\x1e" },
-	[  5087 ] = {   8, "\x12\x00\x00\x00\xf0\xee\x00\x00" },
-	[  5089 ] = {   8, "\x12\x00\x00\x00\xf0\xef\x00\x00" },
-	[  5091 ] = {   4, "\x13\x00\x00\x00" },
-	[  5093 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[  5095 ] = {   4, "\x13\x00\x00\x00" },
-	[  5097 ] = {   8, "\x12\x00\x00\x00\xfb\x00\x00\x00" },
-	[  5099 ] = {   8, "\x12\x00\x00\x00\x03\x00\x00\x00" },
-	[  5101 ] = {   8, "\x12\x00\x00\x00\x10\x00\x00\x00" },
-	[  5103 ] = {   4, "\x13\x00\x00\x00" },
-	[  5105 ] = {   4, "\x03\x00\x00\x00" },
-	[  5108 ] = {   4, "\x13\x00\x00\x00" },
-	[  5110 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[  5112 ] = {   4, "\x13\x00\x00\x00" },
-	[  5114 ] = {   8, "\x12\x00\x00\x00\xfb\x00\x00\x00" },
-	[  5116 ] = {   8, "\x12\x00\x00\x00\x03\x00\x00\x00" },
-	[  5118 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[  5120 ] = {   4, "\x03\x00\x00\x00" },
-	[  5123 ] = {   8, "\x12\x00\x00\x00\x14\x00\x00\x00" },
-	[  5125 ] = {   8, "\x12\x00\x00\x00\xbc\x21\x00\x00" },
-	[  5127 ] = {   8, "\x12\x00\x00\x00\x31\x00\x00\x00" },
-	[  5129 ] = {   4, "\x13\x00\x00\x00" },
-	[  5131 ] = {   4, "\x13\x00\x00\x00" },
-	[  5133 ] = {   4, "\x13\x00\x00\x00" },
-	[  5135 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[  5137 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[  5139 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[  5141 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[  5143 ] = {   4, "\x03\x00\x00\x00" },
-	[  5146 ] = {   4, "\x13\x00\x00\x00" },
-	[  5148 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[  5150 ] = {   4, "\x13\x00\x00\x00" },
-	[  5152 ] = {   8, "\x12\x00\x00\x00\xfb\x00\x00\x00" },
-	[  5154 ] = {   8, "\x12\x00\x00\x00\x03\x00\x00\x00" },
-	[  5156 ] = {   8, "\x12\x00\x00\x00\x10\x00\x00\x00" },
-	[  5158 ] = {   4, "\x13\x00\x00\x00" },
-	[  5160 ] = {   4, "\x03\x00\x00\x00" },
-	[  5163 ] = {   4, "\x13\x00\x00\x00" },
-	[  5165 ] = {   4, "\x03\x00\x00\x00" },
-	[  5168 ] = {   4, "\x13\x00\x00\x00" },
-	[  5170 ] = {   4, "\x03\x00\x00\x00" },
-	[  5173 ] = {   4, "\x13\x00\x00\x00" },
-	[  5175 ] = {   4, "\x03\x00\x00\x00" },
-	[  5178 ] = {   4, "\x13\x00\x00\x00" },
-	[  5180 ] = {   4, "\x03\x00\x00\x00" },
-	[  5183 ] = {   4, "\x13\x00\x00\x00" },
-	[  5185 ] = {   4, "\x03\x00\x00\x00" },
-	[  5188 ] = {   4, "\x13\x00\x00\x00" },
-	[  5190 ] = {   4, "\x03\x00\x00\x00" },
-	[  5193 ] = {   4, "\x13\x00\x00\x00" },
-	[  5195 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[  5197 ] = {   4, "\x13\x00\x00\x00" },
-	[  5199 ] = {   8, "\x12\x00\x00\x00\xfb\x00\x00\x00" },
-	[  5201 ] = {   8, "\x12\x00\x00\x00\x03\x00\x00\x00" },
-	[  5203 ] = {   8, "\x12\x00\x00\x00\x10\x00\x00\x00" },
-	[  5205 ] = {   4, "\x13\x00\x00\x00" },
-	[  5207 ] = {   4, "\x03\x00\x00\x00" },
-	[  5210 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  5212 ] = {   6, "\x05\x00\x00\x00\x12\x00" },
-	[  5214 ] = {   6, "\x05\x00\x00\x00\xf0\x21" },
-	[  5216 ] = {   4, "\x13\x00\x00\x00" },
-	[  5218 ] = {   4, "\x13\x00\x00\x00" },
-	[  5220 ] = {   4, "\x13\x00\x00\x00" },
-	[  5222 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  5224 ] = {   4, "\x0e\x00\x00\x00" },
-	[  5227 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  5229 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[  5231 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  5233 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  5235 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  5237 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  5239 ] = {   4, "\x03\x00\x00\x00" },
-	[  5242 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  5244 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  5246 ] = {   4, "\x0e\x00\x00\x00" },
-	[  5249 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  5251 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  5253 ] = {   4, "\x03\x00\x00\x00" },
-	[  5255 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5257 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5259 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5261 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5263 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5265 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5267 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5269 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5271 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5273 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5275 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5277 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5279 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5281 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5283 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5285 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5287 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5289 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5291 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5293 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5295 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5297 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5299 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5301 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5303 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5305 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5307 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5309 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5311 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5313 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5315 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5317 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5319 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5321 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5323 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5325 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5327 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5329 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5331 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5333 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5335 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5337 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5339 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5341 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5343 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5345 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5347 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5349 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5351 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5353 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5355 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5357 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5359 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5361 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5363 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5365 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5367 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5369 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5371 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5373 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5375 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5377 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5379 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5381 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5383 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5385 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5387 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5389 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5391 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5393 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5395 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5397 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5399 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5401 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5403 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5405 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5407 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5409 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5411 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5413 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5415 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5417 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5419 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5421 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5423 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5425 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5427 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5429 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5431 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5433 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5435 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5437 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5439 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5441 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5443 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5445 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5447 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5449 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5451 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5453 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5455 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5457 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5459 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5461 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5463 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5465 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5467 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5469 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5471 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5473 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5475 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5477 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5479 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5481 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5483 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5485 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5487 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5489 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5491 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5493 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5495 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5497 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5499 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5501 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5503 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5505 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5507 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5509 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5511 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5513 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5515 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5517 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5519 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5521 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5523 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5525 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5527 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5529 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5531 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5533 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5535 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5537 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5539 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5541 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5543 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5545 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5547 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5549 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5551 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5553 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5555 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5557 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5559 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5561 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5563 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5565 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5567 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5569 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5571 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5573 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5575 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5577 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5579 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5581 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5583 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5585 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5587 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5589 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5591 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5593 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5595 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5597 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5599 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5601 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5603 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5605 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5607 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5609 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5611 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5613 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5615 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5617 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5619 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5621 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5623 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5625 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5627 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5629 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5631 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5633 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5635 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5637 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5639 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5641 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5643 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5645 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5647 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5649 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5651 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5653 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5655 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5657 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5659 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5661 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5663 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5665 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5667 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5669 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5671 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5673 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5675 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5677 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5679 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5681 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5683 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5685 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5687 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5689 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5691 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5693 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5695 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5697 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5699 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5701 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5703 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5705 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5707 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5709 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5711 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5713 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5715 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5717 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5719 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5721 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5723 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5725 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5727 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5729 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5731 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5733 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5735 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5737 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5739 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5741 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5743 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5745 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5747 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5749 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5751 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5753 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5755 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5757 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5759 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5761 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5763 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5765 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5767 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5769 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5771 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5773 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5775 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5777 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5779 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5781 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5783 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5785 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5787 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5789 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5791 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5793 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5795 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5797 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5799 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5801 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5803 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5805 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5807 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5809 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5811 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5813 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5815 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5817 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5819 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5821 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5823 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5825 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5827 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5829 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5831 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5833 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5835 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5837 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5839 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5841 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5843 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5845 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5847 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5849 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5851 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5853 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5855 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5857 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5859 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5861 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5863 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5865 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5867 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5869 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5871 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5873 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5875 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5877 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5879 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5881 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5883 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5885 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5887 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5889 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5891 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5893 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5895 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5897 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5899 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5901 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5903 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5905 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5907 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5909 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5911 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5913 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5915 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5917 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5919 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5921 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5923 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5925 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5927 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5929 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5931 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5933 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5935 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5937 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5939 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5941 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5943 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5945 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5947 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5949 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5951 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5953 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5955 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5957 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5959 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5961 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5963 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5965 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5967 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5969 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5971 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5973 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5975 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5977 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5979 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5981 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5983 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5985 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5987 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5989 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5991 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5993 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5995 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5997 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  5999 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6001 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6003 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6005 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6007 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6009 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6011 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6013 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6015 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6017 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6019 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6021 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6023 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6025 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6027 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6029 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6031 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6033 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6035 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6037 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6039 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6041 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6043 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6045 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6047 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6049 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6051 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6053 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6055 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6057 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6059 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6061 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6063 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6065 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6067 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6069 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6071 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6073 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6075 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6077 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6079 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6081 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6083 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6085 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6087 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6089 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6091 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6093 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6095 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6097 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6099 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6101 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6103 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6105 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6107 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6109 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6111 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6113 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6115 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6117 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6119 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6121 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6123 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6125 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6127 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6129 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6131 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6133 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6135 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6137 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6139 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6141 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6143 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6145 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6147 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6149 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6151 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6153 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6155 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6157 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6159 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6161 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6163 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6165 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6167 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6169 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6171 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6173 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6175 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6177 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6179 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6181 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6183 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6185 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6187 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6189 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6191 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6193 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6195 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6197 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6199 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6201 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6203 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6205 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6207 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6209 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6211 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6213 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6215 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6217 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6219 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6221 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6223 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6225 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6227 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6229 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6231 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6233 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6235 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6237 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6239 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6241 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6243 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6245 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6247 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6249 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6251 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6253 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6255 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6257 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6259 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6261 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6263 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6265 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6267 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6269 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6271 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6273 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6275 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6277 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6279 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6281 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6283 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6285 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6287 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6289 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6291 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6293 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6295 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6297 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6299 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6301 ] = {   7, "\x16\x00\x00\x00\xff\xff\x02" },
-	[  6305 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  6307 ] = {   4, "\x0e\x00\x00\x00" },
-	[  6310 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  6312 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  6314 ] = {   4, "\x03\x00\x00\x00" },
-	[  6317 ] = {  34, "\x06\x00\x00\x00\x00\x00\x08\x00\x0a\x0a\x12\x12\xe6\xdd\xe6\xe5\xf0\xee\xf0\xf0\x03\x00\x31\x00\x20\x00\x12\x00\x14\x00\xff\xff\x85\x00" },
-	[  6319 ] = {   6, "\x04\x00\x00\x00\x0a\x00" },
-	[  6321 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[  6323 ] = {   4, "\x0e\x00\x00\x00" },
-	[  6326 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  6328 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  6330 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  6332 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  6334 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  6336 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  6338 ] = {   4, "\x03\x00\x00\x00" },
-	[  6341 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  6343 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  6345 ] = {   4, "\x0e\x00\x00\x00" },
-	[  6348 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  6350 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  6352 ] = {   4, "\x03\x00\x00\x00" },
-	[  6354 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  6356 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  6358 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  6360 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  6362 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  6364 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6366 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6368 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6370 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6372 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6374 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6376 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6378 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6380 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6382 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6384 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6386 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6388 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6390 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6392 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6394 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6396 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6398 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6400 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6402 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6404 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6406 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6408 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6410 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6412 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6414 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6416 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6418 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6420 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6422 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6424 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6426 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6428 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6430 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6432 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6434 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6436 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6438 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6440 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6442 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6444 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6446 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6448 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6450 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6452 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6454 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6456 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6458 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6460 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6462 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6464 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6466 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6468 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6470 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6472 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6474 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6476 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6478 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6480 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6482 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6484 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6486 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6488 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6490 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6492 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6494 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6496 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6498 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6500 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6502 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6504 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6506 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6508 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6510 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6512 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6514 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6516 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6518 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6520 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6522 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6524 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6526 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6528 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6530 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6532 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6534 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6536 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6538 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6540 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6542 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6544 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6546 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6548 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6550 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6552 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6554 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6556 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6558 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6560 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6562 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6564 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6566 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6568 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6570 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6572 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6574 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6576 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6578 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6580 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6582 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6584 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6586 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6588 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6590 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6592 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6594 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6596 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6598 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6600 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6602 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6604 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6606 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6608 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6610 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6612 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6614 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6616 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6618 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6620 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6622 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6624 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6626 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6628 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6630 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6632 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6634 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6636 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6638 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6640 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6642 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6644 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6646 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6648 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6650 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6652 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6654 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6656 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6658 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6660 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6662 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6664 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6666 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6668 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6670 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6672 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6674 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6676 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6678 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6680 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6682 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6684 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6686 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6688 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6690 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6692 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6694 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6696 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6698 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6700 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6702 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6704 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6706 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6708 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6710 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6712 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6714 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6716 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6718 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6720 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6722 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6724 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6726 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6728 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6730 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6732 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6734 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6736 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6738 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6740 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6742 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6744 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6746 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6748 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6750 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6752 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6754 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6756 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6758 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6760 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6762 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6764 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6766 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6768 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6770 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6772 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6774 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6776 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6778 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6780 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6782 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6784 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6786 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6788 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6790 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6792 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6794 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6796 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6798 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6800 ] = {   7, "\x16\x00\x00\x00\xff\xff\x02" },
-	[  6804 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  6806 ] = {   4, "\x0e\x00\x00\x00" },
-	[  6809 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  6811 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  6813 ] = {   4, "\x03\x00\x00\x00" },
-	[  6816 ] = {  34, "\x06\x00\x00\x00\x00\x00\x08\x00\x0a\x0a\x12\x12\xe6\xde\xe6\xe7\xf0\xee\xf0\xef\x03\x00\x31\x00\x20\x00\x12\x00\x14\x00\xff\xff\x85\x00" },
-	[  6818 ] = {   6, "\x04\x00\x00\x00\x0a\x00" },
-	[  6820 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[  6822 ] = {   4, "\x0e\x00\x00\x00" },
-	[  6825 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  6827 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  6829 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  6831 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  6833 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  6835 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  6837 ] = {   4, "\x03\x00\x00\x00" },
-	[  6840 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  6842 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  6844 ] = {   4, "\x0e\x00\x00\x00" },
-	[  6847 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  6849 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  6851 ] = {   4, "\x03\x00\x00\x00" },
-	[  6853 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  6855 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  6857 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  6859 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  6861 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  6863 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6865 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6867 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6869 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6871 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6873 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6875 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6877 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6879 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6881 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6883 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6885 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6887 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6889 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6891 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6893 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6895 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6897 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6899 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6901 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6903 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6905 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6907 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6909 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6911 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6913 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6915 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6917 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6919 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6921 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6923 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6925 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6927 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6929 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6931 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6933 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6935 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6937 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6939 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6941 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6943 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6945 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6947 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6949 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6951 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6953 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6955 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6957 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6959 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6961 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6963 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6965 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6967 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6969 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6971 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6973 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6975 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6977 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6979 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6981 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6983 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6985 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6987 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6989 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6991 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6993 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6995 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6997 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  6999 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7001 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7003 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7005 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7007 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7009 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7011 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7013 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7015 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7017 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7019 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7021 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7023 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7025 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7027 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7029 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7031 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7033 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7035 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7037 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7039 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7041 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7043 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7045 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7047 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7049 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7051 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7053 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7055 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7057 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7059 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7061 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7063 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7065 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7067 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7069 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7071 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7073 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7075 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7077 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7079 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7081 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7083 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7085 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7087 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7089 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7091 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7093 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7095 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7097 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7099 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7101 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7103 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7105 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7107 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7109 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7111 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7113 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7115 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7117 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7119 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7121 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7123 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7125 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7127 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7129 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7131 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7133 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7135 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7137 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7139 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7141 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7143 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7145 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7147 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7149 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7151 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7153 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7155 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7157 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7159 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7161 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7163 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7165 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7167 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7169 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7171 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7173 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7175 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7177 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7179 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7181 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7183 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7185 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7187 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7189 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7191 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7193 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7195 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7197 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7199 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7201 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7203 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7205 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7207 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7209 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7211 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7213 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7215 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7217 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7219 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7221 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  7223 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	}
-};
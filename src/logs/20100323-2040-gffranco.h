@@ -1,6194 +0,0 @@
-int GFF_unchecked (struct vfs_dev *dev)
-{
-	_(  Peek (dev, 0x00001fe8, 0x04));
-	_(  Peek (dev, 0x00001fec, 0x04));
-	_(  Peek (dev, 0x00001ff0, 0x04));
-	_(  Peek (dev, 0x00001ff4, 0x04));
-	_(  Peek (dev, 0x00001ff8, 0x04));
-	_(  Peek (dev, 0x00001ffc, 0x04));
-	_(  GetParam (dev, 0x002e));
-	_(  GetVersion (dev));
-	_(  GetParam (dev, 0x0028));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0011));
-	_(  GetParam (dev, 0x0054));
-	_(  GetParam (dev, 0x0001));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetPrint (dev, 0x0001, type_0));
-	_(  LoadImage (dev));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0004, 0x0000));
-	_(  SetParam (dev, 0x0005, 0x0000));
-	_(  SetParam (dev, 0x0006, 0x0000));
-	_(  SetParam (dev, 0x0007, 0x0000));
-	_(  SetParam (dev, 0x000a, 0x0002));
-	_(  SetParam (dev, 0x000b, 0x010b));
-	_(  SetParam (dev, 0x000c, 0x010c));
-	_(  SetParam (dev, 0x000d, 0x010d));
-	_(  SetParam (dev, 0x000e, 0x0001));
-	_(  SetParam (dev, 0x0010, 0x0000));
-	_(  SetParam (dev, 0x0012, 0x0040));
-	_(  SetParam (dev, 0x0015, 0x04b0));
-	_(  SetParam (dev, 0x0016, 0x001b));
-	_(  SetParam (dev, 0x0017, 0x0001));
-	_(  SetParam (dev, 0x0018, 0x0003));
-	_(  SetParam (dev, 0x0019, 0x0001));
-	_(  SetParam (dev, 0x001a, 0x0000));
-	_(  SetParam (dev, 0x001b, 0x0004));
-	_(  SetParam (dev, 0x001d, 0x010c));
-	_(  SetParam (dev, 0x001e, 0x010d));
-	_(  SetParam (dev, 0x001f, 0x0000));
-	_(  SetParam (dev, 0x0020, 0x0000));
-	_(  SetParam (dev, 0x0021, 0x0001));
-	_(  SetParam (dev, 0x0022, 0x0001));
-	_(  SetParam (dev, 0x0023, 0x0001));
-	_(  SetParam (dev, 0x0024, 0x0000));
-	_(  SetParam (dev, 0x002c, 0x0046));
-	_(  SetParam (dev, 0x002d, 0x002a));
-	_(  SetParam (dev, 0x002f, 0x010e));
-	_(  SetParam (dev, 0x0030, 0x010f));
-	_(  SetParam (dev, 0x0032, 0x0004));
-	_(  SetParam (dev, 0x0033, 0x0003));
-	_(  SetParam (dev, 0x0034, 0x0005));
-	_(  SetParam (dev, 0x0035, 0x0010));
-	_(  SetParam (dev, 0x0036, 0x000a));
-	_(  SetParam (dev, 0x0037, 0x0018));
-	_(  SetParam (dev, 0x0038, 0x001e));
-	_(  SetParam (dev, 0x0039, 0x00b2));
-	_(  SetParam (dev, 0x003a, 0x0080));
-	_(  SetParam (dev, 0x003b, 0x0000));
-	_(  SetParam (dev, 0x003e, 0x01f4));
-	_(  SetParam (dev, 0x003f, 0x001a));
-	_(  SetParam (dev, 0x0040, 0x00f8));
-	_(  SetParam (dev, 0x0042, 0x0001));
-	_(  SetParam (dev, 0x0043, 0x0004));
-	_(  SetParam (dev, 0x0044, 0x0010));
-	_(  SetParam (dev, 0x0045, 0x0005));
-	_(  SetParam (dev, 0x0046, 0x00f5));
-	_(  SetParam (dev, 0x0047, 0x000c));
-	_(  SetParam (dev, 0x0048, 0x0000));
-	_(  SetParam (dev, 0x0049, 0x0000));
-	_(  SetParam (dev, 0x0053, 0x0000));
-	_(  SetParam (dev, 0x0056, 0x00b4));
-	_(  SetParam (dev, 0x0057, 0x0096));
-	_(  SetParam (dev, 0x0058, 0x008c));
-	_(  SetParam (dev, 0x0059, 0x0064));
-	_(  SetParam (dev, 0x005b, 0x0001));
-	_(  SetParam (dev, 0x005c, 0x0001));
-	_(  SetParam (dev, 0x005d, 0x0020));
-	_(  SetParam (dev, 0x005e, 0x0064));
-	_(  SetParam (dev, 0x005f, 0x00c8));
-	_(  SetParam (dev, 0x0060, 0x00c8));
-	_(  SetParam (dev, 0x0062, 0x0000));
-	_(  SetParam (dev, 0x0064, 0x011a));
-	_(  SetParam (dev, 0x0069, 0x0014));
-	_(  GetParam (dev, 0x002a));
-	_(  GetParam (dev, 0x003c));
-	_(  GetParam (dev, 0x004a));
-	_(  GetParam (dev, 0x0041));
-	_(  GetVersion (dev));
-	_(  SetParam (dev, 0x0063, 0x0001));
-	_(  SensorSpiTrans (dev, 0x05, 0x00, 0xab, 0x00, 0x00, 0x00, 0x00));
-	_(  SetParam (dev, 0x0064, 0x0118));
-	_(  GetConfig (dev));
-	_(  SetParam (dev, 0x0046, 0x00f5));
-	_(  SetParam (dev, 0x006d, 0x0032));
-	_(  GetVersion (dev));
-	_(  SetParam (dev, 0x006e, 0x0003));
-	_(  GetParam (dev, 0x0052));
-	_(  SetParam (dev, 0x0052, 0x0320));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  GetPrint (dev, 0x0001, type_2));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0052, 0x1eb4));
-	_(  Peek (dev, 0x00ff502c, 0x02));
-	_(  Peek (dev, 0x00ff502e, 0x02));
-	_(  Poke (dev, 0x000005f6, 0x00000001, 0x01));
-	_(  Peek (dev, 0x00ff503e, 0x01));
-	_(  Poke (dev, 0x00ff503e, 0x00000000, 0x01));
-	_(  Peek (dev, 0x00ff9802, 0x01));
-	_(  Peek (dev, 0x00ff9800, 0x01));
-	_(  Peek (dev, 0x00ff9806, 0x01));
-	_(  Poke (dev, 0x00ff9806, 0x00000000, 0x01));
-	_(  GetPrint (dev, 0x0064, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x000005f6, 0x00000000, 0x01));
-	_(  Peek (dev, 0x00ff503e, 0x01));
-	_(  Poke (dev, 0x00ff503e, 0x00000010, 0x01));
-	_(  Peek (dev, 0x00ff9802, 0x01));
-	_(  Peek (dev, 0x00ff9800, 0x01));
-	_(  Peek (dev, 0x00ff9806, 0x01));
-	_(  GetPrint (dev, 0x0064, type_0));
-	_(  LoadImage (dev));
-	_(  Peek (dev, 0x00ff5038, 0x01));
-	_(  Peek (dev, 0x00ff500e, 0x02));
-	_(  Peek (dev, 0x00ff5032, 0x01));
-	_(  Poke (dev, 0x00ff5032, 0x00000012, 0x01));
-	_(  Poke (dev, 0x00ff500e, 0x00004000, 0x02));
-	_(  Poke (dev, 0x00ff5038, 0x0000000f, 0x01));
-	_(  SetParam (dev, 0x0062, 0x0000));
-	_(  SetParam (dev, 0x0077, 0x0000));
-	_(  SetParam (dev, 0x0076, 0x0000));
-	_(  SetParam (dev, 0x0078, 0x0000));
-	_(  GetPrint (dev, 0x0002, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x000005f6, 0x00000001, 0x01));
-	_(  Peek (dev, 0x00ff503e, 0x01));
-	_(  Poke (dev, 0x00ff503e, 0x00000000, 0x01));
-	_(  Peek (dev, 0x00ff9802, 0x01));
-	_(  Peek (dev, 0x00ff9800, 0x01));
-	_(  Peek (dev, 0x00ff9806, 0x01));
-	_(  Poke (dev, 0x00ff5038, 0x0000000e, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x00ff5038, 0x0000000d, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x00ff5038, 0x0000000c, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x00ff5038, 0x0000000b, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x00ff5038, 0x0000000a, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x00ff5038, 0x00000009, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x00ff5038, 0x00000008, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x000005f6, 0x00000000, 0x01));
-	_(  Peek (dev, 0x00ff503e, 0x01));
-	_(  Poke (dev, 0x00ff503e, 0x00000010, 0x01));
-	_(  Peek (dev, 0x00ff9802, 0x01));
-	_(  Peek (dev, 0x00ff9800, 0x01));
-	_(  Peek (dev, 0x00ff9806, 0x01));
-	_(  Poke (dev, 0x00ff9806, 0x00000000, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0077, 0x0008));
-	_(  SetParam (dev, 0x0076, 0x0012));
-	_(  SetParam (dev, 0x0078, 0x21f0));
-	_(  Poke (dev, 0x00ff5038, 0x00000014, 0x01));
-	_(  Poke (dev, 0x00ff500e, 0x000021c0, 0x02));
-	_(  Poke (dev, 0x00ff5032, 0x00000031, 0x01));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x1388, type_1));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetConfig (dev));
-	_(  GetParam (dev, 0x002e));
-	_(  GetVersion (dev));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, 0x0062, 0x0032));
-	_(  GetPrint (dev, 0x1388, type_1));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetVersion (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	_(  GetFingerState (dev));
-	return 0;
-}
-int GFF_checked (struct vfs_dev *dev)
-{
-	__(    8,    Peek (dev, 0x00001fe8, 0x04));
-	__(   10,    Peek (dev, 0x00001fec, 0x04));
-	__(   12,    Peek (dev, 0x00001ff0, 0x04));
-	__(   14,    Peek (dev, 0x00001ff4, 0x04));
-	__(   16,    Peek (dev, 0x00001ff8, 0x04));
-	__(   18,    Peek (dev, 0x00001ffc, 0x04));
-	__(   20,    GetParam (dev, 0x002e));
-	__(   22,    GetVersion (dev));
-	__(   24,    GetParam (dev, 0x0028));
-	__(   26,    GetParam (dev, 0x0014));
-	__(   28,    GetParam (dev, 0x0014));
-	__(   30,    GetParam (dev, 0x0011));
-	__(   32,    GetParam (dev, 0x0054));
-	__(   34,    GetParam (dev, 0x0001));
-	__(   36,    GetParam (dev, 0x0014));
-	__(   38,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__(   41,    GetPrint (dev, 0x0001, type_0));
-	 _(          LoadImage (dev));
-	__(   45,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__(   48,    SetParam (dev, 0x0004, 0x0000));
-	__(   50,    SetParam (dev, 0x0005, 0x0000));
-	__(   52,    SetParam (dev, 0x0006, 0x0000));
-	__(   54,    SetParam (dev, 0x0007, 0x0000));
-	__(   56,    SetParam (dev, 0x000a, 0x0002));
-	__(   58,    SetParam (dev, 0x000b, 0x010b));
-	__(   60,    SetParam (dev, 0x000c, 0x010c));
-	__(   62,    SetParam (dev, 0x000d, 0x010d));
-	__(   64,    SetParam (dev, 0x000e, 0x0001));
-	__(   66,    SetParam (dev, 0x0010, 0x0000));
-	__(   68,    SetParam (dev, 0x0012, 0x0040));
-	__(   70,    SetParam (dev, 0x0015, 0x04b0));
-	__(   72,    SetParam (dev, 0x0016, 0x001b));
-	__(   74,    SetParam (dev, 0x0017, 0x0001));
-	__(   76,    SetParam (dev, 0x0018, 0x0003));
-	__(   78,    SetParam (dev, 0x0019, 0x0001));
-	__(   80,    SetParam (dev, 0x001a, 0x0000));
-	__(   82,    SetParam (dev, 0x001b, 0x0004));
-	__(   84,    SetParam (dev, 0x001d, 0x010c));
-	__(   86,    SetParam (dev, 0x001e, 0x010d));
-	__(   88,    SetParam (dev, 0x001f, 0x0000));
-	__(   90,    SetParam (dev, 0x0020, 0x0000));
-	__(   92,    SetParam (dev, 0x0021, 0x0001));
-	__(   94,    SetParam (dev, 0x0022, 0x0001));
-	__(   96,    SetParam (dev, 0x0023, 0x0001));
-	__(   98,    SetParam (dev, 0x0024, 0x0000));
-	__(  100,    SetParam (dev, 0x002c, 0x0046));
-	__(  102,    SetParam (dev, 0x002d, 0x002a));
-	__(  104,    SetParam (dev, 0x002f, 0x010e));
-	__(  106,    SetParam (dev, 0x0030, 0x010f));
-	__(  108,    SetParam (dev, 0x0032, 0x0004));
-	__(  110,    SetParam (dev, 0x0033, 0x0003));
-	__(  112,    SetParam (dev, 0x0034, 0x0005));
-	__(  114,    SetParam (dev, 0x0035, 0x0010));
-	__(  116,    SetParam (dev, 0x0036, 0x000a));
-	__(  118,    SetParam (dev, 0x0037, 0x0018));
-	__(  120,    SetParam (dev, 0x0038, 0x001e));
-	__(  122,    SetParam (dev, 0x0039, 0x00b2));
-	__(  124,    SetParam (dev, 0x003a, 0x0080));
-	__(  126,    SetParam (dev, 0x003b, 0x0000));
-	__(  128,    SetParam (dev, 0x003e, 0x01f4));
-	__(  130,    SetParam (dev, 0x003f, 0x001a));
-	__(  132,    SetParam (dev, 0x0040, 0x00f8));
-	__(  134,    SetParam (dev, 0x0042, 0x0001));
-	__(  136,    SetParam (dev, 0x0043, 0x0004));
-	__(  138,    SetParam (dev, 0x0044, 0x0010));
-	__(  140,    SetParam (dev, 0x0045, 0x0005));
-	__(  142,    SetParam (dev, 0x0046, 0x00f5));
-	__(  144,    SetParam (dev, 0x0047, 0x000c));
-	__(  146,    SetParam (dev, 0x0048, 0x0000));
-	__(  148,    SetParam (dev, 0x0049, 0x0000));
-	__(  150,    SetParam (dev, 0x0053, 0x0000));
-	__(  152,    SetParam (dev, 0x0056, 0x00b4));
-	__(  154,    SetParam (dev, 0x0057, 0x0096));
-	__(  156,    SetParam (dev, 0x0058, 0x008c));
-	__(  158,    SetParam (dev, 0x0059, 0x0064));
-	__(  160,    SetParam (dev, 0x005b, 0x0001));
-	__(  162,    SetParam (dev, 0x005c, 0x0001));
-	__(  164,    SetParam (dev, 0x005d, 0x0020));
-	__(  166,    SetParam (dev, 0x005e, 0x0064));
-	__(  168,    SetParam (dev, 0x005f, 0x00c8));
-	__(  170,    SetParam (dev, 0x0060, 0x00c8));
-	__(  172,    SetParam (dev, 0x0062, 0x0000));
-	__(  174,    SetParam (dev, 0x0064, 0x011a));
-	__(  176,    SetParam (dev, 0x0069, 0x0014));
-	__(  178,    GetParam (dev, 0x002a));
-	__(  180,    GetParam (dev, 0x003c));
-	__(  182,    GetParam (dev, 0x004a));
-	__(  184,    GetParam (dev, 0x0041));
-	__(  186,    GetVersion (dev));
-	__(  188,    SetParam (dev, 0x0063, 0x0001));
-	__(  190,    SensorSpiTrans (dev, 0x05, 0x00, 0xab, 0x00, 0x00, 0x00, 0x00));
-	__(  192,    SetParam (dev, 0x0064, 0x0118));
-	__(  194,    GetConfig (dev));
-	__(  196,    SetParam (dev, 0x0046, 0x00f5));
-	__(  198,    SetParam (dev, 0x006d, 0x0032));
-	__(  200,    GetVersion (dev));
-	__(  202,    SetParam (dev, 0x006e, 0x0003));
-	__(  204,    GetParam (dev, 0x0052));
-	__(  206,    SetParam (dev, 0x0052, 0x0320));
-	__(  208,    SetParam (dev, 0x0055, 0x0008));
-	__(  210,    GetPrint (dev, 0x0001, type_2));
-	 _(          LoadImage (dev));
-	__(  214,    SetParam (dev, 0x0052, 0x1eb4));
-	__(  216,    Peek (dev, 0x00ff502c, 0x02));
-	__(  218,    Peek (dev, 0x00ff502e, 0x02));
-	__(  220,    Poke (dev, 0x000005f6, 0x00000001, 0x01));
-	__(  222,    Peek (dev, 0x00ff503e, 0x01));
-	__(  224,    Poke (dev, 0x00ff503e, 0x00000000, 0x01));
-	__(  226,    Peek (dev, 0x00ff9802, 0x01));
-	__(  228,    Peek (dev, 0x00ff9800, 0x01));
-	__(  230,    Peek (dev, 0x00ff9806, 0x01));
-	__(  232,    Poke (dev, 0x00ff9806, 0x00000000, 0x01));
-	__(  234,    GetPrint (dev, 0x0064, type_0));
-	 _(          LoadImage (dev));
-	__(  238,    Poke (dev, 0x000005f6, 0x00000000, 0x01));
-	__(  240,    Peek (dev, 0x00ff503e, 0x01));
-	__(  242,    Poke (dev, 0x00ff503e, 0x00000010, 0x01));
-	__(  244,    Peek (dev, 0x00ff9802, 0x01));
-	__(  246,    Peek (dev, 0x00ff9800, 0x01));
-	__(  248,    Peek (dev, 0x00ff9806, 0x01));
-	__(  250,    GetPrint (dev, 0x0064, type_0));
-	 _(          LoadImage (dev));
-	__(  254,    Peek (dev, 0x00ff5038, 0x01));
-	__(  256,    Peek (dev, 0x00ff500e, 0x02));
-	__(  258,    Peek (dev, 0x00ff5032, 0x01));
-	__(  260,    Poke (dev, 0x00ff5032, 0x00000012, 0x01));
-	__(  262,    Poke (dev, 0x00ff500e, 0x00004000, 0x02));
-	__(  264,    Poke (dev, 0x00ff5038, 0x0000000f, 0x01));
-	__(  266,    SetParam (dev, 0x0062, 0x0000));
-	__(  268,    SetParam (dev, 0x0077, 0x0000));
-	__(  270,    SetParam (dev, 0x0076, 0x0000));
-	__(  272,    SetParam (dev, 0x0078, 0x0000));
-	__(  274,    GetPrint (dev, 0x0002, type_0));
-	 _(          LoadImage (dev));
-	__(  278,    Poke (dev, 0x000005f6, 0x00000001, 0x01));
-	__(  280,    Peek (dev, 0x00ff503e, 0x01));
-	__(  282,    Poke (dev, 0x00ff503e, 0x00000000, 0x01));
-	__(  284,    Peek (dev, 0x00ff9802, 0x01));
-	__(  286,    Peek (dev, 0x00ff9800, 0x01));
-	__(  288,    Peek (dev, 0x00ff9806, 0x01));
-	__(  290,    Poke (dev, 0x00ff5038, 0x0000000e, 0x01));
-	__(  292,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__(  296,    Poke (dev, 0x00ff5038, 0x0000000d, 0x01));
-	__(  298,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__(  302,    Poke (dev, 0x00ff5038, 0x0000000c, 0x01));
-	__(  304,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__(  308,    Poke (dev, 0x00ff5038, 0x0000000b, 0x01));
-	__(  310,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__(  314,    Poke (dev, 0x00ff5038, 0x0000000a, 0x01));
-	__(  316,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__(  320,    Poke (dev, 0x00ff5038, 0x00000009, 0x01));
-	__(  322,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__(  326,    Poke (dev, 0x00ff5038, 0x00000008, 0x01));
-	__(  328,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__(  332,    Poke (dev, 0x000005f6, 0x00000000, 0x01));
-	__(  334,    Peek (dev, 0x00ff503e, 0x01));
-	__(  336,    Poke (dev, 0x00ff503e, 0x00000010, 0x01));
-	__(  338,    Peek (dev, 0x00ff9802, 0x01));
-	__(  340,    Peek (dev, 0x00ff9800, 0x01));
-	__(  342,    Peek (dev, 0x00ff9806, 0x01));
-	__(  344,    Poke (dev, 0x00ff9806, 0x00000000, 0x01));
-	__(  346,    GetPrint (dev, 0x000a, type_0));
-	 _(          LoadImage (dev));
-	__(  350,    SetParam (dev, 0x0077, 0x0008));
-	__(  352,    SetParam (dev, 0x0076, 0x0012));
-	__(  354,    SetParam (dev, 0x0078, 0x21f0));
-	__(  356,    Poke (dev, 0x00ff5038, 0x00000014, 0x01));
-	__(  358,    Poke (dev, 0x00ff500e, 0x000021c0, 0x02));
-	__(  360,    Poke (dev, 0x00ff5032, 0x00000031, 0x01));
-	__(  362,    SetParam (dev, 0x0062, 0x0032));
-	__(  364,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__(  367,    SetParam (dev, 0x0062, 0x0032));
-	__(  369,    GetParam (dev, 0x0014));
-	__(  371,    GetParam (dev, 0x0011));
-	__(  373,    SetParam (dev, 0x0062, 0x0032));
-	__(  375,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__(  379,    GetParam (dev, 0x0014));
-	__(  381,    GetParam (dev, 0x0014));
-	__(  383,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__(  386,    GetParam (dev, 0x0011));
-	__(  388,    SetParam (dev, 0x0062, 0x0032));
-	__(  390,    GetPrint (dev, 0x1388, type_1));
-	__(  392,    GetFingerState (dev));
-	__(  394,    GetFingerState (dev));
-	__(  396,    GetFingerState (dev));
-	__(  398,    GetFingerState (dev));
-	__(  400,    GetFingerState (dev));
-	__(  402,    GetFingerState (dev));
-	__(  404,    GetFingerState (dev));
-	__(  406,    GetFingerState (dev));
-	__(  408,    GetFingerState (dev));
-	__(  410,    GetFingerState (dev));
-	__(  412,    GetFingerState (dev));
-	__(  414,    GetFingerState (dev));
-	__(  416,    GetFingerState (dev));
-	__(  418,    GetFingerState (dev));
-	__(  420,    GetFingerState (dev));
-	__(  422,    GetFingerState (dev));
-	__(  424,    GetFingerState (dev));
-	__(  426,    GetFingerState (dev));
-	__(  428,    GetFingerState (dev));
-	__(  430,    GetFingerState (dev));
-	__(  432,    GetFingerState (dev));
-	__(  434,    GetFingerState (dev));
-	__(  436,    GetFingerState (dev));
-	__(  438,    GetFingerState (dev));
-	__(  440,    GetFingerState (dev));
-	__(  442,    GetFingerState (dev));
-	__(  444,    GetFingerState (dev));
-	__(  446,    GetFingerState (dev));
-	__(  448,    GetFingerState (dev));
-	__(  450,    GetFingerState (dev));
-	__(  452,    GetFingerState (dev));
-	__(  454,    GetFingerState (dev));
-	__(  456,    GetFingerState (dev));
-	__(  458,    GetFingerState (dev));
-	__(  460,    GetFingerState (dev));
-	__(  462,    GetFingerState (dev));
-	__(  464,    GetFingerState (dev));
-	__(  466,    GetFingerState (dev));
-	__(  468,    GetFingerState (dev));
-	__(  470,    GetFingerState (dev));
-	__(  472,    GetFingerState (dev));
-	__(  474,    GetFingerState (dev));
-	__(  476,    GetFingerState (dev));
-	__(  478,    GetFingerState (dev));
-	__(  480,    GetFingerState (dev));
-	__(  482,    GetFingerState (dev));
-	__(  484,    GetFingerState (dev));
-	__(  486,    GetFingerState (dev));
-	__(  488,    GetFingerState (dev));
-	__(  490,    GetFingerState (dev));
-	__(  492,    GetFingerState (dev));
-	__(  494,    GetFingerState (dev));
-	__(  496,    GetFingerState (dev));
-	__(  498,    GetFingerState (dev));
-	__(  500,    GetFingerState (dev));
-	__(  502,    GetFingerState (dev));
-	__(  504,    GetFingerState (dev));
-	__(  506,    GetFingerState (dev));
-	__(  508,    GetFingerState (dev));
-	__(  510,    GetFingerState (dev));
-	__(  512,    GetFingerState (dev));
-	__(  514,    GetFingerState (dev));
-	__(  516,    GetFingerState (dev));
-	__(  518,    GetFingerState (dev));
-	__(  520,    GetFingerState (dev));
-	__(  522,    GetFingerState (dev));
-	__(  524,    GetFingerState (dev));
-	__(  526,    GetFingerState (dev));
-	__(  528,    GetFingerState (dev));
-	__(  530,    GetFingerState (dev));
-	__(  532,    GetFingerState (dev));
-	__(  534,    GetFingerState (dev));
-	__(  536,    GetFingerState (dev));
-	__(  538,    GetFingerState (dev));
-	__(  540,    GetFingerState (dev));
-	__(  542,    GetFingerState (dev));
-	__(  544,    GetFingerState (dev));
-	__(  546,    GetFingerState (dev));
-	__(  548,    GetFingerState (dev));
-	__(  550,    GetFingerState (dev));
-	__(  552,    GetFingerState (dev));
-	__(  554,    GetFingerState (dev));
-	__(  556,    GetFingerState (dev));
-	__(  558,    GetFingerState (dev));
-	__(  560,    GetFingerState (dev));
-	__(  562,    GetFingerState (dev));
-	__(  564,    GetFingerState (dev));
-	__(  566,    GetFingerState (dev));
-	__(  568,    GetFingerState (dev));
-	__(  570,    GetFingerState (dev));
-	__(  572,    GetFingerState (dev));
-	__(  574,    GetFingerState (dev));
-	__(  576,    GetFingerState (dev));
-	__(  578,    GetFingerState (dev));
-	__(  580,    GetFingerState (dev));
-	__(  582,    GetFingerState (dev));
-	__(  584,    GetFingerState (dev));
-	__(  586,    GetFingerState (dev));
-	__(  588,    GetFingerState (dev));
-	__(  590,    GetFingerState (dev));
-	__(  592,    GetFingerState (dev));
-	__(  594,    GetFingerState (dev));
-	__(  596,    GetFingerState (dev));
-	__(  598,    GetFingerState (dev));
-	__(  600,    GetFingerState (dev));
-	__(  602,    GetFingerState (dev));
-	__(  604,    GetFingerState (dev));
-	__(  606,    GetFingerState (dev));
-	__(  608,    GetFingerState (dev));
-	__(  610,    GetFingerState (dev));
-	__(  612,    GetFingerState (dev));
-	__(  614,    GetFingerState (dev));
-	__(  616,    GetFingerState (dev));
-	__(  618,    GetFingerState (dev));
-	__(  620,    GetFingerState (dev));
-	__(  622,    GetFingerState (dev));
-	__(  624,    GetFingerState (dev));
-	__(  626,    GetFingerState (dev));
-	__(  628,    GetFingerState (dev));
-	__(  630,    GetFingerState (dev));
-	__(  632,    GetFingerState (dev));
-	__(  634,    GetFingerState (dev));
-	__(  636,    GetFingerState (dev));
-	__(  638,    GetFingerState (dev));
-	__(  640,    GetFingerState (dev));
-	__(  642,    GetFingerState (dev));
-	__(  644,    GetFingerState (dev));
-	__(  646,    GetFingerState (dev));
-	__(  648,    GetFingerState (dev));
-	__(  650,    GetFingerState (dev));
-	__(  652,    GetFingerState (dev));
-	__(  654,    GetFingerState (dev));
-	__(  656,    GetFingerState (dev));
-	__(  658,    GetFingerState (dev));
-	__(  660,    GetFingerState (dev));
-	__(  662,    GetFingerState (dev));
-	__(  664,    GetFingerState (dev));
-	__(  666,    GetFingerState (dev));
-	__(  668,    GetFingerState (dev));
-	__(  670,    GetFingerState (dev));
-	__(  672,    GetFingerState (dev));
-	__(  674,    GetFingerState (dev));
-	__(  676,    GetFingerState (dev));
-	__(  678,    GetFingerState (dev));
-	__(  680,    GetFingerState (dev));
-	__(  682,    GetFingerState (dev));
-	__(  684,    GetFingerState (dev));
-	__(  686,    GetFingerState (dev));
-	__(  688,    GetFingerState (dev));
-	__(  690,    GetFingerState (dev));
-	__(  692,    GetFingerState (dev));
-	__(  694,    GetFingerState (dev));
-	__(  696,    GetFingerState (dev));
-	__(  698,    GetFingerState (dev));
-	__(  700,    GetFingerState (dev));
-	__(  702,    GetFingerState (dev));
-	__(  704,    GetFingerState (dev));
-	__(  706,    GetFingerState (dev));
-	__(  708,    GetFingerState (dev));
-	__(  710,    GetFingerState (dev));
-	__(  712,    GetFingerState (dev));
-	__(  714,    GetFingerState (dev));
-	__(  716,    GetFingerState (dev));
-	__(  718,    GetFingerState (dev));
-	__(  720,    GetFingerState (dev));
-	__(  722,    GetFingerState (dev));
-	__(  724,    GetFingerState (dev));
-	__(  726,    GetFingerState (dev));
-	__(  728,    GetFingerState (dev));
-	__(  730,    GetFingerState (dev));
-	__(  732,    GetFingerState (dev));
-	__(  734,    GetFingerState (dev));
-	__(  736,    GetFingerState (dev));
-	__(  738,    GetFingerState (dev));
-	__(  740,    GetFingerState (dev));
-	__(  742,    GetFingerState (dev));
-	__(  744,    GetFingerState (dev));
-	__(  746,    GetFingerState (dev));
-	__(  748,    GetFingerState (dev));
-	__(  750,    GetFingerState (dev));
-	__(  752,    GetFingerState (dev));
-	__(  754,    GetFingerState (dev));
-	__(  756,    GetFingerState (dev));
-	__(  758,    GetFingerState (dev));
-	__(  760,    GetFingerState (dev));
-	__(  762,    GetFingerState (dev));
-	__(  764,    GetFingerState (dev));
-	__(  766,    GetFingerState (dev));
-	__(  768,    GetFingerState (dev));
-	__(  770,    GetFingerState (dev));
-	__(  772,    GetFingerState (dev));
-	__(  774,    GetFingerState (dev));
-	__(  776,    GetFingerState (dev));
-	__(  778,    GetFingerState (dev));
-	__(  780,    GetFingerState (dev));
-	__(  782,    GetFingerState (dev));
-	__(  784,    GetFingerState (dev));
-	__(  786,    GetFingerState (dev));
-	__(  788,    GetFingerState (dev));
-	__(  790,    GetFingerState (dev));
-	__(  792,    GetFingerState (dev));
-	__(  794,    GetFingerState (dev));
-	__(  796,    GetFingerState (dev));
-	__(  798,    GetFingerState (dev));
-	__(  800,    GetFingerState (dev));
-	__(  802,    GetFingerState (dev));
-	__(  804,    GetFingerState (dev));
-	__(  806,    GetFingerState (dev));
-	__(  808,    GetFingerState (dev));
-	__(  810,    GetFingerState (dev));
-	__(  812,    GetFingerState (dev));
-	__(  814,    GetFingerState (dev));
-	__(  816,    GetFingerState (dev));
-	__(  818,    GetFingerState (dev));
-	__(  820,    GetFingerState (dev));
-	__(  822,    GetFingerState (dev));
-	__(  824,    GetFingerState (dev));
-	__(  826,    GetFingerState (dev));
-	__(  828,    GetFingerState (dev));
-	__(  830,    GetFingerState (dev));
-	__(  832,    GetFingerState (dev));
-	__(  834,    GetFingerState (dev));
-	__(  836,    GetFingerState (dev));
-	__(  838,    GetFingerState (dev));
-	__(  840,    GetFingerState (dev));
-	__(  842,    GetFingerState (dev));
-	__(  844,    GetFingerState (dev));
-	__(  846,    GetFingerState (dev));
-	__(  848,    GetFingerState (dev));
-	__(  850,    GetFingerState (dev));
-	__(  852,    GetFingerState (dev));
-	__(  854,    GetFingerState (dev));
-	__(  856,    GetFingerState (dev));
-	__(  858,    GetFingerState (dev));
-	__(  860,    GetFingerState (dev));
-	__(  862,    GetFingerState (dev));
-	__(  864,    GetFingerState (dev));
-	__(  866,    GetFingerState (dev));
-	__(  868,    GetFingerState (dev));
-	__(  870,    GetFingerState (dev));
-	__(  872,    GetFingerState (dev));
-	__(  874,    GetFingerState (dev));
-	__(  876,    GetFingerState (dev));
-	__(  878,    GetFingerState (dev));
-	__(  880,    GetFingerState (dev));
-	__(  882,    GetFingerState (dev));
-	__(  884,    GetFingerState (dev));
-	__(  886,    GetFingerState (dev));
-	__(  888,    GetFingerState (dev));
-	__(  890,    GetFingerState (dev));
-	__(  892,    GetFingerState (dev));
-	__(  894,    GetFingerState (dev));
-	__(  896,    GetFingerState (dev));
-	__(  898,    GetFingerState (dev));
-	__(  900,    GetFingerState (dev));
-	__(  902,    GetFingerState (dev));
-	__(  904,    GetFingerState (dev));
-	__(  906,    GetFingerState (dev));
-	__(  908,    GetFingerState (dev));
-	__(  910,    GetFingerState (dev));
-	__(  912,    GetFingerState (dev));
-	__(  914,    GetFingerState (dev));
-	__(  916,    GetFingerState (dev));
-	__(  918,    GetFingerState (dev));
-	__(  920,    GetFingerState (dev));
-	__(  922,    GetFingerState (dev));
-	__(  924,    GetFingerState (dev));
-	__(  926,    GetFingerState (dev));
-	__(  928,    GetFingerState (dev));
-	__(  930,    GetFingerState (dev));
-	__(  932,    GetFingerState (dev));
-	__(  934,    GetFingerState (dev));
-	__(  936,    GetFingerState (dev));
-	__(  938,    GetFingerState (dev));
-	__(  940,    GetFingerState (dev));
-	__(  942,    GetFingerState (dev));
-	__(  944,    GetFingerState (dev));
-	__(  946,    GetFingerState (dev));
-	__(  948,    GetFingerState (dev));
-	__(  950,    GetFingerState (dev));
-	__(  952,    GetFingerState (dev));
-	__(  954,    GetFingerState (dev));
-	__(  956,    GetFingerState (dev));
-	__(  958,    GetFingerState (dev));
-	__(  960,    GetFingerState (dev));
-	__(  962,    GetFingerState (dev));
-	__(  964,    GetFingerState (dev));
-	__(  966,    GetFingerState (dev));
-	__(  968,    GetFingerState (dev));
-	__(  970,    GetFingerState (dev));
-	__(  972,    GetFingerState (dev));
-	__(  974,    GetFingerState (dev));
-	__(  976,    GetFingerState (dev));
-	__(  978,    GetFingerState (dev));
-	__(  980,    GetFingerState (dev));
-	__(  982,    GetFingerState (dev));
-	__(  984,    GetFingerState (dev));
-	__(  986,    GetFingerState (dev));
-	__(  988,    GetFingerState (dev));
-	__(  990,    GetFingerState (dev));
-	__(  992,    GetFingerState (dev));
-	__(  994,    GetFingerState (dev));
-	__(  996,    GetFingerState (dev));
-	__(  998,    GetFingerState (dev));
-	__( 1000,    GetFingerState (dev));
-	__( 1002,    GetFingerState (dev));
-	__( 1004,    GetFingerState (dev));
-	__( 1006,    GetFingerState (dev));
-	__( 1008,    GetFingerState (dev));
-	__( 1010,    GetFingerState (dev));
-	__( 1012,    GetFingerState (dev));
-	__( 1014,    GetFingerState (dev));
-	__( 1016,    GetFingerState (dev));
-	__( 1018,    GetFingerState (dev));
-	__( 1020,    GetFingerState (dev));
-	__( 1022,    GetFingerState (dev));
-	__( 1024,    GetFingerState (dev));
-	__( 1026,    GetFingerState (dev));
-	__( 1028,    GetFingerState (dev));
-	__( 1030,    GetFingerState (dev));
-	__( 1032,    GetFingerState (dev));
-	__( 1034,    GetFingerState (dev));
-	__( 1036,    GetFingerState (dev));
-	__( 1038,    GetFingerState (dev));
-	__( 1040,    GetFingerState (dev));
-	__( 1042,    GetFingerState (dev));
-	__( 1044,    GetFingerState (dev));
-	__( 1046,    GetFingerState (dev));
-	__( 1048,    GetFingerState (dev));
-	__( 1050,    GetFingerState (dev));
-	__( 1052,    GetFingerState (dev));
-	__( 1054,    GetFingerState (dev));
-	__( 1056,    GetFingerState (dev));
-	__( 1058,    GetFingerState (dev));
-	__( 1060,    GetFingerState (dev));
-	__( 1062,    GetFingerState (dev));
-	__( 1064,    GetFingerState (dev));
-	__( 1066,    GetFingerState (dev));
-	__( 1068,    GetFingerState (dev));
-	__( 1070,    GetFingerState (dev));
-	__( 1072,    GetFingerState (dev));
-	__( 1074,    GetFingerState (dev));
-	__( 1076,    GetFingerState (dev));
-	__( 1078,    GetFingerState (dev));
-	__( 1080,    GetFingerState (dev));
-	__( 1082,    GetFingerState (dev));
-	__( 1084,    GetFingerState (dev));
-	__( 1086,    GetFingerState (dev));
-	__( 1088,    GetFingerState (dev));
-	__( 1090,    GetFingerState (dev));
-	__( 1092,    GetFingerState (dev));
-	__( 1094,    GetFingerState (dev));
-	__( 1096,    GetFingerState (dev));
-	__( 1098,    GetFingerState (dev));
-	__( 1100,    GetFingerState (dev));
-	__( 1102,    GetFingerState (dev));
-	__( 1104,    GetFingerState (dev));
-	__( 1106,    GetFingerState (dev));
-	__( 1108,    GetFingerState (dev));
-	__( 1110,    GetFingerState (dev));
-	__( 1112,    GetFingerState (dev));
-	__( 1114,    GetFingerState (dev));
-	__( 1116,    GetFingerState (dev));
-	__( 1118,    GetFingerState (dev));
-	__( 1120,    GetFingerState (dev));
-	__( 1122,    GetFingerState (dev));
-	__( 1124,    GetFingerState (dev));
-	__( 1126,    GetFingerState (dev));
-	__( 1128,    GetFingerState (dev));
-	__( 1130,    GetFingerState (dev));
-	__( 1132,    GetFingerState (dev));
-	__( 1134,    GetFingerState (dev));
-	__( 1136,    GetFingerState (dev));
-	__( 1138,    GetFingerState (dev));
-	__( 1140,    GetFingerState (dev));
-	__( 1142,    GetFingerState (dev));
-	__( 1144,    GetFingerState (dev));
-	__( 1146,    GetFingerState (dev));
-	__( 1148,    GetFingerState (dev));
-	__( 1150,    GetFingerState (dev));
-	__( 1152,    GetFingerState (dev));
-	__( 1154,    GetFingerState (dev));
-	__( 1156,    GetFingerState (dev));
-	__( 1158,    GetFingerState (dev));
-	__( 1160,    GetFingerState (dev));
-	__( 1162,    GetFingerState (dev));
-	__( 1164,    GetFingerState (dev));
-	__( 1166,    GetFingerState (dev));
-	__( 1168,    GetFingerState (dev));
-	__( 1170,    GetFingerState (dev));
-	__( 1172,    GetFingerState (dev));
-	__( 1174,    GetFingerState (dev));
-	__( 1176,    GetFingerState (dev));
-	__( 1178,    GetFingerState (dev));
-	__( 1180,    GetFingerState (dev));
-	__( 1182,    GetFingerState (dev));
-	__( 1184,    GetFingerState (dev));
-	__( 1186,    GetFingerState (dev));
-	__( 1188,    GetFingerState (dev));
-	__( 1190,    GetFingerState (dev));
-	__( 1192,    GetFingerState (dev));
-	__( 1194,    GetFingerState (dev));
-	__( 1196,    GetFingerState (dev));
-	__( 1198,    GetFingerState (dev));
-	__( 1200,    GetFingerState (dev));
-	__( 1202,    GetFingerState (dev));
-	__( 1204,    GetFingerState (dev));
-	__( 1206,    GetFingerState (dev));
-	__( 1208,    GetFingerState (dev));
-	__( 1210,    GetFingerState (dev));
-	__( 1212,    GetFingerState (dev));
-	__( 1214,    GetFingerState (dev));
-	__( 1216,    GetFingerState (dev));
-	__( 1218,    GetFingerState (dev));
-	__( 1220,    GetFingerState (dev));
-	__( 1222,    GetFingerState (dev));
-	__( 1224,    GetFingerState (dev));
-	__( 1226,    GetFingerState (dev));
-	__( 1228,    GetFingerState (dev));
-	__( 1230,    GetFingerState (dev));
-	__( 1232,    GetFingerState (dev));
-	__( 1234,    GetFingerState (dev));
-	__( 1236,    GetFingerState (dev));
-	__( 1238,    GetFingerState (dev));
-	__( 1240,    GetFingerState (dev));
-	__( 1242,    GetFingerState (dev));
-	__( 1244,    GetFingerState (dev));
-	__( 1246,    GetFingerState (dev));
-	__( 1248,    GetFingerState (dev));
-	__( 1250,    GetFingerState (dev));
-	__( 1252,    GetFingerState (dev));
-	__( 1254,    GetFingerState (dev));
-	__( 1256,    GetFingerState (dev));
-	__( 1258,    GetFingerState (dev));
-	__( 1260,    GetFingerState (dev));
-	__( 1262,    GetFingerState (dev));
-	__( 1264,    GetFingerState (dev));
-	__( 1266,    GetFingerState (dev));
-	__( 1268,    GetFingerState (dev));
-	__( 1270,    GetFingerState (dev));
-	__( 1272,    GetFingerState (dev));
-	__( 1274,    GetFingerState (dev));
-	__( 1276,    GetFingerState (dev));
-	__( 1278,    GetFingerState (dev));
-	__( 1280,    GetFingerState (dev));
-	__( 1282,    GetFingerState (dev));
-	__( 1284,    GetFingerState (dev));
-	__( 1286,    GetFingerState (dev));
-	__( 1288,    GetFingerState (dev));
-	__( 1290,    GetFingerState (dev));
-	__( 1292,    GetFingerState (dev));
-	__( 1294,    GetFingerState (dev));
-	__( 1296,    GetFingerState (dev));
-	__( 1298,    GetFingerState (dev));
-	__( 1300,    GetFingerState (dev));
-	__( 1302,    GetFingerState (dev));
-	__( 1304,    GetFingerState (dev));
-	__( 1306,    GetFingerState (dev));
-	__( 1308,    GetFingerState (dev));
-	__( 1310,    GetFingerState (dev));
-	__( 1312,    GetFingerState (dev));
-	__( 1314,    GetFingerState (dev));
-	__( 1316,    GetFingerState (dev));
-	__( 1318,    GetFingerState (dev));
-	__( 1320,    GetFingerState (dev));
-	__( 1322,    GetFingerState (dev));
-	__( 1324,    GetFingerState (dev));
-	__( 1326,    GetFingerState (dev));
-	__( 1328,    GetFingerState (dev));
-	__( 1330,    GetFingerState (dev));
-	__( 1332,    GetFingerState (dev));
-	__( 1334,    GetFingerState (dev));
-	__( 1336,    GetFingerState (dev));
-	__( 1338,    GetFingerState (dev));
-	__( 1340,    GetFingerState (dev));
-	__( 1342,    GetFingerState (dev));
-	__( 1344,    GetFingerState (dev));
-	__( 1346,    GetFingerState (dev));
-	__( 1348,    GetFingerState (dev));
-	__( 1350,    GetFingerState (dev));
-	__( 1352,    GetFingerState (dev));
-	__( 1354,    GetFingerState (dev));
-	__( 1356,    GetFingerState (dev));
-	__( 1358,    GetFingerState (dev));
-	__( 1360,    GetFingerState (dev));
-	__( 1362,    GetFingerState (dev));
-	__( 1364,    GetFingerState (dev));
-	__( 1366,    GetFingerState (dev));
-	__( 1368,    GetFingerState (dev));
-	__( 1370,    GetFingerState (dev));
-	__( 1372,    GetFingerState (dev));
-	__( 1374,    GetFingerState (dev));
-	__( 1376,    GetFingerState (dev));
-	__( 1378,    GetFingerState (dev));
-	__( 1380,    GetFingerState (dev));
-	__( 1382,    GetFingerState (dev));
-	__( 1384,    GetFingerState (dev));
-	__( 1386,    GetFingerState (dev));
-	__( 1388,    GetFingerState (dev));
-	__( 1390,    GetFingerState (dev));
-	__( 1392,    GetFingerState (dev));
-	__( 1394,    GetFingerState (dev));
-	__( 1396,    GetFingerState (dev));
-	__( 1398,    GetFingerState (dev));
-	__( 1400,    GetFingerState (dev));
-	__( 1402,    GetFingerState (dev));
-	__( 1404,    GetFingerState (dev));
-	__( 1406,    GetFingerState (dev));
-	__( 1408,    GetFingerState (dev));
-	__( 1410,    GetFingerState (dev));
-	__( 1412,    GetFingerState (dev));
-	__( 1414,    GetFingerState (dev));
-	__( 1416,    GetFingerState (dev));
-	__( 1418,    GetFingerState (dev));
-	__( 1420,    GetFingerState (dev));
-	__( 1422,    GetFingerState (dev));
-	__( 1424,    GetFingerState (dev));
-	__( 1426,    GetFingerState (dev));
-	__( 1428,    GetFingerState (dev));
-	__( 1430,    GetFingerState (dev));
-	__( 1432,    GetFingerState (dev));
-	__( 1434,    GetFingerState (dev));
-	__( 1436,    GetFingerState (dev));
-	__( 1438,    GetFingerState (dev));
-	__( 1440,    GetFingerState (dev));
-	__( 1442,    GetFingerState (dev));
-	__( 1444,    GetFingerState (dev));
-	__( 1446,    GetFingerState (dev));
-	__( 1448,    GetFingerState (dev));
-	__( 1450,    GetFingerState (dev));
-	__( 1452,    GetFingerState (dev));
-	__( 1454,    GetFingerState (dev));
-	__( 1456,    GetFingerState (dev));
-	__( 1458,    GetFingerState (dev));
-	__( 1460,    GetFingerState (dev));
-	__( 1462,    GetFingerState (dev));
-	__( 1464,    GetFingerState (dev));
-	__( 1466,    GetFingerState (dev));
-	__( 1468,    GetFingerState (dev));
-	__( 1470,    GetFingerState (dev));
-	__( 1472,    GetFingerState (dev));
-	__( 1474,    GetFingerState (dev));
-	__( 1476,    GetFingerState (dev));
-	__( 1478,    GetFingerState (dev));
-	__( 1480,    GetFingerState (dev));
-	__( 1482,    GetFingerState (dev));
-	__( 1484,    GetFingerState (dev));
-	__( 1486,    GetFingerState (dev));
-	__( 1488,    GetFingerState (dev));
-	__( 1490,    GetFingerState (dev));
-	__( 1492,    GetFingerState (dev));
-	__( 1494,    GetFingerState (dev));
-	__( 1496,    GetFingerState (dev));
-	__( 1498,    GetFingerState (dev));
-	__( 1500,    GetFingerState (dev));
-	__( 1502,    GetFingerState (dev));
-	__( 1504,    GetFingerState (dev));
-	__( 1506,    GetFingerState (dev));
-	__( 1508,    GetFingerState (dev));
-	__( 1510,    GetFingerState (dev));
-	__( 1512,    GetFingerState (dev));
-	__( 1514,    GetFingerState (dev));
-	__( 1516,    GetFingerState (dev));
-	__( 1518,    GetFingerState (dev));
-	__( 1520,    GetFingerState (dev));
-	__( 1522,    GetFingerState (dev));
-	__( 1524,    GetFingerState (dev));
-	__( 1526,    GetFingerState (dev));
-	__( 1528,    GetFingerState (dev));
-	__( 1530,    GetFingerState (dev));
-	__( 1532,    GetFingerState (dev));
-	__( 1534,    GetFingerState (dev));
-	__( 1536,    GetFingerState (dev));
-	__( 1538,    GetFingerState (dev));
-	__( 1540,    GetFingerState (dev));
-	__( 1542,    GetFingerState (dev));
-	__( 1544,    GetFingerState (dev));
-	__( 1546,    GetFingerState (dev));
-	__( 1548,    GetFingerState (dev));
-	__( 1550,    GetFingerState (dev));
-	__( 1552,    GetFingerState (dev));
-	__( 1554,    GetFingerState (dev));
-	__( 1556,    GetFingerState (dev));
-	__( 1558,    GetFingerState (dev));
-	__( 1560,    GetFingerState (dev));
-	__( 1562,    GetFingerState (dev));
-	__( 1564,    GetFingerState (dev));
-	__( 1566,    GetFingerState (dev));
-	__( 1568,    GetFingerState (dev));
-	__( 1570,    GetFingerState (dev));
-	__( 1572,    GetFingerState (dev));
-	__( 1574,    GetFingerState (dev));
-	__( 1576,    GetFingerState (dev));
-	__( 1578,    GetFingerState (dev));
-	__( 1580,    GetFingerState (dev));
-	__( 1582,    GetFingerState (dev));
-	__( 1584,    GetFingerState (dev));
-	__( 1586,    GetFingerState (dev));
-	__( 1588,    GetFingerState (dev));
-	__( 1590,    GetFingerState (dev));
-	__( 1592,    GetFingerState (dev));
-	__( 1594,    GetFingerState (dev));
-	__( 1596,    GetFingerState (dev));
-	__( 1598,    GetFingerState (dev));
-	__( 1600,    GetFingerState (dev));
-	__( 1602,    GetFingerState (dev));
-	__( 1604,    GetFingerState (dev));
-	__( 1606,    GetFingerState (dev));
-	__( 1608,    GetFingerState (dev));
-	__( 1610,    GetFingerState (dev));
-	__( 1612,    GetFingerState (dev));
-	__( 1614,    GetFingerState (dev));
-	__( 1616,    GetFingerState (dev));
-	__( 1618,    GetFingerState (dev));
-	__( 1620,    GetFingerState (dev));
-	__( 1622,    GetFingerState (dev));
-	__( 1624,    GetFingerState (dev));
-	__( 1626,    GetFingerState (dev));
-	__( 1628,    GetFingerState (dev));
-	__( 1630,    GetFingerState (dev));
-	__( 1632,    GetFingerState (dev));
-	__( 1634,    GetFingerState (dev));
-	__( 1636,    GetFingerState (dev));
-	__( 1638,    GetFingerState (dev));
-	__( 1640,    GetFingerState (dev));
-	__( 1642,    GetFingerState (dev));
-	__( 1644,    GetFingerState (dev));
-	__( 1646,    GetFingerState (dev));
-	__( 1648,    GetFingerState (dev));
-	__( 1650,    GetFingerState (dev));
-	__( 1652,    GetFingerState (dev));
-	__( 1654,    GetFingerState (dev));
-	__( 1656,    GetFingerState (dev));
-	__( 1658,    GetFingerState (dev));
-	__( 1660,    GetFingerState (dev));
-	__( 1662,    GetFingerState (dev));
-	__( 1664,    GetFingerState (dev));
-	__( 1666,    GetFingerState (dev));
-	__( 1668,    GetFingerState (dev));
-	__( 1670,    GetFingerState (dev));
-	__( 1672,    GetFingerState (dev));
-	__( 1674,    GetFingerState (dev));
-	__( 1676,    GetFingerState (dev));
-	__( 1678,    GetFingerState (dev));
-	__( 1680,    GetFingerState (dev));
-	__( 1682,    GetFingerState (dev));
-	__( 1684,    GetFingerState (dev));
-	__( 1686,    GetFingerState (dev));
-	__( 1688,    GetFingerState (dev));
-	__( 1690,    GetFingerState (dev));
-	__( 1692,    GetFingerState (dev));
-	__( 1694,    GetFingerState (dev));
-	__( 1696,    GetFingerState (dev));
-	__( 1698,    GetFingerState (dev));
-	__( 1700,    GetFingerState (dev));
-	__( 1702,    GetFingerState (dev));
-	__( 1704,    GetFingerState (dev));
-	__( 1706,    GetFingerState (dev));
-	__( 1708,    GetFingerState (dev));
-	__( 1710,    GetFingerState (dev));
-	__( 1712,    GetFingerState (dev));
-	__( 1714,    GetFingerState (dev));
-	__( 1716,    GetFingerState (dev));
-	__( 1718,    GetFingerState (dev));
-	__( 1720,    GetFingerState (dev));
-	__( 1722,    GetFingerState (dev));
-	__( 1724,    GetFingerState (dev));
-	__( 1726,    GetFingerState (dev));
-	__( 1728,    GetFingerState (dev));
-	__( 1730,    GetFingerState (dev));
-	__( 1732,    GetFingerState (dev));
-	__( 1734,    GetFingerState (dev));
-	__( 1736,    GetFingerState (dev));
-	__( 1738,    GetFingerState (dev));
-	__( 1740,    GetFingerState (dev));
-	__( 1742,    GetFingerState (dev));
-	__( 1744,    GetFingerState (dev));
-	__( 1746,    GetFingerState (dev));
-	__( 1748,    GetFingerState (dev));
-	__( 1750,    GetFingerState (dev));
-	__( 1752,    GetFingerState (dev));
-	__( 1754,    GetFingerState (dev));
-	__( 1756,    GetFingerState (dev));
-	__( 1758,    GetFingerState (dev));
-	__( 1760,    GetFingerState (dev));
-	__( 1762,    GetFingerState (dev));
-	__( 1764,    GetFingerState (dev));
-	__( 1766,    GetFingerState (dev));
-	__( 1768,    GetFingerState (dev));
-	__( 1770,    GetFingerState (dev));
-	__( 1772,    GetFingerState (dev));
-	__( 1774,    GetFingerState (dev));
-	__( 1776,    GetFingerState (dev));
-	__( 1778,    GetFingerState (dev));
-	__( 1780,    GetFingerState (dev));
-	__( 1782,    GetFingerState (dev));
-	__( 1784,    GetFingerState (dev));
-	__( 1786,    GetFingerState (dev));
-	__( 1788,    GetFingerState (dev));
-	__( 1790,    GetFingerState (dev));
-	__( 1792,    GetFingerState (dev));
-	__( 1794,    GetFingerState (dev));
-	__( 1796,    GetFingerState (dev));
-	__( 1798,    GetFingerState (dev));
-	__( 1800,    GetFingerState (dev));
-	__( 1802,    GetFingerState (dev));
-	__( 1804,    GetFingerState (dev));
-	__( 1806,    GetFingerState (dev));
-	__( 1808,    GetFingerState (dev));
-	__( 1810,    GetFingerState (dev));
-	__( 1812,    GetFingerState (dev));
-	__( 1814,    GetFingerState (dev));
-	__( 1816,    GetFingerState (dev));
-	__( 1818,    GetFingerState (dev));
-	__( 1820,    GetFingerState (dev));
-	__( 1822,    GetFingerState (dev));
-	__( 1824,    GetFingerState (dev));
-	__( 1826,    GetFingerState (dev));
-	__( 1828,    GetFingerState (dev));
-	__( 1830,    GetFingerState (dev));
-	__( 1832,    GetFingerState (dev));
-	__( 1834,    GetFingerState (dev));
-	__( 1836,    GetFingerState (dev));
-	__( 1838,    GetFingerState (dev));
-	__( 1840,    GetFingerState (dev));
-	__( 1842,    GetFingerState (dev));
-	__( 1844,    GetFingerState (dev));
-	__( 1846,    GetFingerState (dev));
-	__( 1848,    GetFingerState (dev));
-	__( 1850,    GetFingerState (dev));
-	__( 1852,    GetFingerState (dev));
-	__( 1854,    GetFingerState (dev));
-	__( 1856,    GetFingerState (dev));
-	__( 1858,    GetFingerState (dev));
-	__( 1860,    GetFingerState (dev));
-	__( 1862,    GetFingerState (dev));
-	__( 1864,    GetFingerState (dev));
-	__( 1866,    GetFingerState (dev));
-	__( 1868,    GetFingerState (dev));
-	__( 1870,    GetFingerState (dev));
-	__( 1872,    GetFingerState (dev));
-	__( 1874,    GetFingerState (dev));
-	__( 1876,    GetFingerState (dev));
-	__( 1878,    GetFingerState (dev));
-	__( 1880,    GetFingerState (dev));
-	__( 1882,    GetFingerState (dev));
-	__( 1884,    GetFingerState (dev));
-	__( 1886,    GetFingerState (dev));
-	__( 1888,    GetFingerState (dev));
-	__( 1890,    GetFingerState (dev));
-	__( 1892,    GetFingerState (dev));
-	__( 1894,    GetFingerState (dev));
-	__( 1896,    GetFingerState (dev));
-	__( 1898,    GetFingerState (dev));
-	__( 1900,    GetFingerState (dev));
-	__( 1902,    GetFingerState (dev));
-	__( 1904,    GetFingerState (dev));
-	__( 1906,    GetFingerState (dev));
-	__( 1908,    GetFingerState (dev));
-	__( 1910,    GetFingerState (dev));
-	__( 1912,    GetFingerState (dev));
-	__( 1914,    GetFingerState (dev));
-	__( 1916,    GetFingerState (dev));
-	__( 1918,    GetFingerState (dev));
-	__( 1920,    GetFingerState (dev));
-	__( 1922,    GetFingerState (dev));
-	__( 1924,    GetFingerState (dev));
-	__( 1926,    GetFingerState (dev));
-	__( 1928,    GetFingerState (dev));
-	__( 1930,    GetFingerState (dev));
-	__( 1932,    GetFingerState (dev));
-	__( 1934,    GetFingerState (dev));
-	__( 1936,    GetFingerState (dev));
-	__( 1938,    GetFingerState (dev));
-	__( 1940,    GetFingerState (dev));
-	__( 1942,    GetFingerState (dev));
-	__( 1944,    GetFingerState (dev));
-	__( 1946,    GetFingerState (dev));
-	__( 1948,    GetFingerState (dev));
-	__( 1950,    GetFingerState (dev));
-	__( 1952,    GetFingerState (dev));
-	__( 1954,    GetFingerState (dev));
-	__( 1956,    GetFingerState (dev));
-	__( 1958,    GetFingerState (dev));
-	__( 1960,    GetFingerState (dev));
-	__( 1962,    GetFingerState (dev));
-	__( 1964,    GetFingerState (dev));
-	__( 1966,    GetFingerState (dev));
-	__( 1968,    GetFingerState (dev));
-	__( 1970,    GetFingerState (dev));
-	__( 1972,    GetFingerState (dev));
-	__( 1974,    GetFingerState (dev));
-	__( 1976,    GetFingerState (dev));
-	__( 1978,    GetFingerState (dev));
-	__( 1980,    GetFingerState (dev));
-	__( 1982,    GetFingerState (dev));
-	__( 1984,    GetFingerState (dev));
-	__( 1986,    GetFingerState (dev));
-	__( 1988,    GetFingerState (dev));
-	__( 1990,    GetFingerState (dev));
-	__( 1992,    GetFingerState (dev));
-	__( 1994,    GetFingerState (dev));
-	__( 1996,    GetFingerState (dev));
-	__( 1998,    GetFingerState (dev));
-	__( 2000,    GetFingerState (dev));
-	__( 2002,    GetFingerState (dev));
-	__( 2004,    GetFingerState (dev));
-	__( 2006,    GetFingerState (dev));
-	__( 2008,    GetFingerState (dev));
-	__( 2010,    GetFingerState (dev));
-	__( 2012,    GetFingerState (dev));
-	__( 2014,    GetFingerState (dev));
-	__( 2016,    GetFingerState (dev));
-	__( 2018,    GetFingerState (dev));
-	__( 2020,    GetFingerState (dev));
-	__( 2022,    GetFingerState (dev));
-	__( 2024,    GetFingerState (dev));
-	__( 2026,    GetFingerState (dev));
-	__( 2028,    GetFingerState (dev));
-	__( 2030,    GetFingerState (dev));
-	__( 2032,    GetFingerState (dev));
-	__( 2034,    GetFingerState (dev));
-	__( 2036,    GetFingerState (dev));
-	__( 2038,    GetFingerState (dev));
-	__( 2040,    GetFingerState (dev));
-	__( 2042,    GetFingerState (dev));
-	__( 2044,    GetFingerState (dev));
-	__( 2046,    GetFingerState (dev));
-	__( 2048,    GetFingerState (dev));
-	__( 2050,    GetFingerState (dev));
-	__( 2052,    GetFingerState (dev));
-	__( 2054,    GetFingerState (dev));
-	__( 2056,    GetFingerState (dev));
-	__( 2058,    GetFingerState (dev));
-	__( 2060,    GetFingerState (dev));
-	__( 2062,    GetFingerState (dev));
-	__( 2064,    GetFingerState (dev));
-	__( 2066,    GetFingerState (dev));
-	__( 2068,    GetFingerState (dev));
-	__( 2070,    GetFingerState (dev));
-	__( 2072,    GetFingerState (dev));
-	__( 2074,    GetFingerState (dev));
-	__( 2076,    GetFingerState (dev));
-	__( 2078,    GetFingerState (dev));
-	__( 2080,    GetFingerState (dev));
-	__( 2082,    GetFingerState (dev));
-	__( 2084,    GetFingerState (dev));
-	__( 2086,    GetFingerState (dev));
-	__( 2088,    GetFingerState (dev));
-	__( 2090,    GetFingerState (dev));
-	__( 2092,    GetFingerState (dev));
-	__( 2094,    GetFingerState (dev));
-	__( 2096,    GetFingerState (dev));
-	__( 2098,    GetFingerState (dev));
-	__( 2100,    GetFingerState (dev));
-	__( 2102,    GetFingerState (dev));
-	__( 2104,    GetFingerState (dev));
-	__( 2106,    GetFingerState (dev));
-	__( 2108,    GetFingerState (dev));
-	__( 2110,    GetFingerState (dev));
-	__( 2112,    GetFingerState (dev));
-	__( 2114,    GetFingerState (dev));
-	__( 2116,    GetFingerState (dev));
-	__( 2118,    GetFingerState (dev));
-	__( 2120,    GetFingerState (dev));
-	__( 2122,    GetFingerState (dev));
-	__( 2124,    GetFingerState (dev));
-	__( 2126,    GetFingerState (dev));
-	__( 2128,    GetFingerState (dev));
-	__( 2130,    GetFingerState (dev));
-	__( 2132,    GetFingerState (dev));
-	__( 2134,    GetFingerState (dev));
-	__( 2136,    GetFingerState (dev));
-	__( 2138,    GetFingerState (dev));
-	__( 2140,    GetFingerState (dev));
-	__( 2142,    GetFingerState (dev));
-	__( 2144,    GetFingerState (dev));
-	__( 2146,    GetFingerState (dev));
-	__( 2148,    GetFingerState (dev));
-	__( 2150,    GetFingerState (dev));
-	__( 2152,    GetFingerState (dev));
-	__( 2154,    GetFingerState (dev));
-	__( 2156,    GetFingerState (dev));
-	__( 2158,    GetFingerState (dev));
-	__( 2160,    GetFingerState (dev));
-	__( 2162,    GetFingerState (dev));
-	__( 2164,    GetFingerState (dev));
-	__( 2166,    GetFingerState (dev));
-	__( 2168,    GetFingerState (dev));
-	__( 2170,    GetFingerState (dev));
-	__( 2172,    GetFingerState (dev));
-	__( 2174,    GetFingerState (dev));
-	__( 2176,    GetFingerState (dev));
-	__( 2178,    GetFingerState (dev));
-	__( 2180,    GetFingerState (dev));
-	__( 2182,    GetFingerState (dev));
-	__( 2184,    GetFingerState (dev));
-	__( 2186,    GetFingerState (dev));
-	__( 2188,    GetFingerState (dev));
-	__( 2190,    GetFingerState (dev));
-	__( 2192,    GetFingerState (dev));
-	__( 2194,    GetFingerState (dev));
-	__( 2196,    GetFingerState (dev));
-	__( 2198,    GetFingerState (dev));
-	__( 2200,    GetFingerState (dev));
-	__( 2202,    GetFingerState (dev));
-	__( 2204,    GetFingerState (dev));
-	__( 2206,    GetFingerState (dev));
-	__( 2208,    GetFingerState (dev));
-	__( 2210,    GetFingerState (dev));
-	__( 2212,    GetFingerState (dev));
-	__( 2214,    GetFingerState (dev));
-	__( 2216,    GetFingerState (dev));
-	__( 2218,    GetFingerState (dev));
-	__( 2220,    GetFingerState (dev));
-	__( 2222,    GetFingerState (dev));
-	__( 2224,    GetFingerState (dev));
-	__( 2226,    GetFingerState (dev));
-	__( 2228,    GetFingerState (dev));
-	__( 2230,    GetFingerState (dev));
-	__( 2232,    GetFingerState (dev));
-	__( 2234,    GetFingerState (dev));
-	__( 2236,    GetFingerState (dev));
-	__( 2238,    GetFingerState (dev));
-	__( 2240,    GetFingerState (dev));
-	__( 2242,    GetFingerState (dev));
-	__( 2244,    GetFingerState (dev));
-	__( 2246,    GetFingerState (dev));
-	__( 2248,    GetFingerState (dev));
-	__( 2250,    GetFingerState (dev));
-	__( 2252,    GetFingerState (dev));
-	__( 2254,    GetFingerState (dev));
-	__( 2256,    GetFingerState (dev));
-	__( 2258,    GetFingerState (dev));
-	__( 2260,    GetFingerState (dev));
-	__( 2262,    GetFingerState (dev));
-	__( 2264,    GetFingerState (dev));
-	__( 2266,    GetFingerState (dev));
-	__( 2268,    GetFingerState (dev));
-	__( 2270,    GetFingerState (dev));
-	__( 2272,    GetFingerState (dev));
-	__( 2274,    GetFingerState (dev));
-	__( 2276,    GetFingerState (dev));
-	__( 2278,    GetFingerState (dev));
-	__( 2280,    GetFingerState (dev));
-	__( 2282,    GetFingerState (dev));
-	__( 2284,    GetFingerState (dev));
-	__( 2286,    GetFingerState (dev));
-	__( 2288,    GetFingerState (dev));
-	__( 2290,    GetFingerState (dev));
-	__( 2292,    GetFingerState (dev));
-	__( 2294,    GetFingerState (dev));
-	__( 2296,    GetFingerState (dev));
-	__( 2298,    GetFingerState (dev));
-	__( 2300,    GetFingerState (dev));
-	__( 2302,    GetFingerState (dev));
-	__( 2304,    GetFingerState (dev));
-	__( 2306,    GetFingerState (dev));
-	__( 2308,    GetFingerState (dev));
-	__( 2310,    GetFingerState (dev));
-	 _(          LoadImage (dev));
-	__( 2314,    GetParam (dev, 0x0014));
-	__( 2316,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 2319,    GetParam (dev, 0x0011));
-	__( 2321,    SetParam (dev, 0x0062, 0x0032));
-	__( 2323,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__( 2327,    GetConfig (dev));
-	__( 2329,    GetParam (dev, 0x002e));
-	__( 2331,    GetVersion (dev));
-	__( 2333,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 2336,    SetParam (dev, 0x0055, 0x0008));
-	__( 2338,    SetParam (dev, 0x0055, 0x0008));
-	__( 2340,    SetParam (dev, 0x0055, 0x0008));
-	__( 2342,    GetParam (dev, 0x0014));
-	__( 2344,    GetParam (dev, 0x0011));
-	__( 2346,    SetParam (dev, 0x0062, 0x0032));
-	__( 2348,    GetPrint (dev, 0x0014, type_0));
-	 _(          LoadImage (dev));
-	__( 2352,    GetParam (dev, 0x0014));
-	__( 2354,    GetParam (dev, 0x0014));
-	__( 2356,    AbortPrint (dev));
-	 _(          LoadImage (dev));
-	__( 2359,    GetParam (dev, 0x0011));
-	__( 2361,    SetParam (dev, 0x0062, 0x0032));
-	__( 2363,    GetPrint (dev, 0x1388, type_1));
-	__( 2365,    GetFingerState (dev));
-	__( 2367,    GetFingerState (dev));
-	__( 2369,    GetFingerState (dev));
-	__( 2371,    GetFingerState (dev));
-	__( 2373,    GetFingerState (dev));
-	__( 2375,    GetFingerState (dev));
-	__( 2377,    GetFingerState (dev));
-	__( 2379,    GetFingerState (dev));
-	__( 2381,    GetFingerState (dev));
-	__( 2383,    GetFingerState (dev));
-	__( 2385,    GetFingerState (dev));
-	__( 2387,    GetFingerState (dev));
-	__( 2389,    GetFingerState (dev));
-	__( 2391,    GetFingerState (dev));
-	__( 2393,    GetFingerState (dev));
-	__( 2395,    GetFingerState (dev));
-	__( 2397,    GetFingerState (dev));
-	__( 2399,    GetFingerState (dev));
-	__( 2401,    GetFingerState (dev));
-	__( 2403,    GetFingerState (dev));
-	__( 2405,    GetFingerState (dev));
-	__( 2407,    GetFingerState (dev));
-	__( 2409,    GetFingerState (dev));
-	__( 2411,    GetFingerState (dev));
-	__( 2413,    GetFingerState (dev));
-	__( 2415,    GetFingerState (dev));
-	__( 2417,    GetFingerState (dev));
-	__( 2419,    GetFingerState (dev));
-	__( 2421,    GetFingerState (dev));
-	__( 2423,    GetFingerState (dev));
-	__( 2425,    GetFingerState (dev));
-	__( 2427,    GetFingerState (dev));
-	__( 2429,    GetFingerState (dev));
-	__( 2431,    GetFingerState (dev));
-	__( 2433,    GetFingerState (dev));
-	__( 2435,    GetFingerState (dev));
-	__( 2437,    GetFingerState (dev));
-	__( 2439,    GetFingerState (dev));
-	__( 2441,    GetFingerState (dev));
-	__( 2443,    GetFingerState (dev));
-	__( 2445,    GetFingerState (dev));
-	__( 2447,    GetFingerState (dev));
-	__( 2449,    GetFingerState (dev));
-	__( 2451,    GetFingerState (dev));
-	__( 2453,    GetFingerState (dev));
-	__( 2455,    GetFingerState (dev));
-	__( 2457,    GetFingerState (dev));
-	__( 2459,    GetFingerState (dev));
-	__( 2461,    GetFingerState (dev));
-	__( 2463,    GetFingerState (dev));
-	__( 2465,    GetFingerState (dev));
-	__( 2467,    GetFingerState (dev));
-	__( 2469,    GetFingerState (dev));
-	__( 2471,    GetFingerState (dev));
-	__( 2473,    GetFingerState (dev));
-	__( 2475,    GetFingerState (dev));
-	__( 2477,    GetFingerState (dev));
-	__( 2479,    GetFingerState (dev));
-	__( 2481,    GetFingerState (dev));
-	__( 2483,    GetFingerState (dev));
-	__( 2485,    GetFingerState (dev));
-	__( 2487,    GetFingerState (dev));
-	__( 2489,    GetFingerState (dev));
-	__( 2491,    GetFingerState (dev));
-	__( 2493,    GetFingerState (dev));
-	__( 2495,    GetFingerState (dev));
-	__( 2497,    GetFingerState (dev));
-	__( 2499,    GetFingerState (dev));
-	__( 2501,    GetFingerState (dev));
-	__( 2503,    GetFingerState (dev));
-	__( 2505,    GetFingerState (dev));
-	__( 2507,    GetFingerState (dev));
-	__( 2509,    GetFingerState (dev));
-	__( 2511,    GetFingerState (dev));
-	__( 2513,    GetFingerState (dev));
-	__( 2515,    GetFingerState (dev));
-	__( 2517,    GetFingerState (dev));
-	__( 2519,    GetFingerState (dev));
-	__( 2521,    GetFingerState (dev));
-	__( 2523,    GetFingerState (dev));
-	__( 2525,    GetFingerState (dev));
-	__( 2527,    GetFingerState (dev));
-	__( 2529,    GetFingerState (dev));
-	__( 2531,    GetFingerState (dev));
-	__( 2533,    GetFingerState (dev));
-	__( 2535,    GetFingerState (dev));
-	__( 2537,    GetFingerState (dev));
-	__( 2539,    GetFingerState (dev));
-	__( 2541,    GetFingerState (dev));
-	__( 2543,    GetFingerState (dev));
-	__( 2545,    GetFingerState (dev));
-	__( 2547,    GetFingerState (dev));
-	__( 2549,    GetFingerState (dev));
-	__( 2551,    GetFingerState (dev));
-	__( 2553,    GetFingerState (dev));
-	__( 2555,    GetFingerState (dev));
-	__( 2557,    GetFingerState (dev));
-	__( 2559,    GetFingerState (dev));
-	__( 2561,    GetFingerState (dev));
-	__( 2563,    GetFingerState (dev));
-	__( 2565,    GetFingerState (dev));
-	__( 2567,    GetFingerState (dev));
-	__( 2569,    GetVersion (dev));
-	__( 2571,    GetFingerState (dev));
-	__( 2573,    GetFingerState (dev));
-	__( 2575,    GetFingerState (dev));
-	__( 2577,    GetFingerState (dev));
-	__( 2579,    GetFingerState (dev));
-	__( 2581,    GetFingerState (dev));
-	__( 2583,    GetFingerState (dev));
-	__( 2585,    GetFingerState (dev));
-	__( 2587,    GetFingerState (dev));
-	__( 2589,    GetFingerState (dev));
-	__( 2591,    GetFingerState (dev));
-	__( 2593,    GetFingerState (dev));
-	__( 2595,    GetFingerState (dev));
-	__( 2597,    GetFingerState (dev));
-	__( 2599,    GetFingerState (dev));
-	__( 2601,    GetFingerState (dev));
-	__( 2603,    GetFingerState (dev));
-	__( 2605,    GetFingerState (dev));
-	__( 2607,    GetFingerState (dev));
-	__( 2609,    GetFingerState (dev));
-	__( 2611,    GetFingerState (dev));
-	__( 2613,    GetFingerState (dev));
-	__( 2615,    GetFingerState (dev));
-	__( 2617,    GetFingerState (dev));
-	__( 2619,    GetFingerState (dev));
-	__( 2621,    GetFingerState (dev));
-	__( 2623,    GetFingerState (dev));
-	__( 2625,    GetFingerState (dev));
-	__( 2627,    GetFingerState (dev));
-	__( 2629,    GetFingerState (dev));
-	__( 2631,    GetFingerState (dev));
-	__( 2633,    GetFingerState (dev));
-	__( 2635,    GetFingerState (dev));
-	__( 2637,    GetFingerState (dev));
-	__( 2639,    GetFingerState (dev));
-	__( 2641,    GetFingerState (dev));
-	__( 2643,    GetFingerState (dev));
-	__( 2645,    GetFingerState (dev));
-	__( 2647,    GetFingerState (dev));
-	__( 2649,    GetFingerState (dev));
-	__( 2651,    GetFingerState (dev));
-	__( 2653,    GetFingerState (dev));
-	__( 2655,    GetFingerState (dev));
-	__( 2657,    GetFingerState (dev));
-	__( 2659,    GetFingerState (dev));
-	__( 2661,    GetFingerState (dev));
-	__( 2663,    GetFingerState (dev));
-	__( 2665,    GetFingerState (dev));
-	__( 2667,    GetFingerState (dev));
-	__( 2669,    GetFingerState (dev));
-	__( 2671,    GetFingerState (dev));
-	__( 2673,    GetFingerState (dev));
-	__( 2675,    GetFingerState (dev));
-	__( 2677,    GetFingerState (dev));
-	__( 2679,    GetFingerState (dev));
-	__( 2681,    GetFingerState (dev));
-	__( 2683,    GetFingerState (dev));
-	__( 2685,    GetFingerState (dev));
-	__( 2687,    GetFingerState (dev));
-	__( 2689,    GetFingerState (dev));
-	__( 2691,    GetFingerState (dev));
-	__( 2693,    GetFingerState (dev));
-	__( 2695,    GetFingerState (dev));
-	__( 2697,    GetFingerState (dev));
-	__( 2699,    GetFingerState (dev));
-	__( 2701,    GetFingerState (dev));
-	__( 2703,    GetFingerState (dev));
-	__( 2705,    GetFingerState (dev));
-	__( 2707,    GetFingerState (dev));
-	__( 2709,    GetFingerState (dev));
-	__( 2711,    GetFingerState (dev));
-	__( 2713,    GetFingerState (dev));
-	__( 2715,    GetFingerState (dev));
-	__( 2717,    GetFingerState (dev));
-	__( 2719,    GetFingerState (dev));
-	__( 2721,    GetFingerState (dev));
-	__( 2723,    GetFingerState (dev));
-	__( 2725,    GetFingerState (dev));
-	__( 2727,    GetFingerState (dev));
-	__( 2729,    GetFingerState (dev));
-	__( 2731,    GetFingerState (dev));
-	__( 2733,    GetFingerState (dev));
-	__( 2735,    GetFingerState (dev));
-	__( 2737,    GetFingerState (dev));
-	__( 2739,    GetFingerState (dev));
-	__( 2741,    GetFingerState (dev));
-	__( 2743,    GetFingerState (dev));
-	__( 2745,    GetFingerState (dev));
-	__( 2747,    GetFingerState (dev));
-	__( 2749,    GetFingerState (dev));
-	__( 2751,    GetFingerState (dev));
-	__( 2753,    GetFingerState (dev));
-	__( 2755,    GetFingerState (dev));
-	__( 2757,    GetFingerState (dev));
-	__( 2759,    GetFingerState (dev));
-	__( 2761,    GetFingerState (dev));
-	__( 2763,    GetFingerState (dev));
-	__( 2765,    GetFingerState (dev));
-	__( 2767,    GetFingerState (dev));
-	__( 2769,    GetFingerState (dev));
-	__( 2771,    GetFingerState (dev));
-	__( 2773,    GetFingerState (dev));
-	__( 2775,    GetFingerState (dev));
-	__( 2777,    GetFingerState (dev));
-	__( 2779,    GetFingerState (dev));
-	__( 2781,    GetFingerState (dev));
-	__( 2783,    GetFingerState (dev));
-	__( 2785,    GetFingerState (dev));
-	__( 2787,    GetFingerState (dev));
-	__( 2789,    GetFingerState (dev));
-	__( 2791,    GetFingerState (dev));
-	__( 2793,    GetFingerState (dev));
-	__( 2795,    GetFingerState (dev));
-	__( 2797,    GetFingerState (dev));
-	__( 2799,    GetFingerState (dev));
-	__( 2801,    GetFingerState (dev));
-	__( 2803,    GetFingerState (dev));
-	__( 2805,    GetFingerState (dev));
-	__( 2807,    GetFingerState (dev));
-	__( 2809,    GetFingerState (dev));
-	__( 2811,    GetFingerState (dev));
-	__( 2813,    GetFingerState (dev));
-	__( 2815,    GetFingerState (dev));
-	__( 2817,    GetFingerState (dev));
-	__( 2819,    GetFingerState (dev));
-	__( 2821,    GetFingerState (dev));
-	__( 2823,    GetFingerState (dev));
-	__( 2825,    GetFingerState (dev));
-	__( 2827,    GetFingerState (dev));
-	__( 2829,    GetFingerState (dev));
-	__( 2831,    GetFingerState (dev));
-	__( 2833,    GetFingerState (dev));
-	__( 2835,    GetFingerState (dev));
-	__( 2837,    GetFingerState (dev));
-	__( 2839,    GetFingerState (dev));
-	__( 2841,    GetFingerState (dev));
-	__( 2843,    GetFingerState (dev));
-	__( 2845,    GetFingerState (dev));
-	__( 2847,    GetFingerState (dev));
-	__( 2849,    GetFingerState (dev));
-	__( 2851,    GetFingerState (dev));
-	__( 2853,    GetFingerState (dev));
-	__( 2855,    GetFingerState (dev));
-	__( 2857,    GetFingerState (dev));
-	__( 2859,    GetFingerState (dev));
-	__( 2861,    GetFingerState (dev));
-	__( 2863,    GetFingerState (dev));
-	__( 2865,    GetFingerState (dev));
-	__( 2867,    GetFingerState (dev));
-	__( 2869,    GetFingerState (dev));
-	__( 2871,    GetFingerState (dev));
-	__( 2873,    GetFingerState (dev));
-	__( 2875,    GetFingerState (dev));
-	__( 2877,    GetFingerState (dev));
-	__( 2879,    GetFingerState (dev));
-	__( 2881,    GetFingerState (dev));
-	__( 2883,    GetFingerState (dev));
-	__( 2885,    GetFingerState (dev));
-	__( 2887,    GetFingerState (dev));
-	__( 2889,    GetFingerState (dev));
-	__( 2891,    GetFingerState (dev));
-	__( 2893,    GetFingerState (dev));
-	__( 2895,    GetFingerState (dev));
-	__( 2897,    GetFingerState (dev));
-	__( 2899,    GetFingerState (dev));
-	__( 2901,    GetFingerState (dev));
-	__( 2903,    GetFingerState (dev));
-	__( 2905,    GetFingerState (dev));
-	__( 2907,    GetFingerState (dev));
-	__( 2909,    GetFingerState (dev));
-	__( 2911,    GetFingerState (dev));
-	__( 2913,    GetFingerState (dev));
-	__( 2915,    GetFingerState (dev));
-	__( 2917,    GetFingerState (dev));
-	__( 2919,    GetFingerState (dev));
-	__( 2921,    GetFingerState (dev));
-	__( 2923,    GetFingerState (dev));
-	__( 2925,    GetFingerState (dev));
-	__( 2927,    GetFingerState (dev));
-	__( 2929,    GetFingerState (dev));
-	__( 2931,    GetFingerState (dev));
-	__( 2933,    GetFingerState (dev));
-	__( 2935,    GetFingerState (dev));
-	__( 2937,    GetFingerState (dev));
-	__( 2939,    GetFingerState (dev));
-	__( 2941,    GetFingerState (dev));
-	__( 2943,    GetFingerState (dev));
-	__( 2945,    GetFingerState (dev));
-	__( 2947,    GetFingerState (dev));
-	__( 2949,    GetFingerState (dev));
-	__( 2951,    GetFingerState (dev));
-	__( 2953,    GetFingerState (dev));
-	__( 2955,    GetFingerState (dev));
-	__( 2957,    GetFingerState (dev));
-	__( 2959,    GetFingerState (dev));
-	__( 2961,    GetFingerState (dev));
-	__( 2963,    GetFingerState (dev));
-	__( 2965,    GetFingerState (dev));
-	__( 2967,    GetFingerState (dev));
-	__( 2969,    GetFingerState (dev));
-	__( 2971,    GetFingerState (dev));
-	__( 2973,    GetFingerState (dev));
-	__( 2975,    GetFingerState (dev));
-	__( 2977,    GetFingerState (dev));
-	__( 2979,    GetFingerState (dev));
-	__( 2981,    GetFingerState (dev));
-	__( 2983,    GetFingerState (dev));
-	__( 2985,    GetFingerState (dev));
-	__( 2987,    GetFingerState (dev));
-	__( 2989,    GetFingerState (dev));
-	__( 2991,    GetFingerState (dev));
-	__( 2993,    GetFingerState (dev));
-	__( 2995,    GetFingerState (dev));
-	__( 2997,    GetFingerState (dev));
-	__( 2999,    GetFingerState (dev));
-	__( 3001,    GetFingerState (dev));
-	__( 3003,    GetFingerState (dev));
-	__( 3005,    GetFingerState (dev));
-	__( 3007,    GetFingerState (dev));
-	__( 3009,    GetFingerState (dev));
-	__( 3011,    GetFingerState (dev));
-	__( 3013,    GetFingerState (dev));
-	__( 3015,    GetFingerState (dev));
-	__( 3017,    GetFingerState (dev));
-	__( 3019,    GetFingerState (dev));
-	__( 3021,    GetFingerState (dev));
-	__( 3023,    GetFingerState (dev));
-	__( 3025,    GetFingerState (dev));
-	__( 3027,    GetFingerState (dev));
-	__( 3029,    GetFingerState (dev));
-	__( 3031,    GetFingerState (dev));
-	__( 3033,    GetFingerState (dev));
-	__( 3035,    GetFingerState (dev));
-	__( 3037,    GetFingerState (dev));
-	__( 3039,    GetFingerState (dev));
-	__( 3041,    GetFingerState (dev));
-	__( 3043,    GetFingerState (dev));
-	__( 3045,    GetFingerState (dev));
-	__( 3047,    GetFingerState (dev));
-	__( 3049,    GetFingerState (dev));
-	__( 3051,    GetFingerState (dev));
-	__( 3053,    GetFingerState (dev));
-	__( 3055,    GetFingerState (dev));
-	__( 3057,    GetFingerState (dev));
-	__( 3059,    GetFingerState (dev));
-	__( 3061,    GetFingerState (dev));
-	__( 3063,    GetFingerState (dev));
-	__( 3065,    GetFingerState (dev));
-	__( 3067,    GetFingerState (dev));
-	__( 3069,    GetFingerState (dev));
-	__( 3071,    GetFingerState (dev));
-	__( 3073,    GetFingerState (dev));
-	__( 3075,    GetFingerState (dev));
-	__( 3077,    GetFingerState (dev));
-	__( 3079,    GetFingerState (dev));
-	__( 3081,    GetFingerState (dev));
-	__( 3083,    GetFingerState (dev));
-	__( 3085,    GetFingerState (dev));
-	__( 3087,    GetFingerState (dev));
-	__( 3089,    GetFingerState (dev));
-	__( 3091,    GetFingerState (dev));
-	__( 3093,    GetFingerState (dev));
-	__( 3095,    GetFingerState (dev));
-	__( 3097,    GetFingerState (dev));
-	__( 3099,    GetFingerState (dev));
-	__( 3101,    GetFingerState (dev));
-	__( 3103,    GetFingerState (dev));
-	__( 3105,    GetFingerState (dev));
-	__( 3107,    GetFingerState (dev));
-	__( 3109,    GetFingerState (dev));
-	__( 3111,    GetFingerState (dev));
-	__( 3113,    GetFingerState (dev));
-	__( 3115,    GetFingerState (dev));
-	__( 3117,    GetFingerState (dev));
-	__( 3119,    GetFingerState (dev));
-	__( 3121,    GetFingerState (dev));
-	__( 3123,    GetFingerState (dev));
-	__( 3125,    GetFingerState (dev));
-	__( 3127,    GetFingerState (dev));
-	__( 3129,    GetFingerState (dev));
-	__( 3131,    GetFingerState (dev));
-	__( 3133,    GetFingerState (dev));
-	__( 3135,    GetFingerState (dev));
-	__( 3137,    GetFingerState (dev));
-	__( 3139,    GetFingerState (dev));
-	__( 3141,    GetFingerState (dev));
-	__( 3143,    GetFingerState (dev));
-	__( 3145,    GetFingerState (dev));
-	__( 3147,    GetFingerState (dev));
-	__( 3149,    GetFingerState (dev));
-	__( 3151,    GetFingerState (dev));
-	__( 3153,    GetFingerState (dev));
-	__( 3155,    GetFingerState (dev));
-	__( 3157,    GetFingerState (dev));
-	__( 3159,    GetFingerState (dev));
-	__( 3161,    GetFingerState (dev));
-	__( 3163,    GetFingerState (dev));
-	__( 3165,    GetFingerState (dev));
-	__( 3167,    GetFingerState (dev));
-	__( 3169,    GetFingerState (dev));
-	__( 3171,    GetFingerState (dev));
-	__( 3173,    GetFingerState (dev));
-	__( 3175,    GetFingerState (dev));
-	__( 3177,    GetFingerState (dev));
-	__( 3179,    GetFingerState (dev));
-	__( 3181,    GetFingerState (dev));
-	__( 3183,    GetFingerState (dev));
-	__( 3185,    GetFingerState (dev));
-	__( 3187,    GetFingerState (dev));
-	__( 3189,    GetFingerState (dev));
-	__( 3191,    GetFingerState (dev));
-	__( 3193,    GetFingerState (dev));
-	__( 3195,    GetFingerState (dev));
-	__( 3197,    GetFingerState (dev));
-	__( 3199,    GetFingerState (dev));
-	__( 3201,    GetFingerState (dev));
-	__( 3203,    GetFingerState (dev));
-	__( 3205,    GetFingerState (dev));
-	__( 3207,    GetFingerState (dev));
-	__( 3209,    GetFingerState (dev));
-	__( 3211,    GetFingerState (dev));
-	__( 3213,    GetFingerState (dev));
-	__( 3215,    GetFingerState (dev));
-	__( 3217,    GetFingerState (dev));
-	__( 3219,    GetFingerState (dev));
-	__( 3221,    GetFingerState (dev));
-	__( 3223,    GetFingerState (dev));
-	__( 3225,    GetFingerState (dev));
-	__( 3227,    GetFingerState (dev));
-	__( 3229,    GetFingerState (dev));
-	__( 3231,    GetFingerState (dev));
-	__( 3233,    GetFingerState (dev));
-	__( 3235,    GetFingerState (dev));
-	__( 3237,    GetFingerState (dev));
-	__( 3239,    GetFingerState (dev));
-	__( 3241,    GetFingerState (dev));
-	__( 3243,    GetFingerState (dev));
-	__( 3245,    GetFingerState (dev));
-	__( 3247,    GetFingerState (dev));
-	__( 3249,    GetFingerState (dev));
-	__( 3251,    GetFingerState (dev));
-	__( 3253,    GetFingerState (dev));
-	__( 3255,    GetFingerState (dev));
-	__( 3257,    GetFingerState (dev));
-	__( 3259,    GetFingerState (dev));
-	__( 3261,    GetFingerState (dev));
-	__( 3263,    GetFingerState (dev));
-	__( 3265,    GetFingerState (dev));
-	__( 3267,    GetFingerState (dev));
-	__( 3269,    GetFingerState (dev));
-	__( 3271,    GetFingerState (dev));
-	__( 3273,    GetFingerState (dev));
-	__( 3275,    GetFingerState (dev));
-	__( 3277,    GetFingerState (dev));
-	__( 3279,    GetFingerState (dev));
-	__( 3281,    GetFingerState (dev));
-	__( 3283,    GetFingerState (dev));
-	__( 3285,    GetFingerState (dev));
-	__( 3287,    GetFingerState (dev));
-	__( 3289,    GetFingerState (dev));
-	__( 3291,    GetFingerState (dev));
-	__( 3293,    GetFingerState (dev));
-	__( 3295,    GetFingerState (dev));
-	__( 3297,    GetFingerState (dev));
-	__( 3299,    GetFingerState (dev));
-	__( 3301,    GetFingerState (dev));
-	__( 3303,    GetFingerState (dev));
-	__( 3305,    GetFingerState (dev));
-	__( 3307,    GetFingerState (dev));
-	__( 3309,    GetFingerState (dev));
-	__( 3311,    GetFingerState (dev));
-	__( 3313,    GetFingerState (dev));
-	__( 3315,    GetFingerState (dev));
-	__( 3317,    GetFingerState (dev));
-	__( 3319,    GetFingerState (dev));
-	__( 3321,    GetFingerState (dev));
-	__( 3323,    GetFingerState (dev));
-	__( 3325,    GetFingerState (dev));
-	__( 3327,    GetFingerState (dev));
-	__( 3329,    GetFingerState (dev));
-	__( 3331,    GetFingerState (dev));
-	__( 3333,    GetFingerState (dev));
-	__( 3335,    GetFingerState (dev));
-	__( 3337,    GetFingerState (dev));
-	__( 3339,    GetFingerState (dev));
-	__( 3341,    GetFingerState (dev));
-	__( 3343,    GetFingerState (dev));
-	__( 3345,    GetFingerState (dev));
-	__( 3347,    GetFingerState (dev));
-	__( 3349,    GetFingerState (dev));
-	__( 3351,    GetFingerState (dev));
-	__( 3353,    GetFingerState (dev));
-	__( 3355,    GetFingerState (dev));
-	__( 3357,    GetFingerState (dev));
-	__( 3359,    GetFingerState (dev));
-	__( 3361,    GetFingerState (dev));
-	__( 3363,    GetFingerState (dev));
-	__( 3365,    GetFingerState (dev));
-	__( 3367,    GetFingerState (dev));
-	__( 3369,    GetFingerState (dev));
-	__( 3371,    GetFingerState (dev));
-	__( 3373,    GetFingerState (dev));
-	__( 3375,    GetFingerState (dev));
-	__( 3377,    GetFingerState (dev));
-	__( 3379,    GetFingerState (dev));
-	__( 3381,    GetFingerState (dev));
-	__( 3383,    GetFingerState (dev));
-	__( 3385,    GetFingerState (dev));
-	__( 3387,    GetFingerState (dev));
-	__( 3389,    GetFingerState (dev));
-	__( 3391,    GetFingerState (dev));
-	__( 3393,    GetFingerState (dev));
-	__( 3395,    GetFingerState (dev));
-	__( 3397,    GetFingerState (dev));
-	__( 3399,    GetFingerState (dev));
-	__( 3401,    GetFingerState (dev));
-	__( 3403,    GetFingerState (dev));
-	__( 3405,    GetFingerState (dev));
-	__( 3407,    GetFingerState (dev));
-	__( 3409,    GetFingerState (dev));
-	__( 3411,    GetFingerState (dev));
-	__( 3413,    GetFingerState (dev));
-	__( 3415,    GetFingerState (dev));
-	__( 3417,    GetFingerState (dev));
-	__( 3419,    GetFingerState (dev));
-	__( 3421,    GetFingerState (dev));
-	__( 3423,    GetFingerState (dev));
-	__( 3425,    GetFingerState (dev));
-	__( 3427,    GetFingerState (dev));
-	__( 3429,    GetFingerState (dev));
-	__( 3431,    GetFingerState (dev));
-	__( 3433,    GetFingerState (dev));
-	__( 3435,    GetFingerState (dev));
-	__( 3437,    GetFingerState (dev));
-	__( 3439,    GetFingerState (dev));
-	__( 3441,    GetFingerState (dev));
-	__( 3443,    GetFingerState (dev));
-	__( 3445,    GetFingerState (dev));
-	__( 3447,    GetFingerState (dev));
-	__( 3449,    GetFingerState (dev));
-	__( 3451,    GetFingerState (dev));
-	__( 3453,    GetFingerState (dev));
-	__( 3455,    GetFingerState (dev));
-	__( 3457,    GetFingerState (dev));
-	__( 3459,    GetFingerState (dev));
-	__( 3461,    GetFingerState (dev));
-	__( 3463,    GetFingerState (dev));
-	__( 3465,    GetFingerState (dev));
-	__( 3467,    GetFingerState (dev));
-	__( 3469,    GetFingerState (dev));
-	__( 3471,    GetFingerState (dev));
-	__( 3473,    GetFingerState (dev));
-	__( 3475,    GetFingerState (dev));
-	__( 3477,    GetFingerState (dev));
-	__( 3479,    GetFingerState (dev));
-	__( 3481,    GetFingerState (dev));
-	__( 3483,    GetFingerState (dev));
-	__( 3485,    GetFingerState (dev));
-	__( 3487,    GetFingerState (dev));
-	__( 3489,    GetFingerState (dev));
-	__( 3491,    GetFingerState (dev));
-	__( 3493,    GetFingerState (dev));
-	__( 3495,    GetFingerState (dev));
-	__( 3497,    GetFingerState (dev));
-	__( 3499,    GetFingerState (dev));
-	__( 3501,    GetFingerState (dev));
-	__( 3503,    GetFingerState (dev));
-	__( 3505,    GetFingerState (dev));
-	__( 3507,    GetFingerState (dev));
-	__( 3509,    GetFingerState (dev));
-	__( 3511,    GetFingerState (dev));
-	__( 3513,    GetFingerState (dev));
-	__( 3515,    GetFingerState (dev));
-	__( 3517,    GetFingerState (dev));
-	__( 3519,    GetFingerState (dev));
-	__( 3521,    GetFingerState (dev));
-	__( 3523,    GetFingerState (dev));
-	__( 3525,    GetFingerState (dev));
-	__( 3527,    GetFingerState (dev));
-	__( 3529,    GetFingerState (dev));
-	__( 3531,    GetFingerState (dev));
-	__( 3533,    GetFingerState (dev));
-	__( 3535,    GetFingerState (dev));
-	__( 3537,    GetFingerState (dev));
-	__( 3539,    GetFingerState (dev));
-	__( 3541,    GetFingerState (dev));
-	__( 3543,    GetFingerState (dev));
-	__( 3545,    GetFingerState (dev));
-	__( 3547,    GetFingerState (dev));
-	__( 3549,    GetFingerState (dev));
-	__( 3551,    GetFingerState (dev));
-	__( 3553,    GetFingerState (dev));
-	__( 3555,    GetFingerState (dev));
-	__( 3557,    GetFingerState (dev));
-	__( 3559,    GetFingerState (dev));
-	__( 3561,    GetFingerState (dev));
-	__( 3563,    GetFingerState (dev));
-	__( 3565,    GetFingerState (dev));
-	__( 3567,    GetFingerState (dev));
-	__( 3569,    GetFingerState (dev));
-	__( 3571,    GetFingerState (dev));
-	__( 3573,    GetFingerState (dev));
-	__( 3575,    GetFingerState (dev));
-	__( 3577,    GetFingerState (dev));
-	__( 3579,    GetFingerState (dev));
-	__( 3581,    GetFingerState (dev));
-	__( 3583,    GetFingerState (dev));
-	__( 3585,    GetFingerState (dev));
-	__( 3587,    GetFingerState (dev));
-	__( 3589,    GetFingerState (dev));
-	__( 3591,    GetFingerState (dev));
-	__( 3593,    GetFingerState (dev));
-	__( 3595,    GetFingerState (dev));
-	__( 3597,    GetFingerState (dev));
-	__( 3599,    GetFingerState (dev));
-	__( 3601,    GetFingerState (dev));
-	__( 3603,    GetFingerState (dev));
-	__( 3605,    GetFingerState (dev));
-	__( 3607,    GetFingerState (dev));
-	__( 3609,    GetFingerState (dev));
-	__( 3611,    GetFingerState (dev));
-	__( 3613,    GetFingerState (dev));
-	__( 3615,    GetFingerState (dev));
-	__( 3617,    GetFingerState (dev));
-	__( 3619,    GetFingerState (dev));
-	__( 3621,    GetFingerState (dev));
-	__( 3623,    GetFingerState (dev));
-	__( 3625,    GetFingerState (dev));
-	__( 3627,    GetFingerState (dev));
-	__( 3629,    GetFingerState (dev));
-	__( 3631,    GetFingerState (dev));
-	__( 3633,    GetFingerState (dev));
-	__( 3635,    GetFingerState (dev));
-	__( 3637,    GetFingerState (dev));
-	__( 3639,    GetFingerState (dev));
-	__( 3641,    GetFingerState (dev));
-	__( 3643,    GetFingerState (dev));
-	__( 3645,    GetFingerState (dev));
-	__( 3647,    GetFingerState (dev));
-	__( 3649,    GetFingerState (dev));
-	__( 3651,    GetFingerState (dev));
-	__( 3653,    GetFingerState (dev));
-	__( 3655,    GetFingerState (dev));
-	__( 3657,    GetFingerState (dev));
-	__( 3659,    GetFingerState (dev));
-	__( 3661,    GetFingerState (dev));
-	__( 3663,    GetFingerState (dev));
-	__( 3665,    GetFingerState (dev));
-	__( 3667,    GetFingerState (dev));
-	__( 3669,    GetFingerState (dev));
-	__( 3671,    GetFingerState (dev));
-	__( 3673,    GetFingerState (dev));
-	__( 3675,    GetFingerState (dev));
-	__( 3677,    GetFingerState (dev));
-	__( 3679,    GetFingerState (dev));
-	__( 3681,    GetFingerState (dev));
-	__( 3683,    GetFingerState (dev));
-	__( 3685,    GetFingerState (dev));
-	__( 3687,    GetFingerState (dev));
-	__( 3689,    GetFingerState (dev));
-	__( 3691,    GetFingerState (dev));
-	__( 3693,    GetFingerState (dev));
-	__( 3695,    GetFingerState (dev));
-	__( 3697,    GetFingerState (dev));
-	__( 3699,    GetFingerState (dev));
-	__( 3701,    GetFingerState (dev));
-	__( 3703,    GetFingerState (dev));
-	__( 3705,    GetFingerState (dev));
-	__( 3707,    GetFingerState (dev));
-	__( 3709,    GetFingerState (dev));
-	__( 3711,    GetFingerState (dev));
-	__( 3713,    GetFingerState (dev));
-	__( 3715,    GetFingerState (dev));
-	__( 3717,    GetFingerState (dev));
-	__( 3719,    GetFingerState (dev));
-	__( 3721,    GetFingerState (dev));
-	__( 3723,    GetFingerState (dev));
-	__( 3725,    GetFingerState (dev));
-	__( 3727,    GetFingerState (dev));
-	__( 3729,    GetFingerState (dev));
-	__( 3731,    GetFingerState (dev));
-	__( 3733,    GetFingerState (dev));
-	__( 3735,    GetFingerState (dev));
-	__( 3737,    GetFingerState (dev));
-	__( 3739,    GetFingerState (dev));
-	__( 3741,    GetFingerState (dev));
-	__( 3743,    GetFingerState (dev));
-	__( 3745,    GetFingerState (dev));
-	__( 3747,    GetFingerState (dev));
-	__( 3749,    GetFingerState (dev));
-	__( 3751,    GetFingerState (dev));
-	__( 3753,    GetFingerState (dev));
-	__( 3755,    GetFingerState (dev));
-	__( 3757,    GetFingerState (dev));
-	__( 3759,    GetFingerState (dev));
-	__( 3761,    GetFingerState (dev));
-	__( 3763,    GetFingerState (dev));
-	__( 3765,    GetFingerState (dev));
-	__( 3767,    GetFingerState (dev));
-	__( 3769,    GetFingerState (dev));
-	__( 3771,    GetFingerState (dev));
-	__( 3773,    GetFingerState (dev));
-	__( 3775,    GetFingerState (dev));
-	__( 3777,    GetFingerState (dev));
-	__( 3779,    GetFingerState (dev));
-	__( 3781,    GetFingerState (dev));
-	__( 3783,    GetFingerState (dev));
-	__( 3785,    GetFingerState (dev));
-	__( 3787,    GetFingerState (dev));
-	__( 3789,    GetFingerState (dev));
-	__( 3791,    GetFingerState (dev));
-	__( 3793,    GetFingerState (dev));
-	__( 3795,    GetFingerState (dev));
-	__( 3797,    GetFingerState (dev));
-	__( 3799,    GetFingerState (dev));
-	__( 3801,    GetFingerState (dev));
-	__( 3803,    GetFingerState (dev));
-	__( 3805,    GetFingerState (dev));
-	__( 3807,    GetFingerState (dev));
-	__( 3809,    GetFingerState (dev));
-	__( 3811,    GetFingerState (dev));
-	__( 3813,    GetFingerState (dev));
-	__( 3815,    GetFingerState (dev));
-	__( 3817,    GetFingerState (dev));
-	__( 3819,    GetFingerState (dev));
-	__( 3821,    GetFingerState (dev));
-	__( 3823,    GetFingerState (dev));
-	__( 3825,    GetFingerState (dev));
-	__( 3827,    GetFingerState (dev));
-	__( 3829,    GetFingerState (dev));
-	__( 3831,    GetFingerState (dev));
-	__( 3833,    GetFingerState (dev));
-	__( 3835,    GetFingerState (dev));
-	__( 3837,    GetFingerState (dev));
-	__( 3839,    GetFingerState (dev));
-	__( 3841,    GetFingerState (dev));
-	__( 3843,    GetFingerState (dev));
-	__( 3845,    GetFingerState (dev));
-	__( 3847,    GetFingerState (dev));
-	__( 3849,    GetFingerState (dev));
-	__( 3851,    GetFingerState (dev));
-	__( 3853,    GetFingerState (dev));
-	__( 3855,    GetFingerState (dev));
-	__( 3857,    GetFingerState (dev));
-	__( 3859,    GetFingerState (dev));
-	__( 3861,    GetFingerState (dev));
-	__( 3863,    GetFingerState (dev));
-	__( 3865,    GetFingerState (dev));
-	__( 3867,    GetFingerState (dev));
-	__( 3869,    GetFingerState (dev));
-	__( 3871,    GetFingerState (dev));
-	__( 3873,    GetFingerState (dev));
-	__( 3875,    GetFingerState (dev));
-	__( 3877,    GetFingerState (dev));
-	__( 3879,    GetFingerState (dev));
-	__( 3881,    GetFingerState (dev));
-	__( 3883,    GetFingerState (dev));
-	__( 3885,    GetFingerState (dev));
-	__( 3887,    GetFingerState (dev));
-	__( 3889,    GetFingerState (dev));
-	__( 3891,    GetFingerState (dev));
-	__( 3893,    GetFingerState (dev));
-	__( 3895,    GetFingerState (dev));
-	__( 3897,    GetFingerState (dev));
-	__( 3899,    GetFingerState (dev));
-	__( 3901,    GetFingerState (dev));
-	__( 3903,    GetFingerState (dev));
-	__( 3905,    GetFingerState (dev));
-	__( 3907,    GetFingerState (dev));
-	__( 3909,    GetFingerState (dev));
-	__( 3911,    GetFingerState (dev));
-	__( 3913,    GetFingerState (dev));
-	__( 3915,    GetFingerState (dev));
-	__( 3917,    GetFingerState (dev));
-	__( 3919,    GetFingerState (dev));
-	__( 3921,    GetFingerState (dev));
-	__( 3923,    GetFingerState (dev));
-	__( 3925,    GetFingerState (dev));
-	__( 3927,    GetFingerState (dev));
-	__( 3929,    GetFingerState (dev));
-	__( 3931,    GetFingerState (dev));
-	__( 3933,    GetFingerState (dev));
-	__( 3935,    GetFingerState (dev));
-	__( 3937,    GetFingerState (dev));
-	__( 3939,    GetFingerState (dev));
-	__( 3941,    GetFingerState (dev));
-	__( 3943,    GetFingerState (dev));
-	__( 3945,    GetFingerState (dev));
-	__( 3947,    GetFingerState (dev));
-	__( 3949,    GetFingerState (dev));
-	__( 3951,    GetFingerState (dev));
-	__( 3953,    GetFingerState (dev));
-	__( 3955,    GetFingerState (dev));
-	__( 3957,    GetFingerState (dev));
-	__( 3959,    GetFingerState (dev));
-	__( 3961,    GetFingerState (dev));
-	__( 3963,    GetFingerState (dev));
-	__( 3965,    GetFingerState (dev));
-	__( 3967,    GetFingerState (dev));
-	__( 3969,    GetFingerState (dev));
-	__( 3971,    GetFingerState (dev));
-	__( 3973,    GetFingerState (dev));
-	__( 3975,    GetFingerState (dev));
-	__( 3977,    GetFingerState (dev));
-	__( 3979,    GetFingerState (dev));
-	__( 3981,    GetFingerState (dev));
-	__( 3983,    GetFingerState (dev));
-	__( 3985,    GetFingerState (dev));
-	__( 3987,    GetFingerState (dev));
-	__( 3989,    GetFingerState (dev));
-	__( 3991,    GetFingerState (dev));
-	__( 3993,    GetFingerState (dev));
-	__( 3995,    GetFingerState (dev));
-	__( 3997,    GetFingerState (dev));
-	__( 3999,    GetFingerState (dev));
-	__( 4001,    GetFingerState (dev));
-	__( 4003,    GetFingerState (dev));
-	__( 4005,    GetFingerState (dev));
-	__( 4007,    GetFingerState (dev));
-	__( 4009,    GetFingerState (dev));
-	__( 4011,    GetFingerState (dev));
-	__( 4013,    GetFingerState (dev));
-	__( 4015,    GetFingerState (dev));
-	__( 4017,    GetFingerState (dev));
-	__( 4019,    GetFingerState (dev));
-	__( 4021,    GetFingerState (dev));
-	__( 4023,    GetFingerState (dev));
-	__( 4025,    GetFingerState (dev));
-	__( 4027,    GetFingerState (dev));
-	__( 4029,    GetFingerState (dev));
-	__( 4031,    GetFingerState (dev));
-	__( 4033,    GetFingerState (dev));
-	__( 4035,    GetFingerState (dev));
-	__( 4037,    GetFingerState (dev));
-	__( 4039,    GetFingerState (dev));
-	__( 4041,    GetFingerState (dev));
-	__( 4043,    GetFingerState (dev));
-	__( 4045,    GetFingerState (dev));
-	__( 4047,    GetFingerState (dev));
-	__( 4049,    GetFingerState (dev));
-	__( 4051,    GetFingerState (dev));
-	__( 4053,    GetFingerState (dev));
-	__( 4055,    GetFingerState (dev));
-	__( 4057,    GetFingerState (dev));
-	__( 4059,    GetFingerState (dev));
-	__( 4061,    GetFingerState (dev));
-	__( 4063,    GetFingerState (dev));
-	__( 4065,    GetFingerState (dev));
-	__( 4067,    GetFingerState (dev));
-	__( 4069,    GetFingerState (dev));
-	__( 4071,    GetFingerState (dev));
-	__( 4073,    GetFingerState (dev));
-	__( 4075,    GetFingerState (dev));
-	__( 4077,    GetFingerState (dev));
-	__( 4079,    GetFingerState (dev));
-	__( 4081,    GetFingerState (dev));
-	__( 4083,    GetFingerState (dev));
-	__( 4085,    GetFingerState (dev));
-	__( 4087,    GetFingerState (dev));
-	__( 4089,    GetFingerState (dev));
-	__( 4091,    GetFingerState (dev));
-	__( 4093,    GetFingerState (dev));
-	__( 4095,    GetFingerState (dev));
-	__( 4097,    GetFingerState (dev));
-	__( 4099,    GetFingerState (dev));
-	__( 4101,    GetFingerState (dev));
-	__( 4103,    GetFingerState (dev));
-	__( 4105,    GetFingerState (dev));
-	__( 4107,    GetFingerState (dev));
-	__( 4109,    GetFingerState (dev));
-	__( 4111,    GetFingerState (dev));
-	__( 4113,    GetFingerState (dev));
-	__( 4115,    GetFingerState (dev));
-	__( 4117,    GetFingerState (dev));
-	__( 4119,    GetFingerState (dev));
-	__( 4121,    GetFingerState (dev));
-	__( 4123,    GetFingerState (dev));
-	__( 4125,    GetFingerState (dev));
-	__( 4127,    GetFingerState (dev));
-	__( 4129,    GetFingerState (dev));
-	__( 4131,    GetFingerState (dev));
-	__( 4133,    GetFingerState (dev));
-	__( 4135,    GetFingerState (dev));
-	return 0;
-}
-struct result_table GFF_results =
-{
-	4135,
-	{
-	[     8 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[    10 ] = {   8, "\x12\x00\x00\x00\x00\x00\xe0\x68" },
-	[    12 ] = {   8, "\x12\x00\x00\x00\xbb\x2f\x01\x00" },
-	[    14 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[    16 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[    18 ] = {   8, "\x12\x00\x00\x00\x2b\xe9\xc3\xce" },
-	[    20 ] = {   6, "\x04\x00\x00\x00\x0a\x00" },
-	[    22 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x48\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[    24 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[    26 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[    28 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[    30 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[    32 ] = {   6, "\x04\x00\x00\x00\x04\x00" },
-	[    34 ] = {   6, "\x04\x00\x00\x00\xf4\x01" },
-	[    36 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[    38 ] = {   4, "\x0e\x00\x00\x00" },
-	[    41 ] = {   4, "\x03\x00\x00\x00" },
-	[    45 ] = {   4, "\x0e\x00\x00\x00" },
-	[    48 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[    50 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[    52 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[    54 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[    56 ] = {   6, "\x05\x00\x00\x00\x02\x00" },
-	[    58 ] = {   6, "\x05\x00\x00\x00\x0b\x01" },
-	[    60 ] = {   6, "\x05\x00\x00\x00\x0c\x01" },
-	[    62 ] = {   6, "\x05\x00\x00\x00\x0d\x01" },
-	[    64 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[    66 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[    68 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[    70 ] = {   6, "\x05\x00\x00\x00\xb0\x04" },
-	[    72 ] = {   6, "\x05\x00\x00\x00\x1b\x00" },
-	[    74 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[    76 ] = {   6, "\x05\x00\x03\x00\x01\x00" },
-	[    78 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[    80 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[    82 ] = {   6, "\x05\x00\x00\x00\x04\x00" },
-	[    84 ] = {   6, "\x05\x00\x00\x00\x0c\x01" },
-	[    86 ] = {   6, "\x05\x00\x00\x00\x0d\x01" },
-	[    88 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[    90 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[    92 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[    94 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[    96 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[    98 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[   100 ] = {   6, "\x05\x00\x00\x00\x46\x00" },
-	[   102 ] = {   6, "\x05\x00\x03\x00\x46\x00" },
-	[   104 ] = {   6, "\x05\x00\x00\x00\x0e\x01" },
-	[   106 ] = {   6, "\x05\x00\x00\x00\x0f\x01" },
-	[   108 ] = {   6, "\x05\x00\x00\x00\x04\x00" },
-	[   110 ] = {   6, "\x05\x00\x00\x00\x03\x00" },
-	[   112 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   114 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   116 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   118 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   120 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   122 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   124 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   126 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   128 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   130 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   132 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   134 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[   136 ] = {   6, "\x05\x00\x03\x00\x01\x00" },
-	[   138 ] = {   6, "\x05\x00\x00\x00\x10\x00" },
-	[   140 ] = {   6, "\x05\x00\x00\x00\x05\x00" },
-	[   142 ] = {   6, "\x05\x00\x00\x00\xf5\x00" },
-	[   144 ] = {   6, "\x05\x00\x00\x00\x0c\x00" },
-	[   146 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   148 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   150 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   152 ] = {   6, "\x05\x00\x00\x00\xb4\x00" },
-	[   154 ] = {   6, "\x05\x00\x00\x00\x96\x00" },
-	[   156 ] = {   6, "\x05\x00\x00\x00\x8c\x00" },
-	[   158 ] = {   6, "\x05\x00\x00\x00\x64\x00" },
-	[   160 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[   162 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[   164 ] = {   6, "\x05\x00\x00\x00\x20\x00" },
-	[   166 ] = {   6, "\x05\x00\x00\x00\x64\x00" },
-	[   168 ] = {   6, "\x05\x00\x00\x00\xc8\x00" },
-	[   170 ] = {   6, "\x05\x00\x00\x00\xc8\x00" },
-	[   172 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   174 ] = {   6, "\x05\x00\x00\x00\x1a\x01" },
-	[   176 ] = {   6, "\x05\x00\x00\x00\x14\x00" },
-	[   178 ] = {   6, "\x04\x00\x03\x00\x14\x00" },
-	[   180 ] = {   6, "\x04\x00\x03\x00\x14\x00" },
-	[   182 ] = {   6, "\x04\x00\x00\x00\x70\x00" },
-	[   184 ] = {   6, "\x04\x00\x03\x00\x70\x00" },
-	[   186 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x48\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[   188 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[   190 ] = {   9, "\x14\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[   192 ] = {   6, "\x05\x00\x00\x00\x18\x01" },
-	[   194 ] = {  34, "\x06\x00\x00\x00\x00\x00\x08\x00\x0a\x0a\x12\x12\xe6\xeb\xe6\xe4\xf0\xec\xf0\xf2\x03\x00\x31\x00\x20\x00\x12\x00\x14\x00\xff\xff\x85\x00" },
-	[   196 ] = {   6, "\x05\x00\x00\x00\xf5\x00" },
-	[   198 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[   200 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x48\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[   202 ] = {   6, "\x05\x00\x00\x00\x03\x00" },
-	[   204 ] = {   6, "\x04\x00\x00\x00\xb4\x1e" },
-	[   206 ] = {   6, "\x05\x00\x00\x00\x20\x03" },
-	[   208 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[   210 ] = {   4, "\x03\x00\x00\x00" },
-	[   214 ] = {   6, "\x05\x00\x00\x00\xb4\x1e" },
-	[   216 ] = {   8, "\x12\x00\x00\x00\xf0\xec\x00\x00" },
-	[   218 ] = {   8, "\x12\x00\x00\x00\xf0\xf2\x00\x00" },
-	[   220 ] = {   4, "\x13\x00\x00\x00" },
-	[   222 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[   224 ] = {   4, "\x13\x00\x00\x00" },
-	[   226 ] = {   8, "\x12\x00\x00\x00\xfb\x00\x00\x00" },
-	[   228 ] = {   8, "\x12\x00\x00\x00\x03\x00\x00\x00" },
-	[   230 ] = {   8, "\x12\x00\x00\x00\x10\x00\x00\x00" },
-	[   232 ] = {   4, "\x13\x00\x00\x00" },
-	[   234 ] = {   4, "\x03\x00\x00\x00" },
-	[   238 ] = {   4, "\x13\x00\x00\x00" },
-	[   240 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[   242 ] = {   4, "\x13\x00\x00\x00" },
-	[   244 ] = {   8, "\x12\x00\x00\x00\xfb\x00\x00\x00" },
-	[   246 ] = {   8, "\x12\x00\x00\x00\x03\x00\x00\x00" },
-	[   248 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[   250 ] = {   4, "\x03\x00\x00\x00" },
-	[   254 ] = {   8, "\x12\x00\x00\x00\x14\x00\x00\x00" },
-	[   256 ] = {   8, "\x12\x00\x00\x00\xc0\x21\x00\x00" },
-	[   258 ] = {   8, "\x12\x00\x00\x00\x31\x00\x00\x00" },
-	[   260 ] = {   4, "\x13\x00\x00\x00" },
-	[   262 ] = {   4, "\x13\x00\x00\x00" },
-	[   264 ] = {   4, "\x13\x00\x00\x00" },
-	[   266 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   268 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   270 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   272 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   274 ] = {   4, "\x03\x00\x00\x00" },
-	[   278 ] = {   4, "\x13\x00\x00\x00" },
-	[   280 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[   282 ] = {   4, "\x13\x00\x00\x00" },
-	[   284 ] = {   8, "\x12\x00\x00\x00\xfb\x00\x00\x00" },
-	[   286 ] = {   8, "\x12\x00\x00\x00\x03\x00\x00\x00" },
-	[   288 ] = {   8, "\x12\x00\x00\x00\x10\x00\x00\x00" },
-	[   290 ] = {   4, "\x13\x00\x00\x00" },
-	[   292 ] = {   4, "\x03\x00\x00\x00" },
-	[   296 ] = {   4, "\x13\x00\x00\x00" },
-	[   298 ] = {   4, "\x03\x00\x00\x00" },
-	[   302 ] = {   4, "\x13\x00\x00\x00" },
-	[   304 ] = {   4, "\x03\x00\x00\x00" },
-	[   308 ] = {   4, "\x13\x00\x00\x00" },
-	[   310 ] = {   4, "\x03\x00\x00\x00" },
-	[   314 ] = {   4, "\x13\x00\x00\x00" },
-	[   316 ] = {   4, "\x03\x00\x00\x00" },
-	[   320 ] = {   4, "\x13\x00\x00\x00" },
-	[   322 ] = {   4, "\x03\x00\x00\x00" },
-	[   326 ] = {   4, "\x13\x00\x00\x00" },
-	[   328 ] = {   4, "\x03\x00\x00\x00" },
-	[   332 ] = {   4, "\x13\x00\x00\x00" },
-	[   334 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[   336 ] = {   4, "\x13\x00\x00\x00" },
-	[   338 ] = {   8, "\x12\x00\x00\x00\xfb\x00\x00\x00" },
-	[   340 ] = {   8, "\x12\x00\x00\x00\x03\x00\x00\x00" },
-	[   342 ] = {   8, "\x12\x00\x00\x00\x10\x00\x00\x00" },
-	[   344 ] = {   4, "\x13\x00\x00\x00" },
-	[   346 ] = {   4, "\x03\x00\x00\x00" },
-	[   350 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[   352 ] = {   6, "\x05\x00\x00\x00\x12\x00" },
-	[   354 ] = {   6, "\x05\x00\x00\x00\xf0\x21" },
-	[   356 ] = {   4, "\x13\x00\x00\x00" },
-	[   358 ] = {   4, "\x13\x00\x00\x00" },
-	[   360 ] = {   4, "\x13\x00\x00\x00" },
-	[   362 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[   364 ] = {   4, "\x0e\x00\x00\x00" },
-	[   367 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[   369 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[   371 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[   373 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[   375 ] = {   4, "\x03\x00\x00\x00" },
-	[   379 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[   381 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[   383 ] = {   4, "\x0e\x00\x00\x00" },
-	[   386 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[   388 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[   390 ] = {   4, "\x03\x00\x00\x00" },
-	[   392 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   394 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   396 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   398 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   400 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   402 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   404 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   406 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   408 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   410 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   412 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   414 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   416 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   418 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   420 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   422 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   424 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   426 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   428 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   430 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   432 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   434 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   436 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   438 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   440 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   442 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   444 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   446 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   448 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   450 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   452 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   454 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   456 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   458 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   460 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   462 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   464 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   466 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   468 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   470 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   472 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   474 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   476 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   478 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   480 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   482 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   484 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   486 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   488 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   490 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   492 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   494 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   496 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   498 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   500 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   502 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   504 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   506 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   508 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   510 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   512 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   514 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   516 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   518 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   520 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   522 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   524 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   526 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   528 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   530 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   532 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   534 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   536 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   538 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   540 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   542 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   544 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   546 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   548 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   550 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   552 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   554 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   556 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   558 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   560 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   562 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   564 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   566 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   568 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   570 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   572 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   574 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   576 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   578 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   580 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   582 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   584 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   586 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   588 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   590 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   592 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   594 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   596 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   598 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   600 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   602 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   604 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   606 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   608 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   610 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   612 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   614 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   616 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   618 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   620 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   622 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   624 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   626 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   628 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   630 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   632 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   634 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   636 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   638 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   640 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   642 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   644 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   646 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   648 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   650 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   652 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   654 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   656 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   658 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   660 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   662 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   664 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   666 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   668 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   670 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   672 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   674 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   676 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   678 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   680 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   682 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   684 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   686 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   688 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   690 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   692 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   694 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   696 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   698 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   700 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   702 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   704 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   706 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   708 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   710 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   712 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   714 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   716 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   718 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   720 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   722 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   724 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   726 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   728 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   730 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   732 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   734 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   736 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   738 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   740 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   742 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   744 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   746 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   748 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   750 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   752 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   754 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   756 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   758 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   760 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   762 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   764 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   766 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   768 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   770 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   772 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   774 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   776 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   778 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   780 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   782 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   784 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   786 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   788 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   790 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   792 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   794 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   796 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   798 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   800 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   802 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   804 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   806 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   808 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   810 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   812 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   814 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   816 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   818 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   820 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   822 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   824 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   826 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   828 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   830 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   832 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   834 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   836 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   838 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   840 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   842 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   844 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   846 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   848 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   850 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   852 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   854 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   856 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   858 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   860 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   862 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   864 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   866 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   868 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   870 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   872 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   874 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   876 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   878 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   880 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   882 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   884 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   886 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   888 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   890 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   892 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   894 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   896 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   898 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   900 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   902 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   904 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   906 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   908 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   910 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   912 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   914 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   916 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   918 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   920 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   922 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   924 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   926 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   928 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   930 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   932 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   934 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   936 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   938 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   940 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   942 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   944 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   946 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   948 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   950 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   952 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   954 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   956 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   958 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   960 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   962 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   964 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   966 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   968 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   970 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   972 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   974 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   976 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   978 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   980 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   982 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   984 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   986 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   988 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   990 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   992 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   994 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   996 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[   998 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1000 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1002 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1004 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1006 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1008 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1010 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1012 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1014 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1016 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1018 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1020 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1022 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1024 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1026 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1028 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1030 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1032 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1034 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1036 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1038 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1040 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1042 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1044 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1046 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1048 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1050 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1052 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1054 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1056 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1058 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1060 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1062 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1064 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1066 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1068 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1070 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1072 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1074 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1076 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1078 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1080 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1082 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1084 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1086 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1088 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1090 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1092 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1094 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1096 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1098 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1100 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1102 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1104 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1106 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1108 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1110 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1112 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1114 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1116 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1118 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1120 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1122 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1124 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1126 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1128 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1130 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1132 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1134 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1136 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1138 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1140 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1142 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1144 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1146 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1148 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1150 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1152 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1154 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1156 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1158 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1160 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1162 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1164 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1166 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1168 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1170 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1172 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1174 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1176 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1178 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1180 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1182 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1184 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1186 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1188 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1190 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1192 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1194 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1196 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1198 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1200 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1202 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1204 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1206 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1208 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1210 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1212 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1214 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1216 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1218 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1220 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1222 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1224 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1226 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1228 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1230 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1232 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1234 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1236 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1238 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1240 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1242 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1244 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1246 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1248 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1250 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1252 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1254 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1256 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1258 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1260 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1262 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1264 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1266 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1268 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1270 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1272 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1274 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1276 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1278 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1280 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1282 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1284 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1286 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1288 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1290 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1292 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1294 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1296 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1298 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1300 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1302 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1304 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1306 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1308 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1310 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1312 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1314 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1316 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1318 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1320 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1322 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1324 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1326 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1328 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1330 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1332 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1334 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1336 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1338 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1340 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1342 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1344 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1346 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1348 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1350 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1352 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1354 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1356 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1358 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1360 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1362 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1364 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1366 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1368 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1370 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1372 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1374 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1376 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1378 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1380 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1382 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1384 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1386 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1388 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1390 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1392 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1394 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1396 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1398 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1400 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1402 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1404 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1406 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1408 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1410 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1412 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1414 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1416 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1418 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1420 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1422 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1424 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1426 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1428 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1430 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1432 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1434 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1436 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1438 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1440 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1442 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1444 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1446 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1448 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1450 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1452 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1454 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1456 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1458 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1460 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1462 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1464 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1466 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1468 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1470 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1472 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1474 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1476 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1478 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1480 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1482 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1484 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1486 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1488 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1490 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1492 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1494 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1496 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1498 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1500 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1502 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1504 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1506 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1508 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1510 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1512 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1514 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1516 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1518 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1520 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1522 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1524 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1526 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1528 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1530 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1532 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1534 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1536 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1538 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1540 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1542 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1544 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1546 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1548 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1550 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1552 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1554 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1556 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1558 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1560 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1562 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1564 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1566 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1568 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1570 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1572 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1574 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1576 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1578 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1580 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1582 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1584 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1586 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1588 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1590 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1592 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1594 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1596 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1598 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1600 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1602 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1604 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1606 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1608 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1610 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1612 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1614 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1616 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1618 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1620 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1622 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1624 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1626 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1628 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1630 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1632 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1634 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1636 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1638 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1640 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1642 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1644 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1646 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1648 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1650 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1652 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1654 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1656 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1658 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1660 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1662 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1664 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1666 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1668 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1670 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1672 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1674 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1676 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1678 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1680 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1682 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1684 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1686 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1688 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1690 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1692 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1694 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1696 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1698 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1700 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1702 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1704 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1706 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1708 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1710 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1712 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1714 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1716 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1718 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1720 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1722 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1724 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1726 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1728 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1730 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1732 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1734 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1736 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1738 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1740 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1742 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1744 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1746 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1748 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1750 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1752 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1754 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1756 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1758 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1760 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1762 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1764 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1766 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1768 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1770 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1772 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1774 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1776 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1778 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1780 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1782 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1784 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1786 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1788 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1790 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1792 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1794 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1796 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1798 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1800 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1802 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1804 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1806 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1808 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1810 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1812 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1814 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1816 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1818 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1820 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1822 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1824 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1826 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1828 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1830 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1832 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1834 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1836 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1838 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1840 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1842 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1844 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1846 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1848 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1850 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1852 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1854 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1856 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1858 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1860 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1862 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1864 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1866 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1868 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1870 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1872 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1874 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1876 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1878 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1880 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1882 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1884 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1886 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1888 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1890 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1892 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1894 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1896 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1898 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1900 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1902 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1904 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1906 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1908 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1910 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1912 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1914 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1916 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1918 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1920 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1922 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1924 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1926 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1928 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1930 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1932 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1934 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1936 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1938 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1940 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1942 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1944 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1946 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1948 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1950 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1952 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1954 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1956 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1958 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1960 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1962 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1964 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1966 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1968 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1970 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1972 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1974 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1976 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1978 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1980 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1982 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1984 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1986 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1988 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1990 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1992 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1994 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1996 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  1998 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2000 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2002 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2004 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2006 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2008 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2010 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2012 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2014 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2016 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2018 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2020 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2022 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2024 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2026 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2028 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2030 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2032 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2034 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2036 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2038 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2040 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2042 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2044 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2046 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2048 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2050 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2052 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2054 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2056 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2058 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2060 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2062 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2064 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2066 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2068 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2070 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2072 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2074 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2076 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2078 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2080 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2082 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2084 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2086 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2088 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2090 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2092 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2094 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2096 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2098 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2100 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2102 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2104 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2106 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2108 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2110 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2112 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2114 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2116 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2118 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2120 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2122 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2124 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2126 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2128 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2130 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2132 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2134 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2136 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2138 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2140 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2142 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2144 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2146 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2148 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2150 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2152 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2154 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2156 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2158 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2160 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2162 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2164 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2166 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2168 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2170 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2172 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2174 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2176 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2178 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2180 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2182 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2184 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2186 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2188 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2190 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2192 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2194 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2196 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2198 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2200 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2202 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2204 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2206 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2208 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2210 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2212 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2214 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2216 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2218 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2220 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2222 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2224 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2226 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2228 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2230 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2232 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2234 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2236 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2238 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2240 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2242 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2244 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2246 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2248 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2250 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2252 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2254 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2256 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2258 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2260 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2262 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2264 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2266 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2268 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2270 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2272 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2274 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2276 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2278 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2280 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2282 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2284 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2286 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2288 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2290 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2292 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2294 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2296 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2298 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2300 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2302 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2304 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2306 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2308 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2310 ] = {   7, "\x16\x00\x00\x00\xff\xff\x02" },
-	[  2314 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  2316 ] = {   4, "\x0e\x00\x00\x00" },
-	[  2319 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  2321 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  2323 ] = {   4, "\x03\x00\x00\x00" },
-	[  2327 ] = {  34, "\x06\x00\x00\x00\x00\x00\x08\x00\x0a\x0a\x12\x12\xe6\xeb\xe6\xe5\xf0\xec\xf0\xf2\x03\x00\x31\x00\x20\x00\x12\x00\x14\x00\xff\xff\x85\x00" },
-	[  2329 ] = {   6, "\x04\x00\x00\x00\x0a\x00" },
-	[  2331 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x48\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[  2333 ] = {   4, "\x0e\x00\x00\x00" },
-	[  2336 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  2338 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  2340 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[  2342 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  2344 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  2346 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  2348 ] = {   4, "\x03\x00\x00\x00" },
-	[  2352 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  2354 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[  2356 ] = {   4, "\x0e\x00\x00\x00" },
-	[  2359 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[  2361 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[  2363 ] = {   4, "\x03\x00\x00\x00" },
-	[  2365 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  2367 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  2369 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  2371 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  2373 ] = {   7, "\x16\x00\x00\x00\xff\xff\x00" },
-	[  2375 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2377 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2379 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2381 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2383 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2385 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2387 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2389 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2391 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2393 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2395 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2397 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2399 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2401 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2403 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2405 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2407 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2409 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2411 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2413 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2415 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2417 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2419 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2421 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2423 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2425 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2427 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2429 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2431 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2433 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2435 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2437 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2439 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2441 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2443 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2445 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2447 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2449 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2451 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2453 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2455 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2457 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2459 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2461 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2463 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2465 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2467 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2469 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2471 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2473 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2475 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2477 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2479 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2481 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2483 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2485 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2487 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2489 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2491 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2493 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2495 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2497 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2499 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2501 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2503 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2505 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2507 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2509 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2511 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2513 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2515 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2517 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2519 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2521 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2523 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2525 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2527 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2529 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2531 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2533 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2535 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2537 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2539 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2541 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2543 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2545 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2547 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2549 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2551 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2553 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2555 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2557 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2559 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2561 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2563 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2565 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2567 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2569 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x48\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[  2571 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2573 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2575 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2577 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2579 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2581 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2583 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2585 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2587 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2589 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2591 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2593 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2595 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2597 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2599 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2601 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2603 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2605 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2607 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2609 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2611 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2613 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2615 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2617 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2619 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2621 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2623 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2625 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2627 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2629 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2631 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2633 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2635 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2637 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2639 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2641 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2643 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2645 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2647 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2649 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2651 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2653 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2655 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2657 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2659 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2661 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2663 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2665 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2667 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2669 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2671 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2673 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2675 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2677 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2679 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2681 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2683 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2685 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2687 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2689 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2691 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2693 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2695 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2697 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2699 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2701 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2703 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2705 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2707 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2709 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2711 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2713 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2715 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2717 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2719 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2721 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2723 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2725 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2727 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2729 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2731 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2733 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2735 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2737 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2739 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2741 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2743 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2745 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2747 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2749 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2751 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2753 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2755 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2757 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2759 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2761 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2763 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2765 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2767 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2769 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2771 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2773 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2775 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2777 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2779 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2781 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2783 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2785 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2787 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2789 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2791 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2793 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2795 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2797 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2799 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2801 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2803 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2805 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2807 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2809 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2811 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2813 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2815 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2817 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2819 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2821 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2823 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2825 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2827 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2829 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2831 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2833 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2835 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2837 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2839 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2841 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2843 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2845 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2847 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2849 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2851 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2853 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2855 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2857 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2859 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2861 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2863 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2865 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2867 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2869 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2871 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2873 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2875 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2877 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2879 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2881 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2883 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2885 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2887 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2889 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2891 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2893 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2895 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2897 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2899 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2901 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2903 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2905 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2907 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2909 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2911 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2913 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2915 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2917 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2919 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2921 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2923 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2925 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2927 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2929 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2931 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2933 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2935 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2937 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2939 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2941 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2943 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2945 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2947 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2949 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2951 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2953 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2955 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2957 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2959 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2961 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2963 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2965 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2967 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2969 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2971 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2973 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2975 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2977 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2979 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2981 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2983 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2985 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2987 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2989 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2991 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2993 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2995 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2997 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  2999 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3001 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3003 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3005 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3007 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3009 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3011 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3013 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3015 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3017 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3019 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3021 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3023 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3025 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3027 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3029 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3031 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3033 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3035 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3037 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3039 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3041 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3043 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3045 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3047 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3049 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3051 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3053 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3055 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3057 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3059 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3061 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3063 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3065 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3067 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3069 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3071 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3073 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3075 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3077 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3079 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3081 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3083 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3085 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3087 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3089 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3091 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3093 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3095 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3097 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3099 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3101 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3103 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3105 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3107 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3109 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3111 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3113 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3115 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3117 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3119 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3121 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3123 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3125 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3127 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3129 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3131 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3133 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3135 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3137 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3139 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3141 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3143 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3145 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3147 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3149 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3151 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3153 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3155 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3157 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3159 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3161 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3163 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3165 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3167 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3169 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3171 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3173 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3175 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3177 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3179 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3181 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3183 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3185 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3187 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3189 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3191 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3193 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3195 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3197 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3199 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3201 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3203 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3205 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3207 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3209 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3211 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3213 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3215 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3217 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3219 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3221 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3223 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3225 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3227 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3229 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3231 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3233 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3235 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3237 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3239 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3241 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3243 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3245 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3247 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3249 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3251 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3253 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3255 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3257 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3259 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3261 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3263 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3265 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3267 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3269 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3271 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3273 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3275 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3277 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3279 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3281 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3283 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3285 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3287 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3289 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3291 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3293 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3295 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3297 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3299 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3301 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3303 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3305 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3307 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3309 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3311 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3313 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3315 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3317 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3319 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3321 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3323 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3325 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3327 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3329 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3331 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3333 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3335 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3337 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3339 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3341 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3343 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3345 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3347 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3349 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3351 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3353 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3355 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3357 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3359 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3361 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3363 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3365 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3367 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3369 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3371 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3373 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3375 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3377 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3379 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3381 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3383 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3385 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3387 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3389 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3391 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3393 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3395 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3397 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3399 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3401 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3403 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3405 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3407 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3409 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3411 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3413 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3415 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3417 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3419 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3421 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3423 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3425 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3427 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3429 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3431 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3433 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3435 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3437 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3439 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3441 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3443 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3445 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3447 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3449 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3451 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3453 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3455 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3457 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3459 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3461 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3463 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3465 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3467 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3469 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3471 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3473 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3475 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3477 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3479 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3481 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3483 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3485 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3487 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3489 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3491 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3493 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3495 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3497 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3499 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3501 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3503 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3505 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3507 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3509 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3511 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3513 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3515 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3517 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3519 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3521 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3523 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3525 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3527 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3529 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3531 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3533 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3535 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3537 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3539 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3541 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3543 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3545 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3547 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3549 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3551 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3553 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3555 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3557 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3559 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3561 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3563 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3565 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3567 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3569 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3571 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3573 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3575 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3577 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3579 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3581 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3583 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3585 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3587 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3589 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3591 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3593 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3595 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3597 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3599 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3601 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3603 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3605 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3607 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3609 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3611 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3613 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3615 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3617 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3619 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3621 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3623 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3625 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3627 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3629 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3631 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3633 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3635 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3637 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3639 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3641 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3643 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3645 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3647 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3649 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3651 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3653 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3655 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3657 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3659 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3661 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3663 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3665 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3667 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3669 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3671 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3673 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3675 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3677 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3679 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3681 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3683 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3685 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3687 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3689 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3691 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3693 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3695 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3697 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3699 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3701 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3703 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3705 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3707 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3709 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3711 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3713 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3715 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3717 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3719 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3721 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3723 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3725 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3727 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3729 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3731 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3733 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3735 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3737 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3739 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3741 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3743 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3745 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3747 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3749 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3751 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3753 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3755 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3757 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3759 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3761 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3763 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3765 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3767 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3769 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3771 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3773 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3775 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3777 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3779 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3781 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3783 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3785 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3787 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3789 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3791 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3793 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3795 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3797 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3799 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3801 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3803 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3805 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3807 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3809 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3811 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3813 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3815 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3817 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3819 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3821 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3823 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3825 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3827 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3829 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3831 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3833 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3835 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3837 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3839 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3841 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3843 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3845 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3847 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3849 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3851 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3853 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3855 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3857 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3859 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3861 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3863 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3865 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3867 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3869 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3871 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3873 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3875 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3877 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3879 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3881 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3883 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3885 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3887 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3889 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3891 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3893 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3895 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3897 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3899 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3901 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3903 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3905 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3907 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3909 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3911 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3913 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3915 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3917 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3919 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3921 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3923 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3925 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3927 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3929 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3931 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3933 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3935 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3937 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3939 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3941 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3943 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3945 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3947 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3949 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3951 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3953 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3955 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3957 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3959 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3961 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3963 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3965 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3967 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3969 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3971 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3973 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3975 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3977 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3979 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3981 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3983 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3985 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3987 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3989 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3991 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3993 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3995 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3997 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  3999 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4001 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4003 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4005 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4007 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4009 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4011 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4013 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4015 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4017 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4019 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4021 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4023 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4025 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4027 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4029 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4031 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4033 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4035 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4037 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4039 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4041 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4043 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4045 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4047 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4049 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4051 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4053 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4055 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4057 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4059 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4061 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4063 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4065 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4067 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4069 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4071 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4073 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4075 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4077 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4079 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4081 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4083 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4085 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4087 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4089 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4091 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4093 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4095 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4097 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4099 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4101 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4103 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4105 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4107 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4109 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4111 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4113 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4115 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4117 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4119 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4121 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4123 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4125 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4127 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4129 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4131 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4133 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	[  4135 ] = {   7, "\x16\x00\x00\x00\xff\xff\x01" },
-	}
-};
@@ -18,26 +18,191 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
  */
 #include <errno.h>
+#include <poll.h>
+#include <pthread.h>
 #include <signal.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
+#include <sys/stat.h>
 #include <libusb-1.0/libusb.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include "vfs101.h"
 
 
 /* The device seems to send back 16 frames of 292 bytes at a time */
-const unsigned int FRAME_SIZE = 292;
-const unsigned int N_FRAMES = 16;
+static const unsigned int FRAME_SIZE = 292;
+static const unsigned int N_FRAMES = 16;
+
+/* How many bulk-IN transfers to keep queued on the image endpoint */
+static const int N_XFERS = 4;
+#define MAX_XFERS 32
+
+/* How many scan lines the streaming ring holds; a multiple of N_FRAMES so
+ * that a transfer never wraps around the end of the ring */
+#define RING_LINES 512
+#define MAX_SINKS 8
+
+/* How many commands may be outstanding at once while pipelining */
+static const int N_PIPE = 4;
+#define MAX_PIPE 16
 
 #define nitems(x) (sizeof(x)/sizeof(x[0]))
 
+#include "dump.h"
+#include "trace.h"
+#ifndef VFS101_LIBRARY
+#include "script.h"
+#endif
+
 
 /******************************************************************************************************
  * Context structure for this driver.
  */
 struct result_table;
+struct image_writer;
+struct vfs_dev;
+static void res_check (struct vfs_dev *dev, int n);
+static void writer_flush (struct vfs_dev *dev);
+
+/* round trip statistics for one command type */
+struct rtt_stat {
+	int n;
+	long long sum;
+	long long min;
+	long long max;
+};
+
+/* A consumer of scan lines. Each sink reads the ring behind its own cursor */
+struct line_sink;
+
+typedef void (*sink_func)   (struct vfs_dev *, struct line_sink *);
+typedef void (*sink_func_1) (struct vfs_dev *, struct line_sink *, unsigned char *, int);
+typedef void (*sink_func_2) (struct vfs_dev *, struct line_sink *, unsigned long);
+
+struct line_sink {
+
+	/* called at the start of a scan, for each line as it arrives (with a
+	 * short length for a trailing partial line), and at the end of a scan */
+	sink_func   begin;
+	sink_func_1 line;
+	sink_func   end;
+
+	/* instead of line, told how many complete lines the ring holds, for a
+	 * sink that reads them itself and moves tail on as it goes */
+	sink_func_2 avail;
+
+	/* number of lines consumed so far */
+	unsigned long tail;
+};
+
+/* Line sink feeding the hex dump */
+struct dump_sink {
+
+	/* line sink feeding the dump, must come first */
+	struct line_sink sink;
+
+	/* the part of the scan not printed yet */
+	struct frame_dump dump;
+};
+
+/* Streaming ring of scan lines. load() writes into it while the sinks read
+ * out of it, so memory stays bounded no matter how long the swipe is.
+ */
+struct line_ring {
+
+	/* RING_LINES lines of FRAME_SIZE bytes */
+	unsigned char data[RING_LINES * 292];
+
+	/* number of bytes written by the producer since the start of the scan */
+	unsigned long head;
+
+	/* consumers, fed in order */
+	struct line_sink *sink[MAX_SINKS];
+	int nsinks;
+};
+
+/* A command in flight, with the transfers carrying it and its reply */
+struct vfs_cmd {
+	/* sequence number stamped into the command */
+	unsigned short seq;
+
+	/* URB number to check the reply against, or -1 */
+	int cmd_no;
+
+	unsigned char out[0x40];
+	unsigned char in[0x40];
+	int out_len;
+	int in_len;
+
+	/* reply already matched up by resync(), and sim: reply held back */
+	int ready;
+	int late;
+
+	/* resync_step(): waiting on a reply without having sent anything,
+	 * replies read that way, resends, and stale replies dropped */
+	int listening;
+	int drained;
+	int resent;
+	int stale;
+
+	struct libusb_transfer *xout;
+	struct libusb_transfer *xin;
+	int out_done;
+	int in_done;
+
+	/* when the command was sent */
+	long long t_send;
+};
+
+/* A way of talking to the reader. Each backend moves bytes only; sequence
+ * numbers, pipelining, result checking and the scan sinks live above it.
+ */
+struct vfs_transport {
+	const char *name;
+
+	/* bring the reader up to state 4, or return the error that stopped
+	 * it, and take it all the way back down */
+	int  (*open)  (struct vfs_dev *);
+	void (*close) (struct vfs_dev *);
+
+	/* queue a command, and wait for its reply to land in c->in */
+	int  (*send)  (struct vfs_dev *, struct vfs_cmd *c, int len);
+	int  (*recv)  (struct vfs_dev *, struct vfs_cmd *c);
+
+	/* read whatever reply comes next, if any, into a 0x40 byte buf */
+	int  (*drain) (struct vfs_dev *, unsigned char *buf, int *len);
+
+	/* as drain, but into c->in without waiting: the reply lands like
+	 * the reply to a command, for ready() and recv() to pick up */
+	int  (*listen) (struct vfs_dev *, struct vfs_cmd *c);
+
+	/* has the reply to c landed, so that recv() will not block? */
+	int  (*ready) (struct vfs_dev *, struct vfs_cmd *c);
+
+	/* Stream one scan into the ring: start it with ring_begin(), then poll
+	 * until it is over and ring_end() has run, when poll returns 1 or an
+	 * error. Until then poll returns 0, and wants events serviced. */
+	int  (*load_start) (struct vfs_dev *);
+	int  (*load_poll)  (struct vfs_dev *);
+
+	/* handle whatever completions are ready, waiting no longer than tv */
+	int  (*events) (struct vfs_dev *, struct timeval *tv);
+};
+
+static const struct vfs_transport usb_transport;
+struct vfs_sim;
+struct load_ctx;
+struct scan_job;
 
 struct vfs_dev {
+	/* backend carrying the traffic, and the simulated reader if any */
+	const struct vfs_transport *tr;
+	struct vfs_sim *sim;
+
 	/* context object for libusb library */
 	struct libusb_context *ctx;
 
@@ -47,42 +212,214 @@ struct vfs_dev {
 	/* init state of the usb subsystem */
 	int state;
 
-	/* sequence number for current send/recv transaction pair */
+	/* libusb context belongs to the device manager, not to us */
+	int shared_ctx;
+
+	/* reader number when run by the device manager, else -1 */
+	int unit;
+
+	/* sequence number for the next command to be sent */
 	unsigned short seq;
 
 	/* The last response from the device, valid immediately after a recv() */
 	unsigned char buf[0x40];
 	int len;
 
-	/* buffer to hold raw image data frames */
-	unsigned char ibuf[1024*1024];
-	int ilen;
+	/* commands in flight; slots are used round robin, and the sent and
+	 * retired counters only ever increase */
+	struct vfs_cmd cmd[MAX_PIPE];
+	unsigned int sent;
+	unsigned int retired;
+
+	/* commands allowed in flight while pipelining, and nesting of pipe_begin() */
+	int depth;
+	int pipelined;
+
+	/* URB number to check the next command's reply against, or -1 */
+	int cmd_no;
+
+	/* stale replies dropped and commands sent again by resync() */
+	int stale;
+	int retried;
+
+	/* round trips per command id, and scan throughput */
+	struct rtt_stat rtt[0x17];
+	struct rtt_stat scan;
+	unsigned long scan_lines;
+
+	/* streaming ring of raw image data frames, and number of scans saved */
+	struct line_ring ring;
 	int inum;
 
+	/* per-device copies of the line sinks, whether the PNM files are
+	 * ASCII P2 instead of binary P5, and the thread writing them */
+	struct line_sink swipe;
+	struct dump_sink dump;
+	int pnm_ascii;
+	struct image_writer *writer;
+
+	/* reader tuning: width of the secondary image, frequency of info
+	 * lines, best contrast value tried so far, image line exposure level */
+	int mess_with_bc;
+	int info_line_rate;
+	int best_contrast;
+	int exposure;
+
+	/* finger detection state machine, as reported by the last image line */
+	int s_state;
+	int s_next;
+	int s_count;
+	int swipe_end;
+
+	/* number of image transfers in flight during LoadImage(), and the
+	 * state of the load in progress */
+	int nxfers;
+	struct load_ctx *load;
+
+	/* non-blocking scan started by vfs_scan_start(), if any; while it
+	 * runs, commands are only sent and the scan collects their replies */
+	struct scan_job *job;
+	int async;
+
+	/* extra sink fed by every scan, for the non-blocking scan's image */
+	struct line_sink *collect;
+
 	/* current UsbSnoop results to check against */
 	struct result_table *results;
 
+	/* where the protocol log goes, if anywhere: every command and reply,
+	 * the scans and the timings. proto prints it on stdout; a library
+	 * host only gets it by asking, see vfs_dev_set_log() */
+	FILE *log;
+
 	/* should we mask personal information? */
 	int anonymous;
+
+	/* may we skip init when the reader is already configured? */
+	int warm;
+
+	/* sim: hold back every Nth reply until after its command times out */
+	int faults;
+
+	/* binary trace file name, the trace being recorded if any, and when
+	 * it was opened */
+	const char *trace_file;
+	FILE *trace;
+	long long trace_t0;
+
+	/* command script for the play cycle */
+	const char *script_file;
+
+	/* log file name from log=, else the log goes to stdout */
+	const char *log_file;
+
+	/* set by the device manager when the reader has left the bus */
+	volatile int stop;
 };
 
 
 static void dev_init (struct vfs_dev *dev)
 {
+	dev->tr = &usb_transport;
+	dev->sim = NULL;
 	dev->ctx = NULL;
 	dev->devh = NULL;
 	dev->state = 0;
+	dev->shared_ctx = 0;
+	dev->unit = -1;
 	dev->seq = 0;
 	dev->len = 0;
-	dev->ilen = 0;
+	memset(dev->cmd, 0, sizeof(dev->cmd));
+	dev->sent = 0;
+	dev->retired = 0;
+	dev->depth = N_PIPE;
+	dev->pipelined = 0;
+	dev->cmd_no = -1;
+	memset(dev->rtt, 0, sizeof(dev->rtt));
+	memset(&dev->scan, 0, sizeof(dev->scan));
+	dev->scan_lines = 0;
+	dev->stale = 0;
+	dev->retried = 0;
+	dev->ring.head = 0;
+	dev->ring.nsinks = 0;
 	dev->inum = 0;
+	memset(&dev->dump, 0, sizeof(dev->dump));
+	dev->writer = NULL;
+	dev->mess_with_bc = 0x010c;
+	dev->info_line_rate = 0x32;
+	dev->best_contrast = 0x00;
+	dev->exposure = 0x21bc;
+	dev->s_state = 0;
+	dev->s_next = 0;
+	dev->s_count = 0;
+	dev->swipe_end = 0;
+	dev->nxfers = N_XFERS;
+	dev->load = NULL;
+	dev->job = NULL;
+	dev->async = 0;
+	dev->collect = NULL;
 	dev->results = NULL;
+	dev->log = stdout;
 	dev->anonymous = 1;
+	dev->warm = 0;
+	dev->pnm_ascii = 0;
+	dev->faults = 0;
+	dev->trace_file = NULL;
+	dev->trace = NULL;
+	dev->trace_t0 = 0;
+	dev->script_file = NULL;
+	dev->log_file = NULL;
+	dev->stop = 0;
+}
+
+/* print the round trip statistics gathered by recv() */
+static void rtt_report (struct vfs_dev *dev)
+{
+	int i;
+
+	if (dev->log == NULL)
+		return;
+	for (i = 0; i < nitems(dev->rtt); i++) {
+		struct rtt_stat *st = &dev->rtt[i];
+		if (st->n == 0)
+			continue;
+		fprintf(dev->log, "  %-16s %5d cmds  min %6lld us  avg %6lld us  max %6lld us\n",
+			cmd_names[i] ? cmd_names[i] : "???", st->n, st->min, st->sum / st->n, st->max);
+	}
+
+	if ((dev->scan.n > 0) && (dev->scan.sum > 0))
+		fprintf(dev->log, "  %-16s %5d scans %8lu lines in %lld us, %lld lines/s\n",
+			"LoadImage", dev->scan.n, dev->scan_lines, dev->scan.sum, dev->scan_lines * 1000000LL / dev->scan.sum);
+
+	if (dev->stale || dev->retried)
+		fprintf(dev->log, "  resync: %d stale replies dropped, %d commands retried\n", dev->stale, dev->retried);
 }
 
+static int pipe_flush (struct vfs_dev *dev);
+static void scan_close (struct vfs_dev *dev);
+
 static void dev_close (struct vfs_dev *dev)
 {
-	int r;
+	if (dev->state == 4) {
+		scan_close(dev);
+		pipe_flush(dev);
+	}
+
+	rtt_report(dev);
+	memset(dev->rtt, 0, sizeof(dev->rtt));
+	memset(&dev->scan, 0, sizeof(dev->scan));
+	dev->scan_lines = 0;
+	dev->stale = dev->retried = 0;
+
+	dev->tr->close(dev);
+	dev->sent = dev->retired = 0;
+
+	writer_flush(dev);
+}
+
+static void usb_close (struct vfs_dev *dev)
+{
+	int i, r;
 
 	if (dev->state == 4) {
 		r = libusb_reset_device(dev->devh); 
@@ -99,79 +436,190 @@ static void dev_close (struct vfs_dev *dev)
 	}
 
 	if (dev->state == 2) {
+		for (i = 0; i < MAX_PIPE; i++) {
+			libusb_free_transfer(dev->cmd[i].xout);
+			libusb_free_transfer(dev->cmd[i].xin);
+			dev->cmd[i].xout = NULL;
+			dev->cmd[i].xin = NULL;
+		}
 		libusb_close(dev->devh);
 		dev->devh = NULL;
 		dev->state = 1;
 	}
 
 	if (dev->state == 1) {
-		libusb_exit(dev->ctx);
+		if (!dev->shared_ctx)
+			libusb_exit(dev->ctx);
 		dev->ctx = NULL;
+		dev->shared_ctx = 0;
 		dev->state = 0;
 	}
 }
 
-static void dev_open (struct vfs_dev *dev)
+/* Detach kernel drivers from the interfaces the active configuration
+ * actually has, rather than probing every possible interface number.
+ */
+static int dev_detach (struct vfs_dev *dev)
 {
-	int r;
+	struct libusb_config_descriptor *config;
+	int i, r;
 
-	if (dev->state != 0)
-		dev_close(dev);
+	r = libusb_get_active_config_descriptor(libusb_get_device(dev->devh), &config);
+	if (r != 0)
+		return r;
 
-	if (dev->state != 0) {
-		fprintf(stderr, "Failed to close device before reopening!\n");
-		return;
+	for (i = 0; i < config->bNumInterfaces; i++) {
+		int n;
+		if (config->interface[i].num_altsetting < 1)
+			continue;
+		n = config->interface[i].altsetting[0].bInterfaceNumber;
+		if (libusb_kernel_driver_active(dev->devh, n) == 1) {
+			r = libusb_detach_kernel_driver(dev->devh, n);
+			if (r < 0)
+				fprintf(stderr, "Error detaching kernel driver from interface %d!\n", n);
+		}
 	}
 
-	r = libusb_init(&dev->ctx);
-	if (r != 0) {
-		fprintf(stderr, "Failed to initialise libusb\n");
-		return;
-	}
-	dev->state = 1;
+	libusb_free_config_descriptor(config);
+	return 0;
+}
 
-	dev->devh = libusb_open_device_with_vid_pid(NULL, 0x138a, 0x0001);
-	if (dev->devh == NULL) {
-		fprintf(stderr, "Can't open validity device!\n");
-		return;
-	}
-	dev->state = 2;
+static long long now_us (void);
 
-	int i = 0;
-	for (i; i < 1000000; i++){
-		r = libusb_kernel_driver_active(dev->devh, i);
-		if ( r == 1 ){
-			r = libusb_detach_kernel_driver(dev->devh, 4);
-			if (r < 0)
-				fprintf(stderr, "Error detaching kernel driver!\n");
-		}
-	}
+/* Take over an open device handle: claim, reset and configure it, and
+ * report how long startup took. t[0..1] are filled in by the caller.
+ */
+static int dev_open_1 (struct vfs_dev *dev, long long t[7])
+{
+	int r;
 
+	t[2] = now_us();
+	r = dev_detach(dev);
+	if (r != 0)
+		fprintf(stderr, "Can't read active configuration %d\n", r);
+
+	t[3] = now_us();
 	r = libusb_claim_interface(dev->devh, 0);
 	if (r != 0) {
 		fprintf(stderr, "usb_claim_interface error %d\n", r);
-		return;
+		return r;
 	}
 	dev->state = 3;
 
+	t[4] = now_us();
 	r = libusb_reset_device(dev->devh);
 	if (r != 0) {
 		fprintf(stderr, "Error resetting device");
-		return;
+		return r;
 	}
 
+	t[5] = now_us();
 	r = libusb_control_transfer(dev->devh, LIBUSB_REQUEST_TYPE_STANDARD, LIBUSB_REQUEST_SET_FEATURE, 1, 1, NULL, 0, 100); 
         if (r != 0) {
 		fprintf(stderr, "device configuring error %d\n", r);
-		return;
+		return (r < 0) ? r : LIBUSB_ERROR_IO;
 	}
 	dev->state = 4;
+
+	t[6] = now_us();
+	if (dev->log)
+		fprintf(dev->log, "  startup: init %lld us, open %lld us, detach %lld us, claim %lld us, reset %lld us, set_feature %lld us, total %lld us\n",
+		t[1]-t[0], t[2]-t[1], t[3]-t[2], t[4]-t[3], t[5]-t[4], t[6]-t[5], t[6]-t[0]);
+	return 0;
+}
+
+#ifndef VFS101_LIBRARY
+/* Open a specific reader on a libusb context owned by someone else */
+static int dev_attach (struct vfs_dev *dev, struct libusb_context *ctx, struct libusb_device *udev)
+{
+	long long t[7];
+	int r;
+
+	if (dev->state != 0)
+		dev_close(dev);
+
+	t[0] = t[1] = now_us();
+	dev->ctx = ctx;
+	dev->shared_ctx = 1;
+	dev->state = 1;
+
+	r = libusb_open(udev, &dev->devh);
+	if (r != 0) {
+		fprintf(stderr, "Can't open validity device! %d\n", r);
+		return r;
+	}
+	dev->state = 2;
+
+	return dev_open_1(dev, t);
+}
+#endif
+
+/* Open the first reader on the bus. Unlike libusb_open_device_with_vid_pid(),
+ * this tells a reader we may not open apart from no reader at all. */
+static int usb_find (struct vfs_dev *dev)
+{
+	struct libusb_device **list;
+	struct libusb_device_descriptor desc;
+	ssize_t i, n;
+	int r = LIBUSB_ERROR_NO_DEVICE;
+
+	n = libusb_get_device_list(dev->ctx, &list);
+	if (n < 0)
+		return n;
+	for (i = 0; i < n; i++) {
+		if ((libusb_get_device_descriptor(list[i], &desc) == 0) && (desc.idVendor == 0x138a) && (desc.idProduct == 0x0001)) {
+			r = libusb_open(list[i], &dev->devh);
+			break;
+		}
+	}
+	libusb_free_device_list(list, 1);
+	return r;
+}
+
+static int usb_open (struct vfs_dev *dev)
+{
+	long long t[7];
+	int r;
+
+	t[0] = now_us();
+	r = libusb_init(&dev->ctx);
+	if (r != 0) {
+		fprintf(stderr, "Failed to initialise libusb\n");
+		return r;
+	}
+	dev->state = 1;
+
+	t[1] = now_us();
+	r = usb_find(dev);
+	if (r != 0) {
+		fprintf(stderr, "Can't open validity device! %d\n", r);
+		return r;
+	}
+	dev->state = 2;
+
+	return dev_open_1(dev, t);
+}
+
+/* Open the reader, returning 0 or why it could not be opened */
+static int dev_open (struct vfs_dev *dev)
+{
+	if (dev->state != 0)
+		dev_close(dev);
+
+	if (dev->state != 0) {
+		fprintf(stderr, "Failed to close device before reopening!\n");
+		return LIBUSB_ERROR_BUSY;
+	}
+
+	return dev->tr->open(dev);
 }
 
+#ifndef VFS101_LIBRARY
 static int dev_okay (struct vfs_dev *dev)
 {
 	return dev->state == 4;
 }
+#endif
  
 
 /******************************************************************************************************
@@ -204,888 +652,3860 @@ static inline unsigned short xx (int h, int l)
 
 
 /******************************************************************************************************
- * Debug printing routines
+ * Streaming scan line ring
  */
 
-static int dump_buffer (unsigned char *data, int length, unsigned char *prefix)
+/* address of scan line n */
+static unsigned char *ring_line (struct line_ring *ring, unsigned long n)
 {
-	int i = 0;
-	fprintf(stdout, "%s ", prefix);
-	for (i; i < length; i++)
-		fprintf(stdout, "%02X ", data[i]);
-	fprintf(stdout, "\n");
-	return length;
+	return ring->data + (n % RING_LINES) * FRAME_SIZE;
 }
 
-static int dump_frame_1 (unsigned char *d, int n)
+/* drop all sinks, ready for a new scan */
+static void ring_reset (struct line_ring *ring)
 {
-	int i;
-
-	fprintf(stdout, "\n  ---------------------------- Packet %05d -----------------------------\n", n);
-	fprintf(stdout, "  {\n");
-	d += dump_buffer(d,  2, "  Line type       ");
-	d += dump_buffer(d,  2, "  Sequence        ");
-	d += dump_buffer(d,  2, "  ???             ");
-	fprintf(stdout, "\n");
-
-	d += dump_buffer(d, 16, "  Fingerprint A   ");
-	for (i=1; i<12; i++)
-		d += dump_buffer(d, 16, "                  ");
-	d += dump_buffer(d,  8, "                  ");
-	fprintf(stdout, "\n");
-
-	d += dump_buffer(d,  2, "  ???             ");
-	fprintf(stdout, "\n");
-
-	d += dump_buffer(d, 16, "  IMG B           ");
-	d += dump_buffer(d, 16, "                  ");
-	d += dump_buffer(d,  6, "                  ");
-	d += dump_buffer(d, 16, "  IMG C           ");
-	d += dump_buffer(d, 10, "                  ");
-	fprintf(stdout, "\n");
-
-	d += dump_buffer(d,  4, "  Constant        ");
-	d += dump_buffer(d,  2, "  Sequence'       ");
-	fprintf(stdout, "\n");
+	ring->head = 0;
+	ring->nsinks = 0;
+}
 
-	d += dump_buffer(d,  1, "  S_curr_state    ");
-	d += dump_buffer(d,  1, "  S_next_state    ");
-	d += dump_buffer(d,  2, "  S_count         ");
-	d += dump_buffer(d,  2, "  S_level         ");
-	d += dump_buffer(d,  8, "  ???             ");
-	fprintf(stdout, "  }\n");
+static void ring_add (struct line_ring *ring, struct line_sink *s)
+{
+	if (ring->nsinks < MAX_SINKS)
+		ring->sink[ring->nsinks++] = s;
+	else
+		fprintf(stderr, "too many line sinks\n");
 }
 
-static int dump_frame (unsigned char *data, int length, int n)
+/* first line number the producer may not write yet */
+static unsigned long ring_room (struct line_ring *ring)
 {
-	int skip = 0;
+	unsigned long tail = ring->head / FRAME_SIZE;
+	int i;
+	for (i = 0; i < ring->nsinks; i++)
+		if (ring->sink[i]->tail < tail)
+			tail = ring->sink[i]->tail;
+	return tail + RING_LINES;
+}
 
-	// skip bytes as required until a frame header is found
-	while ((length > 1) && ((data[0] != 0x01) || ((data[1] != 0xfe) && (data[1] != 0x01)))) {
-		length--;
-		data++;
-		skip++;
+static void ring_begin (struct vfs_dev *dev)
+{
+	struct line_ring *ring = &dev->ring;
+	int i;
+	ring->head = 0;
+	for (i = 0; i < ring->nsinks; i++) {
+		ring->sink[i]->tail = 0;
+		if (ring->sink[i]->begin)
+			ring->sink[i]->begin(dev, ring->sink[i]);
 	}
+}
 
-	// warn if we skipped any data
-	if (skip > 0)
-		fprintf(stdout, "*** Frame misalignment, skipped %d bytes!!\n", skip);
+/* feed every complete line to every sink */
+static void ring_drain (struct vfs_dev *dev)
+{
+	struct line_ring *ring = &dev->ring;
+	unsigned long n = ring->head / FRAME_SIZE;
+	int i;
+	for (i = 0; i < ring->nsinks; i++) {
+		struct line_sink *s = ring->sink[i];
+		if (s->avail) {
+			s->avail(dev, s, n);
+			continue;
+		}
+		for (; s->tail < n; s->tail++)
+			if (s->line)
+				s->line(dev, s, ring_line(ring, s->tail), FRAME_SIZE);
+	}
+}
 
-	// dump short frames as raw data
-	if (length < FRAME_SIZE) {
-		fprintf(stdout, "*** Short frame, dumping as %d raw bytes!!\n", length);
-		dump_buffer(data, length, "");
-		return skip + length;
+/* feed the remaining lines, including a partial one, then end the scan */
+static void ring_end (struct vfs_dev *dev)
+{
+	struct line_ring *ring = &dev->ring;
+	unsigned long n = ring->head / FRAME_SIZE;
+	int partial = ring->head % FRAME_SIZE;
+	int i;
+	ring_drain(dev);
+	for (i = 0; i < ring->nsinks; i++) {
+		struct line_sink *s = ring->sink[i];
+		if (partial && s->line)
+			s->line(dev, s, ring_line(ring, n), partial);
+		if (s->end)
+			s->end(dev, s);
 	}
+}
+
 
-	// do the actual printing
-	dump_frame_1(data, n);
+/******************************************************************************************************
+ * Finger detection state machine
+ *
+ * Bytes 276-279 of each image line carry the current and next state and the
+ * line count of the scanner's internal finger detection state machine. The
+ * swipe ends after the single line in state 6.
+ */
 
-	// return number of bytes consumed
-	return skip + FRAME_SIZE;
+static void swipe_begin (struct vfs_dev *dev, struct line_sink *s)
+{
+	dev->s_state = 0;
+	dev->s_next = 0;
+	dev->s_count = 0;
+	dev->swipe_end = 0;
 }
 
-static void dump_image (struct vfs_dev *dev)
+static void swipe_line (struct vfs_dev *dev, struct line_sink *s, unsigned char *data, int length)
 {
-	int f = 0;
-	unsigned char *data = dev->ibuf;
-	int length = dev->ilen;
+	if ((length < FRAME_SIZE) || (data[0] != 0x01) || (data[1] != 0xfe))
+		return;
 
-	fprintf(stdout, "  %d frames in %d bytes%s\n", length/FRAME_SIZE, length, (length%FRAME_SIZE) ? " (incomplete frames(s)?)" : "");
-	fprintf(stdout, "  {\n");
-	while (length > 0) {
-		int n = dump_frame(data, length, f++);
-		data += n;
-		length -= n;
-	}
-	fprintf(stdout, "  }\n");
+	dev->s_state = data[276];
+	dev->s_next  = data[277];
+	dev->s_count = xx(data[279], data[278]);
+
+	if (dev->s_state == 6)
+		dev->swipe_end = 1;
 }
 
+static struct line_sink swipe_state =
+{
+	.begin = swipe_begin,
+	.line  = swipe_line,
+	.end   = NULL,
+};
+
 
 /******************************************************************************************************
- * PNM formatter framework
+ * Scan line demultiplexer
+ *
+ * Every P_INFO_LINE_RATE lines the reader sends an info line (01 01) in
+ * place of an image line (01 FE). This sink sorts a scan by line type as it
+ * arrives: the Fingerprint A pixels of each kind go into a plane of their
+ * own, packed VFS_IMAGE_WIDTH bytes per row, and what every line said about
+ * itself goes into the metadata array, so later stages can work on dense
+ * rows without checking the line type again.
+ *
+ * With fill set, the image row hidden under each info line is rebuilt from
+ * the rows either side of it once the next image line is in, so the image
+ * plane comes out full height at the default info line rate.
  */
 
-struct pnm_context;
+#define LINE_IMAGE 0xfe
+#define LINE_INFO  0x01
 
-typedef void (*pnm_func)   (struct pnm_context *, int, int);
-typedef void (*pnm_func_1) (struct pnm_context *, int, int, int);
+/* bytes in the Image BC strip, from byte 206 of an image line */
+#define BC_WIDTH 64
 
-struct pnm_formatter {
+/* one scan line, in arrival order */
+struct line_meta {
+	unsigned short seq;
+	unsigned char type;	/* LINE_IMAGE or LINE_INFO */
+	unsigned char state;	/* finger detection state, image lines only */
+	unsigned char next;
+	unsigned short count;
+	unsigned short level;
+	int row;		/* row in the plane for its type */
+	int hides;		/* image row rebuilt in place of an info line, or -1 */
+};
 
-	/* how many pixels are added on each side of image */
-	int y0;   // top
-	int y1;   // bottom
-	int x0;   // left
-	int x1;   // right
+/* a growable plane of rows of width bytes */
+struct plane {
+	unsigned char *data;
+	int width;
+	int rows;
+	int max;
+};
 
-	/* printers for various areas */
-	pnm_func   header;
-	pnm_func_1 left;
-	pnm_func   body;
-	pnm_func_1 right;
-	pnm_func   footer;
+/* swipe speed along the image plane, see speed_rows() */
+struct swipe_speed {
+
+	/* image rows taken in so far */
+	int rows;
+
+	/* smoothed speed, and how far down the resampled plane the last row
+	 * taken in lies */
+	float speed;
+	float y;
+
+	/* rows read from the Image BC strip, and from the full row, logged
+	 * at the end of the scan */
+	int cheap;
+	int full;
+
+	/* the image resampled to one row per pixel of travel */
+	struct plane iso;
 };
 
-struct pnm_context {
+struct scan_planes;
+static void speed_rows (struct scan_planes *sp);
 
-	/* vfs_dev to create PNM from */
-	struct vfs_dev *dev;
+struct scan_planes {
 
-	/* file to print PNM into */
-	FILE *file;
+	/* line sink feeding the planes, must come first */
+	struct line_sink sink;
 
-	/* which PNM formatter to use */
-	struct pnm_formatter *fmt;
+	/* image lines after this many are dropped, 0 for no limit, and
+	 * whether to rebuild the rows hidden by info lines */
+	int max_image;
+	int fill;
 
-	/* how many scan lines are there */
-	int height;
+	/* image rows held for info lines, still waiting for the row below */
+	int pending;
 
-	/* first column of image stripe */
-	int offset;
+	/* whether to estimate swipe speed and resample the image as rows come in */
+	int resample;
+	struct swipe_speed speed;
 
-	/* width of image stripe */
-	int len;
+	struct plane image;
+	struct plane info;
+
+	/* the Image BC strip of each row of the image plane */
+	struct plane bc;
+
+	struct line_meta *meta;
+	int lines;
+	int max_lines;
+
+	/* LIBUSB_ERROR_NO_MEM if rows had to be dropped */
+	int err;
 };
 
-/* fill area with black */
-static void _pnm_black (struct pnm_context *c, int y, int yy, int n)
+/* make room for one more row, doubling as needed */
+static int grow (void **p, int *max, int n, int size)
 {
-	while (n--)
-		fprintf(c->file, "   0");
-}
+	void *q;
+	int m;
 
-/* fill area with vertical gradient */
-static void _pnm_gradient (struct pnm_context *c, int y, int yy, int n)
-{
-	int z = 255*((float)y/(float)yy);
-	while (n--)
-		fprintf(c->file, " %3d", z);
+	if (n < *max)
+		return 0;
+	m = *max ? 2 * *max : 512;
+	q = realloc(*p, m * size);
+	if (q == NULL)
+		return LIBUSB_ERROR_NO_MEM;
+	*p = q;
+	*max = m;
+	return 0;
 }
 
-/* fill area with 10 pixel ruler */
-static void _pnm_ruler (struct pnm_context *c, int y, int yy, int n)
+static unsigned char *plane_add (struct plane *p)
 {
-	int z = (y%10) ? 0 : 255;
-	fprintf(c->file, " 128");
-	n--;
-	while (n--)
-		fprintf(c->file, " %3d", z ? (n ? z : 128) : 128);
+	if (grow((void **)&p->data, &p->max, p->rows, p->width) < 0)
+		return NULL;
+	return p->data + p->rows++ * p->width;
 }
 
-/* fill area with raw image data */
-static void _pnm_frame (struct pnm_context *c, int y, int yy)
+/* Rebuild a row from the rows above and below it by edge based line
+ * averaging: each pixel averages the pair of neighbours, out of the five
+ * pairs through it at slopes up to two pixels, that differ the least, so
+ * the rebuilt row follows the ridges across the gap instead of blurring
+ * them. Ties go to the steeper slopes last, vertical first. */
+#define ELA_REACH 2
+
+static unsigned char ela_pixel (const unsigned char *up, const unsigned char *down, int x)
 {
-	unsigned char *data = c->dev->ibuf + y * FRAME_SIZE + c->offset;
-	int i = c->len;
-	while (i--)
-		fprintf(c->file, " % 3d", *data++);
+	static const int slope[] = { 0, -1, 1, -2, 2 };
+	int i, d, a, b, diff, best = 256, v = 0;
+
+	for (i = 0; i < 5; i++) {
+		d = slope[i];
+		if ((x + d < 0) || (x + d >= VFS_IMAGE_WIDTH) || (x - d < 0) || (x - d >= VFS_IMAGE_WIDTH))
+			continue;
+		a = up[x + d];
+		b = down[x - d];
+		diff = (a > b) ? a - b : b - a;
+		if (diff < best) {
+			best = diff;
+			v = (a + b + 1) >> 1;
+		}
+	}
+	return v;
 }
 
-/* file area with image ABCD ruler */
-static void _pnm_frameruler (struct pnm_context *c, int y, int yy)
+static void ela_row (unsigned char *row, const unsigned char *up, const unsigned char *down)
 {
-	int offset = c->offset;
-	int len = c->len;
+	int x = 0;
 
-	while (len--) {
-		switch (offset++) {
-		case 0:
-		case 206:
-		case 246:
-		case 272:
-			fprintf(c->file, ((y==yy-1) || (y==0)) ? " 128" : " 255");
-			break;
-		default:
-			fprintf(c->file, " 128");
-			break;
+#ifdef __SSE2__
+	static const int slope[] = { -1, 1, -2, 2 };
+	__m128i u, w, best, v, diff, m;
+	int i;
+
+	for (x = ELA_REACH; x + 16 + ELA_REACH <= VFS_IMAGE_WIDTH; x += 16) {
+		u = _mm_loadu_si128((const __m128i *)(up + x));
+		w = _mm_loadu_si128((const __m128i *)(down + x));
+		best = _mm_or_si128(_mm_subs_epu8(u, w), _mm_subs_epu8(w, u));
+		v = _mm_avg_epu8(u, w);
+		for (i = 0; i < 4; i++) {
+			u = _mm_loadu_si128((const __m128i *)(up + x + slope[i]));
+			w = _mm_loadu_si128((const __m128i *)(down + x - slope[i]));
+			diff = _mm_or_si128(_mm_subs_epu8(u, w), _mm_subs_epu8(w, u));
+
+			/* diff < best, unsigned: min(diff, best) == diff but not best */
+			m = _mm_andnot_si128(_mm_cmpeq_epi8(diff, best), _mm_cmpeq_epi8(_mm_min_epu8(diff, best), diff));
+			best = _mm_min_epu8(diff, best);
+			v = _mm_or_si128(_mm_and_si128(m, _mm_avg_epu8(u, w)), _mm_andnot_si128(m, v));
 		}
+		_mm_storeu_si128((__m128i *)(row + x), v);
 	}
+	for (i = 0; i < ELA_REACH; i++)
+		row[i] = ela_pixel(up, down, i);
+#endif
+	for (; x < VFS_IMAGE_WIDTH; x++)
+		row[x] = ela_pixel(up, down, x);
 }
 
-/* fill area with finger detection data */
-static void _pnm_sense (struct pnm_context *c, int y, int yy, int n)
-{
-	unsigned char *data = c->dev->ibuf + y * FRAME_SIZE;
-	int j = xx(data[283],data[282])>>2;
-	if (data[1] == 0x01) j = 0;
-	while (n--)
-		fprintf(c->file, " % 3d", (j>255) ? ((n&y&1) ? 255 : 0) : j);
-}
-
-/* newline in the output pnm file */
-static void _pnm_newline (struct pnm_context *c)
+/* rebuild the pending rows, now the row below them has arrived */
+static void planes_fill (struct scan_planes *sp)
 {
-	fprintf(c->file, "\n");
-}
+	unsigned char *down = sp->image.data + (sp->image.rows - 1) * VFS_IMAGE_WIDTH;
+	unsigned char *up = down - (sp->pending + 1) * VFS_IMAGE_WIDTH;
+	unsigned char *row;
+	int i;
 
-/* create a PNM header for the output file */
-static void _pnm_header (struct pnm_context *c)
-{
-	struct pnm_formatter *f = c->fmt;
-	int n_x = c->len + f->x0 + f->x1;
-	int n_y = c->height + f->y0 + f->y1;
-	fprintf(c->file, "P2\n%d %d\n256\n", n_x, n_y);
-}
+	for (row = up + VFS_IMAGE_WIDTH; row < down; row += VFS_IMAGE_WIDTH)
+		ela_row(row, up, down);
 
-/* call the three printers for each row of the section */
-static void _pnm_section (struct pnm_context *c, int y, pnm_func_1 l, pnm_func m, pnm_func_1 r)
-{
-	struct pnm_formatter *f = c->fmt;
-	int i;
-	for (i=0; i<y; i++) {
-		if (l) l (c, i, y, f->x0);
-		if (m) m (c, i, y);
-		if (r) r (c, i, y, f->x1);
-		_pnm_newline(c);
-	}
+	/* the strip is only used to track the finger, so plain averages do */
+	down = sp->bc.data + (sp->bc.rows - 1) * BC_WIDTH;
+	up = down - (sp->pending + 1) * BC_WIDTH;
+	for (row = up + BC_WIDTH; row < down; row += BC_WIDTH)
+		for (i = 0; i < BC_WIDTH; i++)
+			row[i] = (up[i] + down[i] + 1) >> 1;
+	sp->pending = 0;
 }
 
-/* create a pnm file as a set of discrete areas */
-static void show_pnm_1 (struct pnm_context *c)
+static void planes_begin (struct vfs_dev *dev, struct line_sink *s)
 {
-	struct pnm_formatter *f = c->fmt;
-	_pnm_header  (c);
-	_pnm_section (c, f->y0,     _pnm_black, f->header, _pnm_black);
-	_pnm_section (c, c->height, f->left,    f->body,   f->right);
-	_pnm_section (c, f->y1,     _pnm_black, f->footer, _pnm_black);
+	struct scan_planes *sp = (struct scan_planes *)s;
+	sp->image.rows = 0;
+	sp->info.rows = 0;
+	sp->bc.rows = 0;
+	sp->lines = 0;
+	sp->pending = 0;
+	sp->err = 0;
+	sp->speed.rows = 0;
+	sp->speed.iso.rows = 0;
+	sp->speed.cheap = 0;
+	sp->speed.full = 0;
 }
 
-/* open a new file and invoke the pnm creator */
-static void show_pnm (struct vfs_dev *dev, unsigned char dir, int offset, int len, struct pnm_formatter *fmt)
+static void planes_line (struct vfs_dev *dev, struct line_sink *s, unsigned char *data, int length)
 {
-	struct pnm_context _c, *c = &_c;
-	char name[40];
+	struct scan_planes *sp = (struct scan_planes *)s;
+	struct plane *p;
+	struct line_meta *m;
+	unsigned char *row;
+	int hides = -1;
 
-	sprintf(name, "img/%c/out-%03d-%02x.pnm", dir, dev->inum, dev->inum);
-
-	c->dev = dev;
-	c->fmt = fmt;
-	c->offset = offset;
-	c->len = len;
-	c->height = dev->ilen/FRAME_SIZE;
-	c->file = fopen(name, "w");
+	if ((length < FRAME_SIZE) || (data[0] != 0x01) || ((data[1] != LINE_IMAGE) && (data[1] != LINE_INFO)))
+		return;
+	if ((sp->max_image > 0) && (sp->image.rows >= sp->max_image))
+		return;
 
-	if (c->file != NULL) {
-		show_pnm_1(c);
-		fclose(c->file);
+	/* hold a row for the image under an info line, if there is a row above it */
+	if (sp->fill && (data[1] == LINE_INFO) && (sp->image.rows > 0)) {
+		if (plane_add(&sp->image) == NULL) {
+			sp->err = LIBUSB_ERROR_NO_MEM;
+			return;
+		}
+		if (plane_add(&sp->bc) == NULL) {
+			sp->image.rows--;
+			sp->err = LIBUSB_ERROR_NO_MEM;
+			return;
+		}
+		sp->pending++;
+		hides = sp->image.rows - 1;
+	}
 
+	p = (data[1] == LINE_IMAGE) ? &sp->image : &sp->info;
+	if ((grow((void **)&sp->meta, &sp->max_lines, sp->lines, sizeof(*m)) < 0) || ((row = plane_add(p)) == NULL)) {
+		sp->err = LIBUSB_ERROR_NO_MEM;
+		return;
+	}
+	memcpy(row, data + 6, VFS_IMAGE_WIDTH);
+	if (p == &sp->image) {
+		if ((row = plane_add(&sp->bc)) == NULL) {
+			sp->image.rows--;
+			sp->err = LIBUSB_ERROR_NO_MEM;
+			return;
+		}
+		memcpy(row, data + 206, BC_WIDTH);
+	}
+	if ((p == &sp->image) && sp->pending)
+		planes_fill(sp);
+	if (sp->resample)
+		speed_rows(sp);
+
+	m = &sp->meta[sp->lines++];
+	m->type = data[1];
+	m->row = p->rows - 1;
+	m->hides = hides;
+	if (m->type == LINE_IMAGE) {
+		m->seq = xx(data[3], data[2]);
+		m->state = data[276];
+		m->next = data[277];
+		m->count = xx(data[279], data[278]);
+		m->level = xx(data[281], data[280]);
 	} else {
-		fprintf(stderr, "Can't open \"%s\" for writing", name);
+		/* info lines number themselves big endian */
+		m->seq = xx(data[2], data[3]);
+		m->state = m->next = 0;
+		m->count = m->level = 0;
 	}
 }
 
+/* rows still held at the end have nothing below them to be rebuilt from */
+static void planes_end (struct vfs_dev *dev, struct line_sink *s)
+{
+	struct scan_planes *sp = (struct scan_planes *)s;
+	int i;
 
+	for (i = sp->lines - 1; (i >= 0) && (sp->meta[i].hides >= sp->image.rows - sp->pending); i--)
+		sp->meta[i].hides = -1;
+	sp->image.rows -= sp->pending;
+	sp->bc.rows -= sp->pending;
+	sp->pending = 0;
+}
 
-/******************************************************************************************************
- * Specific PNM formatters
- */
-
-static struct pnm_formatter foo =
+static struct line_sink scan_planes_sink =
 {
-	.y0     = 5,
-	.y1     = 5,
-	.x0     = 40,
-	.x1     = 5,
-	.header = _pnm_frameruler,
-	.left   = _pnm_sense,
-	.body   = _pnm_frame,
-	.right  = _pnm_ruler,
-	.footer = _pnm_frameruler,
+	.begin = planes_begin,
+	.line  = planes_line,
+	.end   = planes_end,
 };
 
-static struct pnm_formatter bar =
+static void planes_init (struct scan_planes *sp)
 {
-	.y0     = 0,
-	.y1     = 0,
-	.x0     = 0,
-	.x1     = 0,
-	.header = NULL,
-	.left   = NULL,
-	.body   = _pnm_frame,
-	.right  = NULL,
-	.footer = NULL,
-};
-
-
-
+	memset(sp, 0, sizeof(*sp));
+	sp->sink = scan_planes_sink;
+	sp->image.width = VFS_IMAGE_WIDTH;
+	sp->info.width = VFS_IMAGE_WIDTH;
+	sp->bc.width = BC_WIDTH;
+	sp->speed.iso.width = VFS_IMAGE_WIDTH;
+}
 
-static void create_pnms (struct vfs_dev *dev)
+static void planes_free (struct scan_planes *sp)
 {
-	if (dev->anonymous) return;
-	show_pnm (dev, 'X',   0, 292, &foo);
-	show_pnm (dev, 'Y',   0, 292, &bar);
-	// show_pnm (dev, 'A',   0, 206, &foo);
-	// show_pnm (dev, 'B', 206,  66, &foo);
-	// show_pnm (dev, 'C', 272,  20, &foo);
-	dev->inum++;
+	free(sp->image.data);
+	free(sp->info.data);
+	free(sp->bc.data);
+	free(sp->meta);
+	free(sp->speed.iso.data);
+	planes_init(sp);
 }
 
 
 /******************************************************************************************************
- * Low level send/receive functions
+ * Swipe speed and resampling
+ *
+ * The sensor takes one line per sample however fast the finger moves, so a
+ * quick swipe comes out squashed and a slow one stretched. Ridges look much
+ * the same in any direction, so how far the finger moved between two rows
+ * can be read off how different they are: a row differs from its neighbour
+ * below by as much as it would from itself shifted sideways by the same
+ * distance. speed_rows() measures both with SAD as each image row is
+ * completed, over the Image BC strip where that gives a sound reading and
+ * over Fingerprint A where it doesn't, and lays the rows out again at one
+ * row per pixel of travel in the iso plane, so the image is done when the
+ * swipe is.
  */
 
-#define EP_IN(n)     (n | LIBUSB_ENDPOINT_IN)
-#define EP_OUT(n)    (n | LIBUSB_ENDPOINT_OUT)
-
-#define BULK_TIMEOUT 100
+/* furthest sideways shift measured, in pixels, which caps the speed; rows
+ * compared at most this far apart; and the least difference per pixel
+ * between shifted rows for there to be any texture to go by */
+#define SPEED_SHIFT 4
+#define SPEED_REACH 4
+#define SPEED_FLAT  2.0f
 
-/* The first two bytes of data will be overwritten with seq */
-static int send(struct vfs_dev *dev, unsigned char *data, size_t len)
+/* sum of absolute differences of n bytes */
+static int sad (const unsigned char *a, const unsigned char *b, int n)
 {
-	int transferred;
-	int r;
-
-	data[0] = b0(dev->seq);
-	data[1] = b1(dev->seq);
+	int i = 0, r = 0;
+
+#ifdef __SSE2__
+	__m128i acc = _mm_setzero_si128();
+	for (; i + 16 <= n; i += 16)
+		acc = _mm_add_epi64(acc, _mm_sad_epu8(_mm_loadu_si128((const __m128i *)(a + i)), _mm_loadu_si128((const __m128i *)(b + i))));
+	r = _mm_cvtsi128_si32(acc) + _mm_cvtsi128_si32(_mm_srli_si128(acc, 8));
+#endif
+	for (; i < n; i++)
+		r += (a[i] > b[i]) ? a[i] - b[i] : b[i] - a[i];
+	return r;
+}
 
-	dump_buffer(data, len, "  --->");
-	r = libusb_bulk_transfer(dev->devh, EP_OUT(1), data, len, &transferred, BULK_TIMEOUT);
+/* sideways shift, in pixels, that would make a row differ by q per pixel,
+ * given h[s] for shifts of 0 to max */
+static float shift_for (const float *h, int max, float q)
+{
+	int s;
 
-	if (r < 0) {
-		fprintf(stderr, "bulk write error %d", r);
-		return r;
+	for (s = 1; s <= max; s++)
+		if (q < h[s])
+			return (s - 1) + (q - h[s - 1]) / (h[s] - h[s - 1]);
+	return max;
+}
 
-	} else if (transferred < len) {
-		fprintf(stderr, "unexpected short write %d/%zd", transferred, len);
-		return -EIO;
+/* The Image BC strip is a coarser copy of Fingerprint A, about BC_SCALE
+ * image pixels to each of its own, so the same reading from its 64 bytes
+ * costs about a third of one from the full row. Returns 1 with the speed
+ * in *d, or 0 when the strip can't be trusted for this row: too flat, the
+ * finger too fast for it, or a reading far off the smoothed speed. */
+#define BC_SHIFT 2
+#define BC_SCALE ((float)VFS_IMAGE_WIDTH / BC_WIDTH)
 
-	} else {
+static int speed_bc (struct scan_planes *sp, int n, float *d)
+{
+	const unsigned char *row = sp->bc.data + n * BC_WIDTH;
+	float h[BC_SHIFT + 1], dk, v = sp->speed.speed;
+	int s, k;
+
+	h[0] = 0;
+	for (s = 1; s <= BC_SHIFT; s++) {
+		h[s] = (float)sad(row, row + s, BC_WIDTH - s) / (BC_WIDTH - s);
+		if (h[s] < h[s - 1])
+			h[s] = h[s - 1];
+	}
+	if (h[BC_SHIFT] < SPEED_FLAT)
 		return 0;
+
+	*d = -1;
+	for (k = 1; (k <= SPEED_REACH) && (k <= n); k++) {
+		dk = shift_for(h, BC_SHIFT, (float)sad(row, row - k * BC_WIDTH, BC_WIDTH) / BC_WIDTH);
+		if (dk >= BC_SHIFT)
+			break;
+		*d = dk * BC_SCALE / k;
 	}
+	return (*d >= 0) && (*d <= 2 * v) && (*d >= v / 2);
 }
 
-static int recv(struct vfs_dev *dev)
+/* the finger's travel since the last row, from the full width of
+ * Fingerprint A */
+static float speed_full (struct scan_planes *sp, int n)
 {
-	int transferred;
-	int r;
+	const unsigned char *row = sp->image.data + n * VFS_IMAGE_WIDTH;
+	float h[SPEED_SHIFT + 1], d;
+	int s, k;
+
+	/* difference per pixel against the row shifted sideways, kept rising */
+	h[0] = 0;
+	for (s = 1; s <= SPEED_SHIFT; s++) {
+		h[s] = (float)sad(row, row + s, VFS_IMAGE_WIDTH - s) / (VFS_IMAGE_WIDTH - s);
+		if (h[s] < h[s - 1])
+			h[s] = h[s - 1];
+	}
+	if (h[SPEED_SHIFT] < SPEED_FLAT)
+		return sp->speed.speed;
+
+	/* compare with the row furthest back that is still within reach of
+	 * the sideways shifts, for the finest reading of a slow finger */
+	d = SPEED_SHIFT;
+	for (k = 1; (k <= SPEED_REACH) && (k <= n); k++) {
+		float dk = shift_for(h, SPEED_SHIFT, (float)sad(row, row - k * VFS_IMAGE_WIDTH, VFS_IMAGE_WIDTH) / VFS_IMAGE_WIDTH);
+		if (dk >= SPEED_SHIFT)
+			break;
+		d = dk / k;
+	}
+	return d;
+}
 
-	r = libusb_bulk_transfer(dev->devh, EP_IN(1), dev->buf, 0x40, &dev->len, BULK_TIMEOUT);
+/* pixels the finger moved between image rows n - 1 and n */
+static float speed_row (struct scan_planes *sp, int n)
+{
+	float d;
 
-	if (r < 0 && r != -7) {
-		fprintf(stderr, "bulk read error %d", r);
-		return r;
+	if (speed_bc(sp, n, &d)) {
+		sp->speed.cheap++;
+		return d;
 	}
+	sp->speed.full++;
+	return speed_full(sp, n);
+}
 
-	dump_buffer(dev->buf, dev->len, "  <---");
-	if ((b0(dev->seq) != dev->buf[0]) || (b1(dev->seq) != dev->buf[1])) {
-		fprintf(stderr, "*********** Seqnum mismatch, got %04x, expected %04x\n", xx(dev->buf[1],dev->buf[0]), dev->seq);
+/* row = a + (b - a) * w / 128 */
+static void lerp_row (unsigned char *row, const unsigned char *a, const unsigned char *b, int w)
+{
+	int x = 0;
+
+#ifdef __SSE2__
+	const __m128i zero = _mm_setzero_si128(), ww = _mm_set1_epi16(w);
+	for (; x + 16 <= VFS_IMAGE_WIDTH; x += 16) {
+		__m128i va = _mm_loadu_si128((const __m128i *)(a + x));
+		__m128i vb = _mm_loadu_si128((const __m128i *)(b + x));
+		__m128i lo = _mm_sub_epi16(_mm_unpacklo_epi8(vb, zero), _mm_unpacklo_epi8(va, zero));
+		__m128i hi = _mm_sub_epi16(_mm_unpackhi_epi8(vb, zero), _mm_unpackhi_epi8(va, zero));
+		lo = _mm_add_epi16(_mm_unpacklo_epi8(va, zero), _mm_srai_epi16(_mm_mullo_epi16(lo, ww), 7));
+		hi = _mm_add_epi16(_mm_unpackhi_epi8(va, zero), _mm_srai_epi16(_mm_mullo_epi16(hi, ww), 7));
+		_mm_storeu_si128((__m128i *)(row + x), _mm_packus_epi16(lo, hi));
 	}
-
-	dev->seq++;
-
-	return 0;
+#endif
+	for (; x < VFS_IMAGE_WIDTH; x++)
+		row[x] = a[x] + (((b[x] - a[x]) * w) >> 7);
 }
 
-static int load (struct vfs_dev *dev, unsigned char *buf, int *len)
+/* take in the image rows completed since last time */
+static void speed_rows (struct scan_planes *sp)
 {
+	struct swipe_speed *v = &sp->speed;
+	const unsigned char *a, *b;
+	unsigned char *row;
+	float y0, t;
 	int n;
 
-	*len = 0;
-
-	do {
-		int r = libusb_bulk_transfer(dev->devh, EP_IN(2), buf, N_FRAMES*FRAME_SIZE, &n, BULK_TIMEOUT);
-
-		buf += n;
-		*len += n;
+	for (n = v->rows; n < sp->image.rows - sp->pending; n++) {
+		b = sp->image.data + n * VFS_IMAGE_WIDTH;
 
-		if (r < 0 && r != -7) {
-			//fp_err("bulk read error %d", r);
-			return r;
+		if (n == 0) {
+			v->speed = 1.0f;
+			v->y = 0.0f;
+			if ((row = plane_add(&v->iso)) == NULL)
+				goto nomem;
+			memcpy(row, b, VFS_IMAGE_WIDTH);
+			continue;
 		}
 
-	} while (n == N_FRAMES*FRAME_SIZE);
+		/* smooth the estimate over a few rows; a finger can't change
+		 * speed much in a line or two, but single readings are noisy */
+		v->speed += 0.25f * (speed_row(sp, n) - v->speed);
+		if (v->speed < 1.0f / 16)
+			v->speed = 1.0f / 16;
+
+		/* resampled rows falling between this row and the last */
+		a = b - VFS_IMAGE_WIDTH;
+		y0 = v->y;
+		v->y += v->speed;
+		for (t = (float)v->iso.rows; t <= v->y; t += 1.0f) {
+			if ((row = plane_add(&v->iso)) == NULL)
+				goto nomem;
+			lerp_row(row, a, b, (int)(128 * (t - y0) / v->speed));
+		}
+	}
+	v->rows = n;
+	return;
 
-	return 0;
+nomem:
+	v->rows = n + 1;
+	sp->err = LIBUSB_ERROR_NO_MEM;
 }
 
-static int swap (struct vfs_dev *dev, unsigned char *data, size_t len)
+
+/******************************************************************************************************
+ * Debug printing routines
+ */
+
+/* line sink printing each frame of the image as it arrives, picking a
+ * frame header up again across line boundaries */
+static void dump_image_begin (struct vfs_dev *dev, struct line_sink *s)
 {
-	int r;
-	if ((r = send(dev, data, len)) < 0)
-		return r;
-	usleep(2000);
-	if ((r = recv(dev)) < 0)
-		return r;
-	return 0;
+	struct dump_sink *d = (struct dump_sink *)s;
+	dump_scan_begin(dev->log, &d->dump);
 }
 
+static void dump_image_line (struct vfs_dev *dev, struct line_sink *s, unsigned char *data, int length)
+{
+	struct dump_sink *d = (struct dump_sink *)s;
+	dump_scan_data(&d->dump, data, length);
+}
 
-/******************************************************************************************************
- * Protocol-level API routines
+static void dump_image_end (struct vfs_dev *dev, struct line_sink *s)
+{
+	struct dump_sink *d = (struct dump_sink *)s;
+	dump_scan_end(&d->dump);
+}
 
-     01 - Reset
-     02 - GetVersion
-     03 - GetPrint
-     04 - GetParam
-     05 - SetParam
-     06 - GetConfig
-     07   DownloadPatch
-     08   GetRateData
-     09   IspRequest
-     0A   ProgramFlash
-     0B   EraseFlash
-     0C   LedStates
-     0D   LedEvent
-     0E - AbortPrint
-     0F   Spare2
-     10   Spare3
-     11   Spare4
-     12 - Peek
-     13 - Poke
-     14 - SensorSpiTrans
-     15   SensorGPIO
-     16 - GetFingerState 
-*/
+static struct line_sink dump_image =
+{
+	.begin = dump_image_begin,
+	.line  = dump_image_line,
+	.end   = dump_image_end,
+};
 
-static int _cmd_no = -1;
-#define _() fprintf(stdout, "\n> %s (%d)\n", __FUNCTION__,_cmd_no); _cmd_no=-1
 
-/* Reset (00 00 01 00)
+/******************************************************************************************************
+ * Binary trace recorder
  *
- *  Cause the device to reenumerate on the USB bus.
+ * With trace=FILE, packets and scan lines are appended to FILE as typed
+ * records (see trace.h) instead of being printed as hex, and src/vfstrace
+ * turns the file back into the usual text. Records go through a large
+ * stdio buffer, so tracing costs a memcpy rather than a printf per byte.
  */
-static int Reset (struct vfs_dev *dev)
+
+#define TRACE_BUFFER (1 << 20)
+
+#ifndef VFS101_LIBRARY
+static void trace_open (struct vfs_dev *dev, const char *file)
 {
-	unsigned char q1[0x06] = { 0x00, 0x00, 0x00, 0x00, 0x01, 0x00 };
-	_();
-	return swap (dev, q1, 0x06);
+	char name[256];
+
+	if (dev->unit < 0)
+		snprintf(name, sizeof(name), "%s", file);
+	else
+		snprintf(name, sizeof(name), "%s-%d", file, dev->unit);
+
+	dev->trace = fopen(name, "wb");
+	if (dev->trace == NULL) {
+		fprintf(stderr, "Can't create trace file %s\n", name);
+		return;
+	}
+	setvbuf(dev->trace, NULL, _IOFBF, TRACE_BUFFER);
+	fwrite(TRACE_MAGIC, 1, 8, dev->trace);
+	dev->trace_t0 = now_us();
 }
+#endif
 
-/* GetVersion (00 00 01 00)
- *
- *  Retrieve version string from the device.
- */
-static int GetVersion (struct vfs_dev *dev)
+static void trace_close (struct vfs_dev *dev)
 {
-	unsigned char q1[0x07] = { 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00 };
-	_();
-	return swap (dev, q1, 0x07);
+	if (dev->trace == NULL)
+		return;
+	if (fclose(dev->trace) != 0)
+		fprintf(stderr, "Error writing trace file\n");
+	dev->trace = NULL;
 }
 
-/* GetPrint (00 00 03 00)
- *
- *  Retrieve fingerprint image information.
- */
-static unsigned char type_0[6] = "\x00\x01\x00\x00\x00\x01";
-static unsigned char type_1[6] = "\x01\x00\x00\x00\x01\x01";
-static unsigned char type_2[6] = "\x00\x00\x00\x00\x00\x01";
-static int GetPrint (struct vfs_dev *dev, int count, unsigned char args[6])
+static void trace_rec (struct vfs_dev *dev, int type, int arg, const unsigned char *data, int len)
 {
-	unsigned char q1[0x0e] = { 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
-	int i;
-	q1[6] = b0(count);
-	q1[7] = b1(count);
-	for (i=0; i<6; i++) q1[8+i] = args[i];
-	_();
-	return swap (dev, q1, 0x0e);
+	struct trace_rec rec;
+
+	memset(&rec, 0, sizeof(rec));
+	rec.type = type;
+	rec.len = len;
+	rec.arg = arg;
+	rec.t = now_us() - dev->trace_t0;
+	fwrite(&rec, sizeof(rec), 1, dev->trace);
+	if (len > 0)
+		fwrite(data, 1, len, dev->trace);
 }
 
-/* GetParam (00 00 04 00)
- *
- *  Retrieve a parameter value from the device.
- */
-static int GetParam (struct vfs_dev *dev, unsigned short param)
+/* line sink recording each frame of the image as it arrives */
+static void trace_image_begin (struct vfs_dev *dev, struct line_sink *s)
 {
-	unsigned char q1[0x08] = { 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 };
-	q1[6] = b0(param);
-	q1[7] = b1(param);
-	_();
-	return swap (dev, q1, 0x08);
+	trace_rec(dev, TR_SCAN, dev->inum, NULL, 0);
 }
 
-/* SetParam (00 00 05 00)
- *
- *  Set a parameter value on the device.
- */
-static int SetParam (struct vfs_dev *dev, unsigned short param, unsigned short value)
+static void trace_image_line (struct vfs_dev *dev, struct line_sink *s, unsigned char *data, int length)
 {
-	unsigned char q1[0x0a] = { 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00 };
-	q1[6] = b0(param);
-	q1[7] = b1(param);
-	q1[8] = b0(value);
-	q1[9] = b1(value);
-	_();
-	return swap (dev, q1, 0x0a);
+	trace_rec(dev, TR_LINE, s->tail, data, length);
 }
 
-struct set_param {
-	unsigned short param;
-	unsigned short value;
-};
-
-static int SetParamList (struct vfs_dev *dev, struct set_param *params, int nparams)
+static void trace_image_end (struct vfs_dev *dev, struct line_sink *s)
 {
-	int r, i;
-	for (i = 0; i < nparams; i++)
-		if ((r = SetParam(dev, params[i].param, params[i].value)) < 0)
-			return r;
-	return 0;
+	trace_rec(dev, TR_END, dev->ring.head, NULL, 0);
 }
 
-/* GetConfig (00 00 06 00)
- *
- *  Retrieve config info from the device.
- */
-static int GetConfig (struct vfs_dev *dev)
+static struct line_sink trace_image =
 {
-	unsigned char q1[0x06] = { 0x00, 0x00, 0x00, 0x00, 0x06, 0x00 };
-	_();
-	return swap (dev, q1, 0x06);
-}
+	.begin = trace_image_begin,
+	.line  = trace_image_line,
+	.end   = trace_image_end,
+};
 
-/* AbortPrint (00 00 0e 00)
+
+/******************************************************************************************************
+ * PNM formatter framework
  *
- *  Abort the current scan operation.
+ * Each output row is the raw image stripe of a scan line with borders
+ * drawn around it by the formatter's printers. Everything that doesn't
+ * depend on the scan line (the top and bottom borders, and side borders
+ * that repeat every few rows) is drawn once when the file is opened, so
+ * a row is put together with a few memcpy()s and appended to the file
+ * in one go: as raw bytes for P5, or for P2 as four characters a pixel.
+ * All of this runs on the background image writer's thread.
  */
-static int AbortPrint (struct vfs_dev *dev)
+
+/* widest output row: a whole scan line plus the widest borders */
+#define PNM_MAX_WIDTH 512
+
+struct pnm_context;
+
+typedef void (*pnm_func)   (struct pnm_context *, int, int);
+typedef void (*pnm_func_1) (struct pnm_context *, int, int, int);
+
+struct pnm_formatter {
+
+	/* how many pixels are added on each side of image */
+	int y0;   // top
+	int y1;   // bottom
+	int x0;   // left
+	int x1;   // right
+
+	/* printers for the borders, black where NULL */
+	pnm_func   header;
+	pnm_func_1 left;
+	pnm_func_1 right;
+	pnm_func   footer;
+
+	/* rows after which the left and right borders repeat themselves, or
+	 * 0 for a border drawn from each scan line as it comes */
+	int left_period;
+	int right_period;
+};
+
+struct pnm_context {
+
+	/* file being written, and its name */
+	FILE *file;
+	char name[40];
+
+	/* which PNM formatter to use */
+	struct pnm_formatter *fmt;
+
+	/* how many scan lines have been written so far */
+	int height;
+
+	/* the scan line being written */
+	unsigned char *line;
+
+	/* which img/ subdirectory to write into */
+	unsigned char dir;
+
+	/* first column of image stripe */
+	int offset;
+
+	/* width of image stripe */
+	int len;
+
+	/* write ASCII P2 rather than binary P5 */
+	int ascii;
+
+	/* the output row being built, and how much of it is filled in */
+	unsigned char row[PNM_MAX_WIDTH];
+	int x;
+
+	/* output row width, and what is drawn once per file: the top and
+	 * bottom borders, and one period of each side border */
+	int width;
+	unsigned char *cache;
+	unsigned char *top;
+	unsigned char *bottom;
+	unsigned char *left;
+	unsigned char *right;
+};
+
+/* add a pixel to the output row */
+static inline void _pnm_put (struct pnm_context *c, int v)
+{
+	if (c->x < PNM_MAX_WIDTH)
+		c->row[c->x++] = v;
+}
+
+/* fill area with black */
+static void _pnm_black (struct pnm_context *c, int y, int yy, int n)
+{
+	while (n--)
+		_pnm_put(c, 0);
+}
+
+/* fill area with vertical gradient */
+static void _pnm_gradient (struct pnm_context *c, int y, int yy, int n)
+{
+	int z = 255*((float)y/(float)yy);
+	while (n--)
+		_pnm_put(c, z);
+}
+
+/* fill area with 10 pixel ruler */
+static void _pnm_ruler (struct pnm_context *c, int y, int yy, int n)
+{
+	int z = (y%10) ? 0 : 255;
+	_pnm_put(c, 128);
+	n--;
+	while (n--)
+		_pnm_put(c, z ? (n ? z : 128) : 128);
+}
+
+/* file area with image ABCD ruler */
+static void _pnm_frameruler (struct pnm_context *c, int y, int yy)
+{
+	int offset = c->offset;
+	int len = c->len;
+
+	while (len--) {
+		switch (offset++) {
+		case 0:
+		case 206:
+		case 246:
+		case 272:
+			_pnm_put(c, ((y==yy-1) || (y==0)) ? 128 : 255);
+			break;
+		default:
+			_pnm_put(c, 128);
+			break;
+		}
+	}
+}
+
+/* fill area with finger detection data */
+static void _pnm_sense (struct pnm_context *c, int y, int yy, int n)
+{
+	unsigned char *data = c->line;
+	int j = xx(data[283],data[282])>>2;
+	if (data[1] == 0x01) j = 0;
+	if ((j <= 255) && (n <= PNM_MAX_WIDTH - c->x)) {
+		memset(c->row + c->x, j, n);
+		c->x += n;
+		return;
+	}
+	while (n--)
+		_pnm_put(c, (j>255) ? ((n&y&1) ? 255 : 0) : j);
+}
+
+/* write out a row */
+static void _pnm_write (struct pnm_context *c, const unsigned char *row)
+{
+	char buf[PNM_MAX_WIDTH * 4 + 1], *p = buf;
+	int i, v;
+
+	if (!c->ascii) {
+		fwrite(row, 1, c->width, c->file);
+		return;
+	}
+
+	/* " %3d" for each pixel */
+	for (i = 0; i < c->width; i++) {
+		v = row[i];
+		*p++ = ' ';
+		*p++ = (v >= 100) ? '0' + v / 100 : ' ';
+		*p++ = (v >= 10) ? '0' + (v / 10) % 10 : ' ';
+		*p++ = '0' + v % 10;
+	}
+	*p++ = '\n';
+	fwrite(buf, 1, p - buf, c->file);
+}
+
+/* print a PNM header for the output file into buf, returning its length.
+ * The height is padded to a fixed width so it can be rewritten in place
+ * once the scan has ended */
+static int _pnm_header (struct pnm_context *c, char *buf)
+{
+	struct pnm_formatter *f = c->fmt;
+	int n_x = c->len + f->x0 + f->x1;
+	int n_y = c->height + f->y0 + f->y1;
+	if (c->ascii)
+		return sprintf(buf, "P2\n%d %8d\n256\n", n_x, n_y);
+	else
+		return sprintf(buf, "P5\n%d %8d\n255\n", n_x, n_y);
+}
+
+/* draw rows of a top or bottom border into dst */
+static void _pnm_draw_section (struct pnm_context *c, unsigned char *dst, int y, pnm_func m)
+{
+	struct pnm_formatter *f = c->fmt;
+	int i;
+
+	for (i=0; i<y; i++) {
+		c->x = 0;
+		_pnm_black(c, i, y, f->x0);
+		if (m) m (c, i, y);
+		else _pnm_black(c, i, y, c->len);
+		_pnm_black(c, i, y, f->x1);
+		memcpy(dst + i * c->width, c->row, c->width);
+	}
+}
+
+/* draw a period of a side border n pixels wide into dst */
+static void _pnm_draw_border (struct pnm_context *c, unsigned char *dst, int period, pnm_func_1 p, int n)
+{
+	int i;
+
+	for (i=0; i<period; i++) {
+		c->x = 0;
+		if (p) p (c, i, 0, n);
+		else _pnm_black(c, i, 0, n);
+		memcpy(dst + i * n, c->row, n);
+	}
+}
+
+/* add a side border to the output row, from the cache if it repeats */
+static void _pnm_border (struct pnm_context *c, const unsigned char *cache, int period, pnm_func_1 p, int n)
+{
+	int y = c->height;
+
+	if (period) {
+		memcpy(c->row + c->x, cache + (y % period) * n, n);
+		c->x += n;
+	} else if (p) {
+		p (c, y, 0, n);
+	} else {
+		_pnm_black(c, y, 0, n);
+	}
+}
+
+/* start a new file: draw what doesn't change, then header and top border */
+static void pnm_open (struct pnm_context *c)
+{
+	struct pnm_formatter *f = c->fmt;
+	char head[40];
+	int i;
+
+	c->height = 0;
+	c->width = f->x0 + c->len + f->x1;
+	c->file = NULL;
+
+	if (c->width > PNM_MAX_WIDTH) {
+		fprintf(stderr, "PNM rows of %d pixels are too wide\n", c->width);
+		return;
+	}
+	c->cache = malloc((f->y0 + f->y1) * c->width + f->left_period * f->x0 + f->right_period * f->x1 + 1);
+	if (c->cache == NULL) {
+		fprintf(stderr, "Out of memory for \"%s\"\n", c->name);
+		return;
+	}
+	c->top = c->cache;
+	c->bottom = c->top + f->y0 * c->width;
+	c->left = c->bottom + f->y1 * c->width;
+	c->right = c->left + f->left_period * f->x0;
+	_pnm_draw_section (c, c->top, f->y0, f->header);
+	_pnm_draw_section (c, c->bottom, f->y1, f->footer);
+	_pnm_draw_border (c, c->left, f->left_period, f->left, f->x0);
+	_pnm_draw_border (c, c->right, f->right_period, f->right, f->x1);
+
+	c->file = fopen(c->name, "wb");
+	if (c->file == NULL) {
+		fprintf(stderr, "Can't open \"%s\" for writing\n", c->name);
+		free(c->cache);
+		c->cache = NULL;
+		return;
+	}
+	fwrite(head, 1, _pnm_header (c, head), c->file);
+	for (i = 0; i < f->y0; i++)
+		_pnm_write (c, c->top + i * c->width);
+}
+
+/* one row of the image body per scan line */
+static void pnm_row (struct pnm_context *c, unsigned char *data)
+{
+	struct pnm_formatter *f = c->fmt;
+
+	if (c->file == NULL)
+		return;
+
+	c->line = data;
+	c->x = 0;
+	_pnm_border (c, c->left, f->left_period, f->left, f->x0);
+	memcpy(c->row + c->x, data + c->offset, c->len);
+	c->x += c->len;
+	_pnm_border (c, c->right, f->right_period, f->right, f->x1);
+	_pnm_write(c, c->row);
+	c->height++;
+}
+
+/* bottom border, then patch the real height into the header */
+static void pnm_close (struct pnm_context *c)
+{
+	struct pnm_formatter *f = c->fmt;
+	char head[40];
+	int i;
+
+	if (c->file != NULL) {
+		for (i = 0; i < f->y1; i++)
+			_pnm_write (c, c->bottom + i * c->width);
+		if ((fseek(c->file, 0, SEEK_SET) != 0) || (fwrite(head, 1, _pnm_header (c, head), c->file) == 0) || ferror(c->file))
+			fprintf(stderr, "Short write to \"%s\"\n", c->name);
+		if (fclose(c->file) != 0)
+			fprintf(stderr, "Short write to \"%s\"\n", c->name);
+		c->file = NULL;
+	}
+	free(c->cache);
+	c->cache = NULL;
+}
+
+
+/******************************************************************************************************
+ * Specific PNM formatters
+ */
+
+static struct pnm_formatter foo =
+{
+	.y0     = 5,
+	.y1     = 5,
+	.x0     = 40,
+	.x1     = 5,
+	.header = _pnm_frameruler,
+	.left   = _pnm_sense,
+	.right  = _pnm_ruler,
+	.footer = _pnm_frameruler,
+	.right_period = 10,
+};
+
+static struct pnm_formatter bar =
+{
+	.y0     = 0,
+	.y1     = 0,
+	.x0     = 0,
+	.x1     = 0,
+	.header = NULL,
+	.left   = NULL,
+	.right  = NULL,
+	.footer = NULL,
+};
+
+
+
+
+/******************************************************************************************************
+ * Background image writer
+ *
+ * The PNM files are formatted and written by a worker thread, straight out
+ * of the scan ring. The writer's ring sink only hands it each scan, with
+ * the names and formats of its files, and tells it how many lines have
+ * landed; the worker moves the sink's cursor on as it writes them. So the
+ * ring is the queue between the two, and the load only waits for the
+ * worker when it falls WRITER_LAG lines behind, or at the end of a scan,
+ * since the ring is reused by the next one. The bottom borders and the
+ * closing of the files are left to the worker, and dev_close() waits for
+ * the last of them.
+ */
+
+#define WRITER_LAG (RING_LINES / 2)
+#define MAX_PNMS 5
+
+/* the files of one scan */
+struct image_scan {
+	struct pnm_context pnm[MAX_PNMS];
+	int n;
+};
+
+struct image_writer {
+
+	/* line sink feeding the worker, must come first */
+	struct line_sink sink;
+	struct vfs_dev *dev;
+
+	/* the files each scan gets: only dir, offset, len and fmt are set */
+	struct pnm_context setup[MAX_PNMS];
+	int nsetup;
+
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	int threaded;
+
+	/* the scan whose lines the worker is writing, lines of it in the
+	 * ring and written so far, and whether it is over */
+	struct image_scan *scan;
+	unsigned long lines;
+	unsigned long done;
+	int ended;
+
+	/* set by writer_flush() once nothing more is coming */
+	int stop;
+};
+
+static void image_scan_open (struct image_scan *s)
+{
+	int i;
+	for (i = 0; i < s->n; i++)
+		pnm_open(&s->pnm[i]);
+}
+
+static void image_scan_rows (struct image_scan *s, struct line_ring *ring, unsigned long from, unsigned long to)
+{
+	int i;
+	for (; from < to; from++)
+		for (i = 0; i < s->n; i++)
+			pnm_row(&s->pnm[i], ring_line(ring, from));
+}
+
+static void image_scan_close (struct image_scan *s)
+{
+	int i;
+	for (i = 0; i < s->n; i++)
+		pnm_close(&s->pnm[i]);
+	free(s);
+}
+
+static void *writer_thread (void *arg)
+{
+	struct image_writer *w = arg;
+	struct image_scan *s;
+	unsigned long n;
+
+	pthread_mutex_lock(&w->lock);
+	for (;;) {
+		while ((w->scan == NULL) && !w->stop)
+			pthread_cond_wait(&w->cond, &w->lock);
+		if (w->scan == NULL)
+			break;
+		s = w->scan;
+		pthread_mutex_unlock(&w->lock);
+
+		image_scan_open(s);
+
+		pthread_mutex_lock(&w->lock);
+		for (;;) {
+			while ((w->done == w->lines) && !w->ended)
+				pthread_cond_wait(&w->cond, &w->lock);
+			if (w->done == w->lines)
+				break;
+			n = w->lines;
+			pthread_mutex_unlock(&w->lock);
+
+			image_scan_rows(s, &w->dev->ring, w->done, n);
+
+			pthread_mutex_lock(&w->lock);
+			w->done = n;
+			pthread_cond_broadcast(&w->cond);
+		}
+
+		/* every line is written, so the ring is free for the next scan */
+		w->scan = NULL;
+		pthread_cond_broadcast(&w->cond);
+		pthread_mutex_unlock(&w->lock);
+
+		image_scan_close(s);
+
+		pthread_mutex_lock(&w->lock);
+	}
+	pthread_mutex_unlock(&w->lock);
+	return NULL;
+}
+
+/* hand the scan that is starting to the worker */
+static void writer_begin (struct vfs_dev *dev, struct line_sink *sink)
+{
+	struct image_writer *w = (struct image_writer *)sink;
+	struct image_scan *s = malloc(sizeof(*s));
+	struct pnm_context *c;
+	int i;
+
+	if (s == NULL) {
+		fprintf(stderr, "Out of memory for the images of scan %d\n", dev->inum);
+		return;
+	}
+	for (i = 0; i < w->nsetup; i++) {
+		c = &s->pnm[i];
+		*c = w->setup[i];
+		c->ascii = dev->pnm_ascii;
+		if (dev->unit < 0)
+			sprintf(c->name, "img/%c/out-%03d-%02x.pnm", c->dir, dev->inum, dev->inum);
+		else
+			sprintf(c->name, "img/%c/out%d-%03d-%02x.pnm", c->dir, dev->unit, dev->inum, dev->inum);
+	}
+	s->n = w->nsetup;
+
+	if (!w->threaded) {
+		image_scan_open(s);
+		w->scan = s;
+		return;
+	}
+	pthread_mutex_lock(&w->lock);
+	w->scan = s;
+	w->lines = w->done = 0;
+	w->ended = 0;
+	pthread_cond_broadcast(&w->cond);
+	pthread_mutex_unlock(&w->lock);
+}
+
+/* tell the worker how far the scan has got, waiting if it is too far behind */
+static void writer_avail (struct vfs_dev *dev, struct line_sink *sink, unsigned long n)
+{
+	struct image_writer *w = (struct image_writer *)sink;
+
+	if (!w->threaded) {
+		if (w->scan != NULL)
+			image_scan_rows(w->scan, &dev->ring, sink->tail, n);
+		sink->tail = n;
+		return;
+	}
+	pthread_mutex_lock(&w->lock);
+	if (w->scan != NULL) {
+		w->lines = n;
+		pthread_cond_broadcast(&w->cond);
+		while (n - w->done > WRITER_LAG)
+			pthread_cond_wait(&w->cond, &w->lock);
+	}
+	sink->tail = (w->scan != NULL) ? w->done : n;
+	pthread_mutex_unlock(&w->lock);
+}
+
+/* wait for the worker to write the rest of the scan; a partial line at the
+ * end is dropped */
+static void writer_end (struct vfs_dev *dev, struct line_sink *sink)
+{
+	struct image_writer *w = (struct image_writer *)sink;
+
+	if (!w->threaded) {
+		if (w->scan != NULL)
+			image_scan_close(w->scan);
+		w->scan = NULL;
+		return;
+	}
+	pthread_mutex_lock(&w->lock);
+	w->ended = 1;
+	pthread_cond_broadcast(&w->cond);
+	while (w->scan != NULL)
+		pthread_cond_wait(&w->cond, &w->lock);
+	pthread_mutex_unlock(&w->lock);
+}
+
+/* the writer for dev, started the first time it is needed; without a
+ * worker thread, the files are written in line */
+static struct image_writer *writer_get (struct vfs_dev *dev)
+{
+	struct image_writer *w = dev->writer;
+
+	if (w != NULL)
+		return w;
+	w = calloc(1, sizeof(*w));
+	if (w == NULL)
+		return NULL;
+	w->sink.begin = writer_begin;
+	w->sink.avail = writer_avail;
+	w->sink.end = writer_end;
+	w->dev = dev;
+	pthread_mutex_init(&w->lock, NULL);
+	pthread_cond_init(&w->cond, NULL);
+	w->threaded = (pthread_create(&w->thread, NULL, writer_thread, w) == 0);
+	if (!w->threaded)
+		fprintf(stderr, "Can't start the image writer, saving images in line\n");
+	dev->writer = w;
+	return w;
+}
+
+/* write out whatever is still queued, and stop the worker */
+static void writer_flush (struct vfs_dev *dev)
+{
+	struct image_writer *w = dev->writer;
+
+	if (w == NULL)
+		return;
+
+	if (w->threaded) {
+		pthread_mutex_lock(&w->lock);
+		w->stop = 1;
+		pthread_cond_broadcast(&w->cond);
+		pthread_mutex_unlock(&w->lock);
+		pthread_join(w->thread, NULL);
+	}
+	pthread_cond_destroy(&w->cond);
+	pthread_mutex_destroy(&w->lock);
+	free(w);
+	dev->writer = NULL;
+}
+
+/* add a file to those each scan gets */
+static void show_pnm (struct image_writer *w, unsigned char dir, int offset, int len, struct pnm_formatter *fmt)
+{
+	struct pnm_context *c = &w->setup[w->nsetup++];
+
+	memset(c, 0, sizeof(*c));
+	c->fmt = fmt;
+	c->dir = dir;
+	c->offset = offset;
+	c->len = len;
+}
+
+/* hook the image writer onto the scan ring; it writes as lines arrive */
+static void create_pnms (struct vfs_dev *dev)
+{
+	struct image_writer *w;
+
+	if (dev->anonymous) return;
+	if ((w = writer_get(dev)) == NULL) return;
+	w->nsetup = 0;
+	show_pnm (w, 'X',   0, 292, &foo);
+	show_pnm (w, 'Y',   0, 292, &bar);
+	// show_pnm (w, 'A',   0, 206, &foo);
+	// show_pnm (w, 'B', 206,  66, &foo);
+	// show_pnm (w, 'C', 272,  20, &foo);
+	ring_add(&dev->ring, &w->sink);
+}
+
+
+/******************************************************************************************************
+ * Low level send/receive functions
+ */
+
+#define EP_IN(n)     (n | LIBUSB_ENDPOINT_IN)
+#define EP_OUT(n)    (n | LIBUSB_ENDPOINT_OUT)
+
+#define BULK_TIMEOUT 100
+
+/* how long to wait for a stale reply, and how often to resend a command */
+#define DRAIN_TIMEOUT 20
+#define VFS_RETRIES 3
+
+/* Errors of our own are the VFS_ERR_ codes in vfs101.h. libusb uses -1 to
+ * -99, so every negative result from here on is one or the other, and
+ * vfs_strerror() names them all. */
+const char *vfs_strerror (int r)
+{
+	switch (r) {
+	case VFS_ERR_INVAL:    return "command too long";
+	case VFS_ERR_SHORT:    return "short write";
+	case VFS_ERR_NO_REPLY: return "no reply";
+	case VFS_ERR_SEQ:      return "reply sequence numbers out of step";
+	case VFS_ERR_RETRY:    return "no reply after retries";
+	case VFS_ERR_STOPPED:  return "stopped";
+	case VFS_ERR_PROTO:    return "malformed reply";
+	case VFS_ERR_BUSY:     return "scan in progress";
+	case VFS_ERR_SCRIPT:   return "bad command script";
+	}
+	return (r > VFS_ERR_INVAL) ? libusb_error_name(r) : "unknown error";
+}
+
+/* monotonic clock in microseconds */
+static long long now_us (void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+}
+
+/* map the status of a finished transfer onto a libusb error code */
+static int xfer_status (struct libusb_transfer *t)
+{
+	switch (t->status) {
+	case LIBUSB_TRANSFER_COMPLETED: return 0;
+	case LIBUSB_TRANSFER_TIMED_OUT: return LIBUSB_ERROR_TIMEOUT;
+	case LIBUSB_TRANSFER_STALL:     return LIBUSB_ERROR_PIPE;
+	case LIBUSB_TRANSFER_NO_DEVICE: return LIBUSB_ERROR_NO_DEVICE;
+	case LIBUSB_TRANSFER_OVERFLOW:  return LIBUSB_ERROR_OVERFLOW;
+	case LIBUSB_TRANSFER_CANCELLED: return LIBUSB_ERROR_INTERRUPTED;
+	default:                        return LIBUSB_ERROR_IO;
+	}
+}
+
+static void xfer_done (struct libusb_transfer *t)
+{
+	*(int *)t->user_data = 1;
+}
+
+/* run the libusb event loop until *done becomes set */
+static int xfer_wait (struct vfs_dev *dev, int *done)
+{
+	int r;
+	while (!*done) {
+		r = libusb_handle_events_completed(dev->ctx, done);
+		if ((r < 0) && (r != LIBUSB_ERROR_INTERRUPTED))
+			return r;
+	}
+	return 0;
+}
+
+/* Arm a reply transfer on EP 0x81, then queue the command on EP 0x01 */
+static int usb_send (struct vfs_dev *dev, struct vfs_cmd *c, int len)
+{
+	int r;
+
+	/* the read cancelled by a failed send during a non-blocking scan may
+	 * not be back yet; scan_step() waits for it, anything else blocks */
+	if ((c->xin != NULL) && !c->in_done)
+		xfer_wait(dev, &c->in_done);
+
+	if (c->xin == NULL)
+		c->xin = libusb_alloc_transfer(0);
+	if (c->xout == NULL)
+		c->xout = libusb_alloc_transfer(0);
+	if ((c->xin == NULL) || (c->xout == NULL))
+		return LIBUSB_ERROR_NO_MEM;
+
+	c->in_done = 0;
+	libusb_fill_bulk_transfer(c->xin, dev->devh, EP_IN(1), c->in, sizeof(c->in), xfer_done, &c->in_done, BULK_TIMEOUT);
+	if ((r = libusb_submit_transfer(c->xin)) < 0) {
+		fprintf(stderr, "bulk read submit error %d", r);
+		c->in_done = 1;
+		return r;
+	}
+
+	c->out_done = 0;
+	libusb_fill_bulk_transfer(c->xout, dev->devh, EP_OUT(1), c->out, len, xfer_done, &c->out_done, BULK_TIMEOUT);
+	if ((r = libusb_submit_transfer(c->xout)) < 0) {
+		fprintf(stderr, "bulk write submit error %d", r);
+		c->out_done = 1;
+		libusb_cancel_transfer(c->xin);
+		if (!dev->async)
+			xfer_wait(dev, &c->in_done);
+		return r;
+	}
+
+	return 0;
+}
+
+/* Wait for both transfers of a command. A read timeout still leaves
+ * whatever arrived in c->in. */
+static int usb_recv (struct vfs_dev *dev, struct vfs_cmd *c)
+{
+	int r;
+
+	c->in_len = 0;
+	if ((r = xfer_wait(dev, &c->out_done)) < 0)
+		return r;
+
+	r = xfer_status(c->xout);
+	if (r < 0) {
+		fprintf(stderr, "bulk write error %d", r);
+		libusb_cancel_transfer(c->xin);
+		xfer_wait(dev, &c->in_done);
+		return r;
+
+	} else if (c->xout->actual_length < c->xout->length) {
+		fprintf(stderr, "unexpected short write %d/%d", c->xout->actual_length, c->xout->length);
+		libusb_cancel_transfer(c->xin);
+		xfer_wait(dev, &c->in_done);
+		return VFS_ERR_SHORT;
+	}
+
+	if ((r = xfer_wait(dev, &c->in_done)) < 0)
+		return r;
+
+	c->in_len = c->xin->actual_length;
+	r = xfer_status(c->xin);
+	if (r < 0 && r != LIBUSB_ERROR_TIMEOUT)
+		fprintf(stderr, "bulk read error %d", r);
+	return r;
+}
+
+/* Read one more reply off EP 0x81, such as a late one for a command that
+ * has already timed out */
+static int usb_drain (struct vfs_dev *dev, unsigned char *buf, int *len)
+{
+	*len = 0;
+	return libusb_bulk_transfer(dev->devh, EP_IN(1), buf, 0x40, len, DRAIN_TIMEOUT);
+}
+
+/* Arm the reply transfer of c again for whatever reply comes next. c->xout
+ * still holds the command's finished write, which usb_recv() will pass. */
+static int usb_listen (struct vfs_dev *dev, struct vfs_cmd *c)
+{
+	int r;
+
+	c->in_done = 0;
+	libusb_fill_bulk_transfer(c->xin, dev->devh, EP_IN(1), c->in, sizeof(c->in), xfer_done, &c->in_done, DRAIN_TIMEOUT);
+	if ((r = libusb_submit_transfer(c->xin)) < 0) {
+		fprintf(stderr, "bulk read submit error %d", r);
+		c->in_done = 1;
+		return r;
+	}
+	return 0;
+}
+
+/* Queue a command on the transport. The command is copied into the next
+ * free slot, so the caller's buffer may be reused at once. The first two
+ * bytes of data will be overwritten with seq.
+ */
+static int send(struct vfs_dev *dev, unsigned char *data, size_t len)
+{
+	struct vfs_cmd *c = &dev->cmd[dev->sent % MAX_PIPE];
+	int r;
+
+	if (len > sizeof(c->out))
+		return VFS_ERR_INVAL;
+
+	data[0] = b0(dev->seq);
+	data[1] = b1(dev->seq);
+	memcpy(c->out, data, len);
+	c->out_len = len;
+	c->ready = 0;
+	c->late = 0;
+	c->listening = 0;
+	c->drained = 0;
+	c->resent = 0;
+	c->stale = 0;
+	c->seq = dev->seq;
+	c->cmd_no = dev->cmd_no;
+	dev->cmd_no = -1;
+
+	if (dev->trace)
+		trace_rec(dev, TR_SEND, c->cmd_no, data, len);
+	else if (dev->log)
+		dump_buffer(dev->log, data, len, "  --->");
+	c->t_send = now_us();
+
+	if ((r = dev->tr->send(dev, c, len)) < 0)
+		return r;
+
+	dev->seq++;
+	dev->sent++;
+	return 0;
+}
+
+/* does the reply in c carry c's own sequence number? */
+static int reply_ok (struct vfs_cmd *c)
+{
+	return (c->in_len >= 2) && (c->in[0] == b0(c->seq)) && (c->in[1] == b1(c->seq));
+}
+
+/* commands which may safely be sent twice */
+static int idempotent (struct vfs_cmd *c)
+{
+	switch (c->out[4]) {
+	case 0x04: /* GetParam */
+	case 0x12: /* Peek */
+	case 0x16: /* GetFingerState */
+		return 1;
+	}
+	return 0;
+}
+
+/* count a reply that no command in flight is waiting for */
+static void drop_stale (struct vfs_dev *dev, struct vfs_cmd *c, unsigned short seq)
+{
+	fprintf(stderr, "*********** Dropping stale reply %04x\n", seq);
+	dev->stale++;
+	c->stale++;
+
+	/* never reuse a sequence number the reader may still answer */
+	if ((short)(seq - dev->seq) >= 0)
+		dev->seq = seq + 1;
+}
+
+/* why resync() could not get a reply to c */
+static int resync_err (struct vfs_cmd *c)
+{
+	if (reply_ok(c))
+		return 0;
+	if (idempotent(c))
+		return VFS_ERR_RETRY;
+	return c->stale ? VFS_ERR_SEQ : VFS_ERR_NO_REPLY;
+}
+
+/* The oldest command c got no reply, or someone else's. Wait for every
+ * command still in flight, drain the stale replies queued behind them, and
+ * hand each reply to the command whose sequence number it carries. If c is
+ * still unanswered after that, send it again when it is safe to.
+ */
+static int resync (struct vfs_dev *dev, struct vfs_cmd *c)
+{
+	unsigned char stash[MAX_PIPE + 4][0x40];
+	int len[MAX_PIPE + 4];
+	struct vfs_cmd *d;
+	unsigned short seq;
+	unsigned int i;
+	int j, n = 0, r, tries;
+
+	/* every reply still on its way, in the order they land */
+	if (c->in_len > 0) {
+		memcpy(stash[n], c->in, c->in_len);
+		len[n++] = c->in_len;
+	}
+	for (i = dev->retired; i != dev->sent; i++) {
+		d = &dev->cmd[i % MAX_PIPE];
+		if (d->ready)
+			continue;
+		r = dev->tr->recv(dev, d);
+		if (r < 0 && r != LIBUSB_ERROR_TIMEOUT)
+			return r;
+		if (d->in_len > 0) {
+			memcpy(stash[n], d->in, d->in_len);
+			len[n++] = d->in_len;
+		}
+		d->in_len = 0;
+		d->ready = 1;
+	}
+	while ((n < nitems(len)) && (dev->tr->drain(dev, stash[n], &len[n]) == 0) && (len[n] > 0))
+		n++;
+
+	/* match them up; whatever is left over is stale */
+	c->in_len = 0;
+	for (j = 0; j < n; j++) {
+		seq = (len[j] >= 2) ? xx(stash[j][1], stash[j][0]) : 0;
+		d = (len[j] >= 2) && (seq == c->seq) ? c : NULL;
+		for (i = dev->retired; (d == NULL) && (i != dev->sent); i++)
+			if ((dev->cmd[i % MAX_PIPE].seq == seq) && (dev->cmd[i % MAX_PIPE].in_len == 0))
+				d = &dev->cmd[i % MAX_PIPE];
+		if (d != NULL) {
+			memcpy(d->in, stash[j], len[j]);
+			d->in_len = len[j];
+			continue;
+		}
+		drop_stale(dev, c, seq);
+	}
+
+	for (tries = 0; !reply_ok(c) && idempotent(c) && (tries < VFS_RETRIES); tries++) {
+		fprintf(stderr, "*********** Resending %s %04x\n", cmd_names[c->out[4]], c->seq);
+		dev->retried++;
+		if ((r = dev->tr->send(dev, c, c->out_len)) < 0)
+			return r;
+		r = dev->tr->recv(dev, c);
+		if (r < 0 && r != LIBUSB_ERROR_TIMEOUT)
+			return r;
+		while (!reply_ok(c) && (c->in_len > 0)) {
+			fprintf(stderr, "*********** Dropping stale reply %04x\n", xx(c->in[1], c->in[0]));
+			dev->stale++;
+			c->stale++;
+			if (dev->tr->drain(dev, c->in, &c->in_len) != 0)
+				c->in_len = 0;
+		}
+	}
+
+	return resync_err(c);
+}
+
+/* resync() for a non-blocking scan, which never has more than the one
+ * command c in flight, and must not hold up the host's event loop waiting
+ * for the reader. Call it each time a reply to c lands. Rather than drain
+ * and resend in one go, it listens for one more reply or sends c once
+ * more, and the scan calls it again when that lands. Returns 1 once c is
+ * settled one way or the other and recv() may retire it, 0 while it
+ * waits, or an error.
+ */
+static int resync_step (struct vfs_dev *dev, struct vfs_cmd *c)
+{
+	int r, listened = c->listening;
+
+	if (!c->ready) {
+		r = dev->tr->recv(dev, c);
+		if (r < 0 && r != LIBUSB_ERROR_TIMEOUT)
+			return r;
+		c->ready = 1;
+	}
+	c->listening = 0;
+	if (reply_ok(c))
+		return 1;
+
+	if (!listened && !c->drained && !c->resent) {
+		if (c->in_len >= 2)
+			fprintf(stderr, "*********** Seqnum mismatch, got %04x, expected %04x\n", xx(c->in[1],c->in[0]), c->seq);
+		else
+			fprintf(stderr, "*********** No reply, expected %04x\n", c->seq);
+	}
+	if (c->in_len >= 2)
+		drop_stale(dev, c, xx(c->in[1], c->in[0]));
+
+	/* a stale reply may have more queued behind it, and a missing one may
+	 * yet turn up late */
+	if (((c->in_len > 0) || !listened) && (c->drained < MAX_PIPE + 4)) {
+		c->drained++;
+		c->listening = 1;
+		c->ready = 0;
+		return dev->tr->listen(dev, c);
+	}
+
+	if (idempotent(c) && (c->resent < VFS_RETRIES)) {
+		fprintf(stderr, "*********** Resending %s %04x\n", cmd_names[c->out[4]], c->seq);
+		dev->retried++;
+		c->resent++;
+		c->ready = 0;
+		return dev->tr->send(dev, c, c->out_len);
+	}
+	return 1;
+}
+
+/* Retire the oldest command in flight. Returns as soon as its reply lands,
+ * leaving the reply in dev->buf and checking it against the results table.
+ * A missing or misplaced reply is recovered by resync() where possible.
+ */
+static int recv(struct vfs_dev *dev)
+{
+	struct vfs_cmd *c = &dev->cmd[dev->retired % MAX_PIPE];
+	struct rtt_stat *st;
+	long long rtt;
+	int r, err = 0;
+
+	if (dev->retired == dev->sent)
+		return 0;
+	dev->retired++;
+
+	if (!c->ready) {
+		r = dev->tr->recv(dev, c);
+		if (r < 0 && r != LIBUSB_ERROR_TIMEOUT)
+			return r;
+	}
+
+	/* a non-blocking scan has been through resync_step() already */
+	if (!reply_ok(c) && dev->async) {
+		err = resync_err(c);
+	} else if (!reply_ok(c)) {
+		if (c->in_len >= 2)
+			fprintf(stderr, "*********** Seqnum mismatch, got %04x, expected %04x\n", xx(c->in[1],c->in[0]), c->seq);
+		else
+			fprintf(stderr, "*********** No reply, expected %04x\n", c->seq);
+		if (dev->depth > 1) {
+			fprintf(stderr, "*********** Falling back to lockstep commands\n");
+			dev->depth = 1;
+		}
+		err = resync(dev, c);
+	}
+
+	rtt = now_us() - c->t_send;
+	dev->len = c->in_len;
+	memcpy(dev->buf, c->in, dev->len);
+
+	if (dev->trace)
+		trace_rec(dev, TR_RECV, rtt, dev->buf, dev->len);
+	else if (dev->log)
+		dump_buffer(dev->log, dev->buf, dev->len, "  <---");
+
+	st = &dev->rtt[c->out[4] % nitems(dev->rtt)];
+	if ((st->n == 0) || (rtt < st->min)) st->min = rtt;
+	if ((st->n == 0) || (rtt > st->max)) st->max = rtt;
+	st->sum += rtt;
+	st->n++;
+
+	/* the reader leaves some commands unanswered, and always has, so only
+	 * the ones that were resent are worth giving up on */
+	if ((err < 0) && !idempotent(c)) {
+		fprintf(stderr, "*********** Command %02x seq %04x: %s, carrying on\n", c->out[4], c->seq, vfs_strerror(err));
+		err = 0;
+	}
+	if (err < 0) {
+		fprintf(stderr, "*********** Command %02x seq %04x failed: %s\n", c->out[4], c->seq, vfs_strerror(err));
+		return err;
+	}
+
+	if (c->cmd_no >= 0)
+		res_check(dev, c->cmd_no);
+
+	return 0;
+}
+
+/* State of an asynchronous image load. Each transfer reads a full chunk
+ * straight into the scan ring at the next free line; since transfers on one
+ * endpoint complete in submission order, the data stays contiguous. The
+ * callbacks only move the ring's head on: the sinks are fed from
+ * usb_load_poll(), outside libusb, so a slow sink holds up neither libusb
+ * nor the transfers queued behind it, and until it has caught up the ring
+ * has no room for more and the transfers wait.
+ */
+struct load_ctx {
+	struct vfs_dev *dev;
+
+	/* line where the next submitted transfer will land */
+	unsigned long next;
+
+	/* transfers, and how many are currently owned by libusb */
+	struct libusb_transfer *xfer[MAX_XFERS];
+	int idle[MAX_XFERS];
+	int n;
+	int busy;
+
+	/* end of scan seen, first error, time of last completion */
+	int done;
+	int r;
+	long long last;
+
+	/* transfers still queued at the end have been cancelled */
+	int cancelled;
+};
+
+/* Queue a transfer at the next chunk of the ring. Returns 1 if the sinks
+ * have not yet consumed enough of the ring to make room for it. */
+static int load_submit (struct load_ctx *l, struct libusb_transfer *t)
+{
+	struct line_ring *ring = &l->dev->ring;
+	int r;
+
+	if (l->next + N_FRAMES > ring_room(ring))
+		return 1;
+
+	t->buffer = ring_line(ring, l->next);
+	t->length = N_FRAMES*FRAME_SIZE;
+	if ((r = libusb_submit_transfer(t)) < 0)
+		return r;
+
+	l->next += N_FRAMES;
+	l->busy++;
+	l->last = now_us();
+	return 0;
+}
+
+/* resubmit any transfers that were parked waiting for room in the ring */
+static void load_resubmit (struct load_ctx *l)
+{
+	int i, r;
+	for (i = 0; (i < l->n) && !l->done; i++) {
+		if (!l->idle[i])
+			continue;
+		if ((r = load_submit(l, l->xfer[i])) == 0) {
+			l->idle[i] = 0;
+		} else if (r < 0) {
+			fprintf(stderr, "bulk read submit error %d\n", r);
+			l->r = r;
+			l->done = 1;
+		}
+	}
+}
+
+static void load_cb (struct libusb_transfer *t)
+{
+	struct load_ctx *l = t->user_data;
+	struct line_ring *ring = &l->dev->ring;
+	int i;
+
+	l->busy--;
+	l->last = now_us();
+
+	/* after the end of scan, only keep data that lands right at the head
+	 * of the ring, e.g. a partial chunk from a transfer we just cancelled */
+	if (l->done) {
+		if (t->buffer == ring_line(ring, ring->head / FRAME_SIZE) + ring->head % FRAME_SIZE)
+			ring->head += t->actual_length;
+		return;
+	}
+
+	switch (t->status) {
+	case LIBUSB_TRANSFER_COMPLETED:
+	case LIBUSB_TRANSFER_CANCELLED:
+		ring->head += t->actual_length;
+		if (t->actual_length < t->length) {
+			l->done = 1;
+		} else {
+			for (i = 0; i < l->n; i++)
+				if (l->xfer[i] == t)
+					l->idle[i] = 1;
+		}
+		break;
+
+	case LIBUSB_TRANSFER_NO_DEVICE:
+		l->r = LIBUSB_ERROR_NO_DEVICE;
+		l->done = 1;
+		break;
+
+	default:
+		l->r = LIBUSB_ERROR_IO;
+		l->done = 1;
+		break;
+	}
+}
+
+/* Keep dev->nxfers transfers queued on EP 0x82 until the scan ends, so the
+ * sensor FIFO is always being drained, and feed the ring sinks each time
+ * usb_load_poll() runs. The scan ends as soon as the state 6 line of a swipe lands, on
+ * a short transfer, or when no data has arrived for BULK_TIMEOUT ms.
+ */
+static int usb_load_start (struct vfs_dev *dev)
+{
+	struct load_ctx *l;
+	int i;
+
+	ring_begin(dev);
+
+	l = calloc(1, sizeof(*l));
+	if (l == NULL) {
+		ring_end(dev);
+		return LIBUSB_ERROR_NO_MEM;
+	}
+	dev->load = l;
+	l->dev = dev;
+	l->last = now_us();
+	l->n = dev->nxfers;
+	if (l->n < 1) l->n = 1;
+	if (l->n > MAX_XFERS) l->n = MAX_XFERS;
+
+	for (i = 0; i < l->n; i++) {
+		l->xfer[i] = libusb_alloc_transfer(0);
+		if (l->xfer[i] == NULL) {
+			l->r = LIBUSB_ERROR_NO_MEM;
+			l->n = i;
+			break;
+		}
+		libusb_fill_bulk_transfer(l->xfer[i], dev->devh, EP_IN(2), NULL, 0, load_cb, l, 0);
+		l->idle[i] = 1;
+	}
+	load_resubmit(l);
+	if (l->busy == 0)
+		l->done = 1;
+	return 0;
+}
+
+static int usb_load_poll (struct vfs_dev *dev)
+{
+	struct load_ctx *l = dev->load;
+	int i, r;
+
+	if (l == NULL)
+		return 1;
+	if (!l->done && (now_us() - l->last > BULK_TIMEOUT * 1000))
+		l->done = 1;
+
+	/* feed the sinks whatever has landed, then requeue the transfers that
+	 * now have room to land in */
+	if (!l->done) {
+		ring_drain(dev);
+		if (dev->swipe_end)
+			l->done = 1;
+		else
+			load_resubmit(l);
+	}
+	if (!l->done)
+		return 0;
+
+	/* cancel whatever is still queued, and wait for it to come back: a
+	 * cancelled transfer still belongs to libusb until its callback has
+	 * run, even if the reader has gone (it then completes with NO_DEVICE) */
+	if (!l->cancelled) {
+		for (i = 0; i < l->n; i++)
+			if (!l->idle[i])
+				libusb_cancel_transfer(l->xfer[i]);
+		l->cancelled = 1;
+	}
+	if (l->busy > 0)
+		return 0;
+
+	for (i = 0; i < l->n; i++)
+		libusb_free_transfer(l->xfer[i]);
+
+	ring_end(dev);
+
+	r = l->r;
+	free(l);
+	dev->load = NULL;
+	return (r < 0) ? r : 1;
+}
+
+static int usb_ready (struct vfs_dev *dev, struct vfs_cmd *c)
+{
+	return c->out_done && c->in_done;
+}
+
+static int usb_events (struct vfs_dev *dev, struct timeval *tv)
+{
+	int r = libusb_handle_events_timeout_completed(dev->ctx, tv, NULL);
+	return (r == LIBUSB_ERROR_INTERRUPTED) ? 0 : r;
+}
+
+static const struct vfs_transport usb_transport =
+{
+	.name  = "usb",
+	.open  = usb_open,
+	.close = usb_close,
+	.send  = usb_send,
+	.recv  = usb_recv,
+	.drain = usb_drain,
+	.listen = usb_listen,
+	.ready = usb_ready,
+	.load_start = usb_load_start,
+	.load_poll  = usb_load_poll,
+	.events = usb_events,
+};
+
+/* keep count of scan throughput */
+static void load_stats (struct vfs_dev *dev, long long t)
+{
+	dev->scan.n++;
+	dev->scan.sum += now_us() - t;
+	dev->scan_lines += dev->ring.head / FRAME_SIZE;
+}
+
+/* service events until the load in progress is over */
+static int load_finish (struct vfs_dev *dev)
+{
+	struct timeval tv;
+	int r;
+
+	while ((r = dev->tr->load_poll(dev)) == 0) {
+		tv.tv_sec = 0;
+		tv.tv_usec = BULK_TIMEOUT * 1000 / 4;
+		dev->tr->events(dev, &tv);
+	}
+	return (r < 0) ? r : 0;
+}
+
+/* Stream one scan through the ring sinks, waiting until it is over */
+static int load (struct vfs_dev *dev)
+{
+	long long t = now_us();
+	int r;
+
+	if ((r = dev->tr->load_start(dev)) == 0)
+		r = load_finish(dev);
+
+	load_stats(dev, t);
+	return r;
+}
+
+/* Send a command. Outside a pipe_begin()/pipe_end() section this waits for
+ * the reply; inside one, it only waits for the oldest replies once dev->depth
+ * commands are in flight, so dev->buf is not valid until pipe_flush().
+ */
+static int swap (struct vfs_dev *dev, unsigned char *data, size_t len)
+{
+	int depth = dev->pipelined ? dev->depth : 1;
+	int r;
+
+	if (depth < 1) depth = 1;
+	if (depth > MAX_PIPE) depth = MAX_PIPE;
+
+	if ((r = send(dev, data, len)) < 0)
+		return r;
+
+	/* a scan in progress collects its own replies, see scan_step() */
+	if (dev->async)
+		return 0;
+
+	while (dev->sent - dev->retired >= depth)
+		if ((r = recv(dev)) < 0)
+			return r;
+	return 0;
+}
+
+/* Wait for every command in flight, returning the first error seen */
+static int pipe_flush (struct vfs_dev *dev)
+{
+	int r, err = 0;
+	if (dev->async)
+		return 0;
+	while (dev->sent != dev->retired)
+		if (((r = recv(dev)) < 0) && (err == 0))
+			err = r;
+	return err;
+}
+
+static void pipe_begin (struct vfs_dev *dev)
+{
+	dev->pipelined++;
+}
+
+static int pipe_end (struct vfs_dev *dev)
+{
+	if (--dev->pipelined > 0)
+		return 0;
+	return pipe_flush(dev);
+}
+
+
+/******************************************************************************************************
+ * Protocol-level API routines
+
+     01 - Reset
+     02 - GetVersion
+     03 - GetPrint
+     04 - GetParam
+     05 - SetParam
+     06 - GetConfig
+     07   DownloadPatch
+     08   GetRateData
+     09   IspRequest
+     0A   ProgramFlash
+     0B   EraseFlash
+     0C   LedStates
+     0D   LedEvent
+     0E - AbortPrint
+     0F   Spare2
+     10   Spare3
+     11   Spare4
+     12 - Peek
+     13 - Poke
+     14 - SensorSpiTrans
+     15   SensorGPIO
+     16 - GetFingerState 
+*/
+
+static __thread int _cmd_no = -1;
+#define _() if (!dev->trace && dev->log) fprintf(dev->log, "\n> %s (%d)\n", __FUNCTION__,_cmd_no); dev->cmd_no=_cmd_no; _cmd_no=-1
+
+#ifndef VFS101_LIBRARY
+/* Reset (00 00 01 00)
+ *
+ *  Cause the device to reenumerate on the USB bus.
+ */
+static int Reset (struct vfs_dev *dev)
+{
+	unsigned char q1[0x06] = { 0x00, 0x00, 0x00, 0x00, 0x01, 0x00 };
+	int r;
+	_();
+	if ((r = swap (dev, q1, 0x06)) < 0)
+		return r;
+	return pipe_flush (dev);
+}
+#endif
+
+/* GetVersion (00 00 01 00)
+ *
+ *  Retrieve version string from the device.
+ */
+static int GetVersion (struct vfs_dev *dev)
+{
+	unsigned char q1[0x07] = { 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00 };
+	_();
+	return swap (dev, q1, 0x07);
+}
+
+/* GetPrint (00 00 03 00)
+ *
+ *  Retrieve fingerprint image information.
+ */
+static unsigned char type_0[6] = "\x00\x01\x00\x00\x00\x01";
+static unsigned char type_1[6] = "\x01\x00\x00\x00\x01\x01";
+static unsigned char type_2[6] = "\x00\x00\x00\x00\x00\x01";
+static int GetPrint (struct vfs_dev *dev, int count, unsigned char args[6])
+{
+	unsigned char q1[0x0e] = { 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+	int i;
+	q1[6] = b0(count);
+	q1[7] = b1(count);
+	for (i=0; i<6; i++) q1[8+i] = args[i];
+	_();
+	return swap (dev, q1, 0x0e);
+}
+
+/* GetParam (00 00 04 00)
+ *
+ *  Retrieve a parameter value from the device.
+ */
+static int GetParam (struct vfs_dev *dev, unsigned short param)
+{
+	unsigned char q1[0x08] = { 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 };
+	q1[6] = b0(param);
+	q1[7] = b1(param);
+	_();
+	return swap (dev, q1, 0x08);
+}
+
+/* SetParam (00 00 05 00)
+ *
+ *  Set a parameter value on the device.
+ */
+static int SetParam (struct vfs_dev *dev, unsigned short param, unsigned short value)
+{
+	unsigned char q1[0x0a] = { 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00 };
+	q1[6] = b0(param);
+	q1[7] = b1(param);
+	q1[8] = b0(value);
+	q1[9] = b1(value);
+	_();
+	return swap (dev, q1, 0x0a);
+}
+
+struct set_param {
+	unsigned short param;
+	unsigned short value;
+};
+
+static int SetParamList (struct vfs_dev *dev, struct set_param *params, int nparams)
+{
+	int r = 0, e, i;
+	pipe_begin(dev);
+	for (i = 0; i < nparams; i++)
+		if ((r = SetParam(dev, params[i].param, params[i].value)) < 0)
+			break;
+	e = pipe_end(dev);
+	return (r < 0) ? r : e;
+}
+
+/* GetConfig (00 00 06 00)
+ *
+ *  Retrieve config info from the device.
+ */
+static int GetConfig (struct vfs_dev *dev)
+{
+	unsigned char q1[0x06] = { 0x00, 0x00, 0x00, 0x00, 0x06, 0x00 };
+	_();
+	return swap (dev, q1, 0x06);
+}
+
+/* AbortPrint (00 00 0e 00)
+ *
+ *  Abort the current scan operation.
+ */
+static int AbortPrint (struct vfs_dev *dev)
+{
+	unsigned char q1[0x06] = { 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00 };
+	_();
+	return swap (dev, q1, 0x06);
+}
+
+/* Peek (00 00 12 00)
+ *
+ *  Retrieve a value from the device.
+ */
+static int Peek (struct vfs_dev *dev, unsigned int addr, unsigned int size)
+{
+	unsigned char q1[0x0b] = { 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+	q1[6]  = b0(addr);
+	q1[7]  = b1(addr);
+	q1[8]  = b2(addr);
+	q1[9]  = b3(addr);
+	q1[10] = b0(size);
+	_();
+	return swap (dev, q1, 0x0b);
+}
+
+/* Poke (00 00 13 00)
+ *
+ *  Store a value to the device.
+ */
+static int Poke (struct vfs_dev *dev, unsigned int addr, unsigned int value, unsigned int size)
+{
+	unsigned char q1[0x0f] = { 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+	q1[6]  = b0(addr);
+	q1[7]  = b1(addr);
+	q1[8]  = b2(addr);
+	q1[9]  = b3(addr);
+	q1[10] = b0(value);
+	q1[11] = b1(value);
+	q1[12] = b2(value);
+	q1[13] = b3(value);
+	q1[14] = b0(size);
+	_();
+	return swap (dev, q1, 0x0f);
+}
+
+/* SensorSpiTrans (00 00 14 00)
+ *
+ *  ???
+ */
+static int SensorSpiTrans (struct vfs_dev *dev, unsigned char p1, unsigned char p2, unsigned char p3, unsigned char p4, unsigned char p5, unsigned char p6, unsigned char p7)
+{
+	unsigned char q1[0x0d] = { 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+	q1[6]  = p1;
+	q1[7]  = p2;
+	q1[8]  = p3;
+	q1[9]  = p4;
+	q1[10] = p5;
+	q1[11] = p6;
+	q1[12] = p7;
+	_();
+	return swap (dev, q1, 0x0d);
+}
+
+/* GetFingerState (00 00 16 00)
+ *
+ *  Poll device for current finger state.
+ */
+static int GetFingerState (struct vfs_dev *dev)
+{
+	unsigned char q1[0x06] = { 0x00, 0x00, 0x00, 0x00, 0x16, 0x00 };
+	int r;
+	_();
+	if ((r = swap (dev, q1, 0x06)) < 0)
+		return r;
+	if ((r = pipe_flush (dev)) < 0)
+		return r;
+	return dev->buf[0x0a];
+}
+
+/* Set up the ring sinks for the next scan */
+static void load_setup (struct vfs_dev *dev)
+{
+	ring_reset(&dev->ring);
+	dev->swipe = swipe_state;
+	ring_add(&dev->ring, &dev->swipe);
+	if (!dev->anonymous) {
+		if (dev->trace || dev->log) {
+			dev->dump.sink = dev->trace ? trace_image : dump_image;
+			ring_add(&dev->ring, &dev->dump.sink);
+		}
+		create_pnms(dev);
+	}
+	if (dev->collect)
+		ring_add(&dev->ring, dev->collect);
+}
+
+static int LoadImage (struct vfs_dev *dev)
+{
+	int r;
+	_();
+	if (dev->trace)
+		trace_rec(dev, TR_LOAD, dev->cmd_no, NULL, 0);
+	dev->cmd_no = -1;
+	if ((r = pipe_flush(dev)) < 0)
+		return r;
+	load_setup(dev);
+
+	/* a scan in progress polls the load itself, see scan_step() */
+	if (dev->async)
+		r = dev->tr->load_start(dev);
+	else
+		r = load(dev);
+	if (!dev->anonymous)
+		dev->inum++;
+	return r;
+}
+
+#undef _
+
+
+/******************************************************************************************************
+ * Parameters and registers
+ */
+
+static const unsigned int P_MESS_WITH_BC      = 0x000c;
+static const unsigned int P_THRESHOLD         = 0x0057;
+static const unsigned int P_STATE_3_COUNT     = 0x005e;
+static const unsigned int P_STATE_5_COUNT     = 0x005f;
+static const unsigned int P_INFO_LINE_RATE    = 0x0062;
+static const unsigned int P_INFO_CONTRAST     = 0x0077;
+
+static const unsigned int VFS_EXPOSURE        = 0x00ff500e;
+static const unsigned int VFS_DARKEN_CD_1     = 0x00ff502c;
+static const unsigned int VFS_DARKEN_CD_2     = 0x00ff502e;
+static const unsigned int VFS_IMAGE_ABCD      = 0x00ff5032;
+static const unsigned int VFS_CONTRAST        = 0x00ff5038;
+static const unsigned int VFS_GRATING         = 0x00ff503e;
+static const unsigned int VFS_KILL_4          = 0x00ff9802;
+
+// 0x2a 0x3c 0x41
+static int parm_read[] = 
+{
+	0x01, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x10,
+	0x11, 0x14, 0x15, 0x16, 0x17, 0x19, 0x1a, 0x1b,
+	0x1c, 0x1d, 0x1e, 0x28, 0x2c, 0x2e, 0x2f, 0x30,
+	0x31, 0x32, 0x33, 0x42, 0x44, 0x45, 0x46, 0x47,
+	0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+	0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+	0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+	0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+	0x68, 0x69, 0x6a, 0x6d, 0x6e, 0x6f, 0x70, 0x71,
+	0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+};
+
+// 0x04 0x05 0x06 0x07 0x12 0x18 0x1f 0x20
+// 0x21 0x22 0x23 0x24 0x2d 0x34 0x35 0x36
+// 0x37 0x38 0x39 0x3a 0x3b 0x3e 0x3f 0x40
+// 0x43
+static int parm_write[] = 
+{
+	0x01, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x10, 0x11,
+	0x15, 0x16, 0x17, 0x19, 0x1a, 0x1b, 0x1d, 0x1e,
+	0x2c, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x42, 0x44,
+	0x45, 0x46, 0x47, 0x48, 0x49, 0x4b, 0x4c, 0x4d,
+	0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55,
+	0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d,
+	0x5e, 0x5f, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65,
+	0x66, 0x67, 0x68, 0x69, 0x6a, 0x6d, 0x6e, 0x6f,
+	0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+	0x78,
+};
+
+
+/******************************************************************************************************
+ * Result checking framework.
+ */
+
+/* Result from a single API command when executed on Windows: its URB
+ * number, and where its bytes are in the table's blob */
+struct result {
+	unsigned short urb;
+	unsigned int off;
+	unsigned short len;
+};
+
+/* All results from a single UsbSnoop.log file, sorted by URB number */
+struct result_table {
+	int n;
+	const struct result *r;
+	const unsigned char *blob;
+};
+
+/* Look up the result for URB n, returning its length and pointing *data
+ * at it, or -1 if there is none */
+static int res_get (struct result_table *t, int n, const unsigned char **data)
+{
+	int lo = 0, hi, mid;
+
+	if ((t == NULL) || (n < 0))
+		return -1;
+	for (hi = t->n; lo < hi; ) {
+		mid = (lo + hi) / 2;
+		if (t->r[mid].urb < n)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if ((lo == t->n) || (t->r[lo].urb != n))
+		return -1;
+	*data = t->blob + t->r[lo].off;
+	return t->r[lo].len;
+}
+
+static void res_check (struct vfs_dev *dev, int n)
+{
+	const unsigned char *data;
+	int len = res_get(dev->results, n, &data);
+
+	if (len < 0) {
+		if (dev->trace)
+			trace_rec(dev, TR_CHECK, -1, NULL, 0);
+		else if (dev->log)
+			fprintf(dev->log, "  !!!! no result to check against! !!!!\n");
+
+	} else if ((len != dev->len - 4) || (memcmp(data, dev->buf+4, dev->len-4) != 0)) {
+		if (dev->trace)
+			trace_rec(dev, TR_CHECK, 0, data, len);
+		else if (dev->log)
+			dump_buffer(dev->log, data, len, "  XXXX            ");
+	}
+}
+
+
+#ifndef VFS101_LIBRARY
+
+/******************************************************************************************************
+ * Command scripts
+ *
+ * Captured sessions are no longer compiled in: Snoop2Api.pl -b writes them
+ * as scripts (see script.h), which are loaded when a cycle wants them and
+ * run op by op through the protocol API above.
+ */
+
+/* set by ^C or SIGTERM in the reader manager; every reader stops at the
+ * next command or touch poll */
+static volatile sig_atomic_t stopping = 0;
+
+struct script {
+	/* the whole file, and the replies recorded in it */
+	unsigned char *code;
+	long len;
+	struct result_table results;
+};
+
+static void script_free (struct script *s)
+{
+	if (s == NULL)
+		return;
+	free(s->code);
+	free((void *)s->results.r);
+	free(s);
+}
+
+/* Walk the ops once, checking that each fits in the file and that the
+ * recorded replies come in URB order, and return how many there are, or
+ * -1 if the script is malformed. */
+static int script_scan (unsigned char *p, unsigned char *end)
+{
+	int op, urb, last = -1, n = 0;
+
+	while (p < end) {
+		op = *p++;
+		if (op == SC_END)
+			return n;
+		if (op == SC_LOAD)
+			continue;
+		if (op == SC_RESULT) {
+			if ((end - p < 3) || (end - p < 3 + p[2]))
+				return -1;
+			urb = xx(p[1], p[0]);
+			if (urb <= last)
+				return -1;
+			last = urb;
+			n++;
+			p += 3 + p[2];
+		} else {
+			if ((op & ~SC_CHECK) >= nitems(sc_args) || (sc_args[op & ~SC_CHECK] < 0))
+				return -1;
+			if (op & SC_CHECK) {
+				if (end - p < 2)
+					return -1;
+				p += 2;
+			}
+			if (end - p < sc_args[op & ~SC_CHECK])
+				return -1;
+			p += sc_args[op & ~SC_CHECK];
+		}
+	}
+	return -1;
+}
+
+static struct script *script_load (const char *file)
+{
+	struct script *s;
+	struct result *r;
+	unsigned char *p;
+	FILE *f;
+	int n;
+
+	f = fopen(file, "rb");
+	if (f == NULL) {
+		fprintf(stderr, "Can't open script %s\n", file);
+		return NULL;
+	}
+	s = calloc(1, sizeof(*s));
+	if (s == NULL)
+		goto fail;
+	fseek(f, 0, SEEK_END);
+	s->len = ftell(f);
+	rewind(f);
+	s->code = malloc(s->len > 0 ? s->len : 1);
+	if ((s->code == NULL) || (fread(s->code, 1, s->len, f) != s->len))
+		goto fail;
+	fclose(f);
+	f = NULL;
+
+	if ((s->len < 8) || (memcmp(s->code, SCRIPT_MAGIC, 8) != 0)) {
+		fprintf(stderr, "%s is not a vfs101 script\n", file);
+		goto fail;
+	}
+	if ((n = script_scan(s->code + 8, s->code + s->len)) < 0) {
+		fprintf(stderr, "%s is malformed\n", file);
+		goto fail;
+	}
+
+	/* index the replies where they sit in the file */
+	r = malloc((n > 0 ? n : 1) * sizeof(*r));
+	if (r == NULL)
+		goto fail;
+	s->results.n = n;
+	s->results.r = r;
+	s->results.blob = s->code;
+	for (p = s->code + 8; *p != SC_END; ) {
+		if (*p == SC_LOAD) {
+			p++;
+		} else if (*p == SC_RESULT) {
+			r->urb = xx(p[2], p[1]);
+			r->off = p + 4 - s->code;
+			r->len = p[3];
+			r++;
+			p += 4 + p[3];
+		} else {
+			p += 1 + ((*p & SC_CHECK) ? 2 : 0) + sc_args[*p & ~SC_CHECK];
+		}
+	}
+	return s;
+
+fail:
+	if (f != NULL)
+		fclose(f);
+	script_free(s);
+	return NULL;
+}
+
+static inline unsigned int le32 (unsigned char *a)
+{
+	return a[0] | a[1]<<8 | a[2]<<16 | a[3]<<24;
+}
+
+/* send one command from a script */
+static int script_cmd (struct vfs_dev *dev, int cmd, unsigned char *a)
+{
+	switch (cmd) {
+	case 0x01: return Reset (dev);
+	case 0x02: return GetVersion (dev);
+	case 0x03: return GetPrint (dev, xx(a[1], a[0]), a + 2);
+	case 0x04: return GetParam (dev, xx(a[1], a[0]));
+	case 0x05: return SetParam (dev, xx(a[1], a[0]), xx(a[3], a[2]));
+	case 0x06: return GetConfig (dev);
+	case 0x0e: return AbortPrint (dev);
+	case 0x12: return Peek (dev, le32(a), a[4]);
+	case 0x13: return Poke (dev, le32(a), le32(a + 4), a[8]);
+	case 0x14: return SensorSpiTrans (dev, a[0], a[1], a[2], a[3], a[4], a[5], a[6]);
+	case 0x16: return GetFingerState (dev);
+	}
+	return VFS_ERR_SCRIPT;
+}
+
+/* Run a script, checking replies against it if asked. Commands are
+ * pipelined up to dev->depth, as during init; only errors, ^C or the
+ * reader leaving stop it. */
+static int script_run (struct vfs_dev *dev, struct script *s, int checked)
+{
+	unsigned char *p = s->code + 8;
+	int op, r = 0, e;
+
+	if (checked)
+		dev->results = &s->results;
+	pipe_begin(dev);
+	while ((r >= 0) && ((op = *p++) != SC_END)) {
+		if (stopping || dev->stop) {
+			r = VFS_ERR_STOPPED;
+		} else if (op == SC_LOAD) {
+			r = LoadImage(dev);
+		} else if (op == SC_RESULT) {
+			p += 3 + p[2];
+		} else {
+			if (op & SC_CHECK) {
+				if (checked)
+					_cmd_no = xx(p[1], p[0]);
+				p += 2;
+			}
+			r = script_cmd(dev, op & ~SC_CHECK, p);
+			p += sc_args[op & ~SC_CHECK];
+		}
+	}
+	e = pipe_end(dev);
+	dev->results = NULL;
+	return (r < 0) ? r : (e < 0) ? e : 0;
+}
+
+#endif
+
+
+/******************************************************************************************************
+ * Simulated reader
+ *
+ * A model of the VFS101 good enough to drive every cycle without hardware:
+ * it keeps the parameters and registers the host sets, answers commands the
+ * way the logs show the real reader doing, and produces scans with info lines
+ * and the finger detection state machine bytes filled in. Replies land at
+ * once, so it runs the parsing and sink pipeline as fast as the host can go.
+ *
+ * The replay backend is the same model, except that commands checked against
+ * a results table get the reply recorded in that table.
+ */
+
+#define SIM_REGS 64
+#define SIM_QUEUE (MAX_PIPE + 4)
+
+/* lines of finger contact in a simulated swipe, and polls before the touch */
+static const int SIM_SWIPE = 400;
+static const int SIM_TOUCH = 3;
+
+struct vfs_sim {
+	/* parameters and registers as last set by the host */
+	unsigned short param[0x80];
+	unsigned int reg_addr[SIM_REGS];
+	unsigned int reg_value[SIM_REGS];
+	int nregs;
+
+	/* length of a swipe armed by GetPrint, and GetFingerState polls since */
+	int armed;
+	int polls;
+
+	/* lines left in the pending scan, and the line number within it */
+	int left;
+	int line;
+	int swipe;
+
+	/* sequence numbers of image and info lines */
+	unsigned short iseq;
+	unsigned short nseq;
+
+	/* replies waiting on EP 0x81, and commands seen so far */
+	unsigned char queue[SIM_QUEUE][0x40];
+	int queue_len[SIM_QUEUE];
+	int first;
+	int queued;
+	int sent;
+};
+
+static const unsigned char sim_version[40] = "VFS ver 3.72D vc3-sys.r";
+
+static const unsigned char sim_config[30] =
+	"\x00\x00\x08\x00\x0a\x0a\x11\x11\xe6\xdd\xe6\xe5\xf0\xee\xf0\xef"
+	"\x03\x00\x31\x00\x20\x00\x12\x00\x14\x00\xff\xff\x85\x00";
+
+static unsigned int *sim_reg (struct vfs_sim *s, unsigned int addr)
+{
+	int i;
+	for (i = 0; i < s->nregs; i++)
+		if (s->reg_addr[i] == addr)
+			return &s->reg_value[i];
+	if (s->nregs == SIM_REGS)
+		return NULL;
+	s->reg_addr[s->nregs] = addr;
+	s->reg_value[s->nregs] = 0;
+	return &s->reg_value[s->nregs++];
+}
+
+static int sim_writable (int param)
+{
+	int i;
+	for (i = 0; i < nitems(parm_write); i++)
+		if (parm_write[i] == param)
+			return 1;
+	return 0;
+}
+
+/* Arm a scan of count lines. A type_1 scan waits for a finger, and ends
+ * with a state 6 line once the finger is lifted. */
+static void sim_print (struct vfs_sim *s, int count, unsigned char *args)
+{
+	int n = SIM_SWIPE + s->param[P_STATE_5_COUNT] + 1;
+
+	s->line = 0;
+	s->polls = 0;
+	s->swipe = (args[0] == 0x01);
+	if (s->swipe) {
+		s->armed = (count < n) ? count : n;
+		s->left = 0;
+	} else {
+		s->armed = 0;
+		s->left = count;
+	}
+}
+
+/* Build the reply to one command: seq, 00 00, command, status, data */
+static int sim_reply (struct vfs_dev *dev, struct vfs_cmd *c, unsigned char *a)
+{
+	struct vfs_sim *s = dev->sim;
+	unsigned char *q = c->out;
+	unsigned int *reg, v, mask;
+	int n = 8;
+
+	memset(a, 0, sizeof(c->in));
+	a[0] = q[0];
+	a[1] = q[1];
+	a[4] = q[4];
+	a[5] = q[5];
+
+	switch (xx(q[5], q[4])) {
+	case 0x02: /* GetVersion */
+		memcpy(a + 8, sim_version, sizeof(sim_version));
+		n += sizeof(sim_version);
+		break;
+
+	case 0x03: /* GetPrint */
+		sim_print(s, xx(q[7], q[6]), q + 8);
+		break;
+
+	case 0x04: /* GetParam */
+		v = s->param[q[6] % nitems(s->param)];
+		a[8] = b0(v);
+		a[9] = b1(v);
+		n += 2;
+		break;
+
+	case 0x05: /* SetParam, refused for read-only parameters */
+		if (sim_writable(xx(q[7], q[6])))
+			s->param[q[6] % nitems(s->param)] = xx(q[9], q[8]);
+		else
+			a[6] = 0x03;
+		a[8] = q[8];
+		a[9] = q[9];
+		n += 2;
+		break;
+
+	case 0x06: /* GetConfig */
+		memcpy(a + 8, sim_config, sizeof(sim_config));
+		n += sizeof(sim_config);
+		break;
+
+	case 0x0e: /* AbortPrint */
+		s->armed = 0;
+		s->left = 0;
+		break;
+
+	case 0x12: /* Peek */
+		reg = sim_reg(s, q[6] | q[7]<<8 | q[8]<<16 | q[9]<<24);
+		v = reg ? *reg : 0;
+		a[8] = b0(v);
+		a[9] = b1(v);
+		a[10] = b2(v);
+		a[11] = b3(v);
+		n += 4;
+		break;
+
+	case 0x13: /* Poke */
+		mask = (q[14] >= 4) ? 0xffffffff : (1u << (8 * q[14])) - 1;
+		reg = sim_reg(s, q[6] | q[7]<<8 | q[8]<<16 | q[9]<<24);
+		if (reg)
+			*reg = (*reg & ~mask) | ((q[10] | q[11]<<8 | q[12]<<16 | q[13]<<24) & mask);
+		break;
+
+	case 0x14: /* SensorSpiTrans */
+		n += 5;
+		break;
+
+	case 0x16: /* GetFingerState, touched a few polls after a swipe is armed */
+		a[8] = 0xff;
+		a[9] = 0xff;
+		if (s->armed && (++s->polls >= SIM_TOUCH)) {
+			s->left = s->armed;
+			s->armed = 0;
+		}
+		a[10] = (s->swipe && (s->left > 0)) ? 0x02 : 0x01;
+		n += 3;
+		break;
+	}
+
+	return n;
+}
+
+/* Queue a reply on the simulated EP 0x81. With faults=N, every Nth one
+ * goes wrong: alternately it is held back until after its command has
+ * timed out, so it shows up as a stale reply in front of the next one, or
+ * it is lost altogether. */
+static int sim_queue (struct vfs_dev *dev, struct vfs_cmd *c, unsigned char *a, int n)
+{
+	struct vfs_sim *s = dev->sim;
+	int i;
+
+	if (s->queued == SIM_QUEUE) {
+		fprintf(stderr, "simulated reply queue overflow\n");
+		return LIBUSB_ERROR_OVERFLOW;
+	}
+
+	if ((dev->faults > 0) && (++s->sent % dev->faults == 0)) {
+		c->late = 1;
+		if ((s->sent / dev->faults) % 2 == 0)
+			return 0;
+	}
+
+	i = (s->first + s->queued++) % SIM_QUEUE;
+	memcpy(s->queue[i], a, n);
+	s->queue_len[i] = n;
+	return 0;
+}
+
+static int sim_send (struct vfs_dev *dev, struct vfs_cmd *c, int len)
+{
+	unsigned char a[0x40];
+	return sim_queue(dev, c, a, sim_reply(dev, c, a));
+}
+
+static int sim_drain (struct vfs_dev *dev, unsigned char *buf, int *len)
+{
+	struct vfs_sim *s = dev->sim;
+
+	*len = 0;
+	if (s->queued == 0)
+		return LIBUSB_ERROR_TIMEOUT;
+	*len = s->queue_len[s->first];
+	memcpy(buf, s->queue[s->first], *len);
+	s->first = (s->first + 1) % SIM_QUEUE;
+	s->queued--;
+	return 0;
+}
+
+static int sim_recv (struct vfs_dev *dev, struct vfs_cmd *c)
+{
+	if (c->late) {
+		c->late = 0;
+		c->in_len = 0;
+		return LIBUSB_ERROR_TIMEOUT;
+	}
+	return sim_drain(dev, c->in, &c->in_len);
+}
+
+/* the next reply is queued already, if there is one */
+static int sim_listen (struct vfs_dev *dev, struct vfs_cmd *c)
+{
+	c->late = 0;
+	return 0;
+}
+
+/* Fill in one scan line. A swipe goes through states 2 and 3 while the
+ * finger settles, stays in 5 while it is down, counts down once it lifts,
+ * and ends on a single line in state 6.
+ */
+static void sim_line (struct vfs_sim *s, unsigned char *d)
+{
+	int rate = s->param[P_INFO_LINE_RATE];
+	int n3 = s->param[P_STATE_3_COUNT];
+	int n5 = s->param[P_STATE_5_COUNT];
+	int y = s->line++;
+	int state = 2, next = 3, count = 0, level = 0xffff;
+	int x, finger;
+	unsigned short seq;
+
+	if (s->swipe) {
+		if (y < 32) {
+			count = 32 - y;
+		} else if (y < 32 + n3) {
+			state = 3, next = 5, count = 32 + n3 - y, level = 0x0100;
+		} else if (y < SIM_SWIPE) {
+			state = 5, next = 5, count = n5, level = 0x0100;
+		} else if (y < SIM_SWIPE + n5) {
+			state = 5, next = 6, count = SIM_SWIPE + n5 - y;
+		} else {
+			state = 6, next = 0, count = 0;
+		}
+	}
+	finger = (state == 3) || ((state == 5) && (next == 5));
+
+	memset(d, 0, FRAME_SIZE);
+	d[0] = 0x01;
+	if ((rate > 0) && (y % rate == rate - 1)) {
+		/* info lines count up by 6, big endian, with no second copy */
+		d[1] = 0x01;
+		seq = s->nseq;
+		s->nseq += 6;
+		d[2] = b1(seq);
+		d[3] = b0(seq);
+		d[270] = 0x09; d[271] = 0x03; d[272] = 0x8c;
+	} else {
+		d[1] = 0xfe;
+		seq = s->iseq++;
+		d[2] = b0(seq);
+		d[3] = b1(seq);
+		d[270] = 0x14; d[271] = 0x03; d[272] = 0x6f;
+		d[274] = b1(seq);
+		d[275] = b0(seq);
+		d[276] = state;
+		d[277] = next;
+		d[278] = b0(count);
+		d[279] = b1(count);
+		d[280] = b0(level);
+		d[281] = b1(level);
+	}
+	d[282] = 0x02;
+
+	/* slanted ridges under the finger, bright background elsewhere */
+	for (x = 0; x < 200; x++)
+		d[6 + x] = finger ? 0x40 + ((((x * 7) + (y * 3) + ((x * x) >> 6)) >> 2) & 0x0f) * 8 : 0xf0;
+	for (x = 0; x < 64; x++)
+		d[206 + x] = d[6 + x * 3];
+}
+
+static int sim_load_start (struct vfs_dev *dev)
+{
+	struct vfs_sim *s = dev->sim;
+	struct line_ring *ring = &dev->ring;
+	unsigned long n;
+	int i;
+
+	ring_begin(dev);
+	while ((s->left > 0) && !dev->swipe_end) {
+		n = ring->head / FRAME_SIZE;
+		for (i = 0; (i < N_FRAMES) && (s->left > 0); i++, s->left--)
+			sim_line(s, ring_line(ring, n + i));
+		ring->head += i * FRAME_SIZE;
+		ring_drain(dev);
+	}
+	ring_end(dev);
+	return 0;
+}
+
+/* the whole scan is produced by sim_load_start() */
+static int sim_load_poll (struct vfs_dev *dev)
+{
+	return 1;
+}
+
+/* replies are queued as soon as their commands are sent */
+static int sim_ready (struct vfs_dev *dev, struct vfs_cmd *c)
+{
+	return 1;
+}
+
+/* replies are queued as soon as commands are sent, so nothing is pending */
+static int sim_events (struct vfs_dev *dev, struct timeval *tv)
+{
+	return 0;
+}
+
+static int sim_open (struct vfs_dev *dev)
+{
+	struct vfs_sim *s = calloc(1, sizeof(*s));
+	if (s == NULL) {
+		fprintf(stderr, "Out of memory for simulated reader\n");
+		return LIBUSB_ERROR_NO_MEM;
+	}
+	s->param[0x11] = 0x0008;
+	s->param[0x14] = 0x0014;
+	s->param[P_STATE_3_COUNT] = 0x0008;
+	s->param[P_STATE_5_COUNT] = 0x0010;
+	s->param[P_INFO_LINE_RATE] = 0x0032;
+	dev->sim = s;
+	dev->state = 4;
+	return 0;
+}
+
+static void sim_close (struct vfs_dev *dev)
+{
+	free(dev->sim);
+	dev->sim = NULL;
+	dev->state = 0;
+}
+
+static const struct vfs_transport sim_transport =
+{
+	.name  = "sim",
+	.open  = sim_open,
+	.close = sim_close,
+	.send  = sim_send,
+	.recv  = sim_recv,
+	.drain = sim_drain,
+	.listen = sim_listen,
+	.ready = sim_ready,
+	.load_start = sim_load_start,
+	.load_poll  = sim_load_poll,
+	.events = sim_events,
+};
+
+/* Keep the model up to date, but answer with the recorded reply if any */
+static int replay_send (struct vfs_dev *dev, struct vfs_cmd *c, int len)
+{
+	const unsigned char *data;
+	unsigned char a[0x40];
+	int n, m = res_get(dev->results, c->cmd_no, &data);
+
+	n = sim_reply(dev, c, a);
+	if ((m >= 0) && (m + 4 <= sizeof(a))) {
+		memcpy(a + 4, data, m);
+		n = m + 4;
+	}
+	return sim_queue(dev, c, a, n);
+}
+
+static const struct vfs_transport replay_transport =
+{
+	.name  = "replay",
+	.open  = sim_open,
+	.close = sim_close,
+	.send  = replay_send,
+	.recv  = sim_recv,
+	.drain = sim_drain,
+	.listen = sim_listen,
+	.ready = sim_ready,
+	.load_start = sim_load_start,
+	.load_poll  = sim_load_poll,
+	.events = sim_events,
+};
+
+static const struct vfs_transport *transports[] = {
+	&usb_transport,
+	&sim_transport,
+	&replay_transport,
+};
+
+/* look up a backend by name */
+static const struct vfs_transport *transport (const char *name)
+{
+	int i;
+	for (i = 0; i < nitems(transports); i++)
+		if (strcmp(transports[i]->name, name) == 0)
+			return transports[i];
+	return NULL;
+}
+
+
+#ifndef VFS101_LIBRARY
+
+/******************************************************************************************************
+ * raw terminal support
+ */
+#include <termios.h> 
+ 
+static void raw (void) 
+{ 
+	struct termios tio; 
+	tcgetattr( 0, &tio ); 
+	tio.c_lflag &= ~ICANON; 
+	tio.c_cc[VMIN] = 0;
+	tio.c_cc[VTIME] = 1;
+	tcsetattr( 0, TCSANOW, &tio ); 
+} 
+ 
+static void noraw (void) 
+{ 
+	struct termios tio; 
+	tcgetattr( 0, &tio ); 
+	tio.c_lflag |= ICANON; 
+	tcsetattr( 0, TCSANOW, &tio ); 
+} 
+ 
+static int getch (void)
+{
+	char c;
+	int n;
+	n = read(0, &c, 1);
+	return (n<0) ? n : (n==0) ? 0 : c;
+}
+
+#endif
+
+
+/******************************************************************************************************
+ * Cycle routines
+ *
+ * Each routine is a particular testcase, selectable from the command line.
+ */
+
+/* A shorthand for checking return codes */
+static __thread int r;
+#define _(x) if ((r = x) != 0) return r
+#define __(n, x) _cmd_no=n; if ((r = x) != 0) return r
+#define ___(x) if ((r = x) != 0) printf("Error %d\n", r)
+
+#ifndef VFS101_LIBRARY
+
+/* Reset the scanner device */
+static int reset (struct vfs_dev *dev)
+{
+	_(  Reset (dev));
+	return 0;	
+}
+
+/* Exercise the gain register */
+static int test (struct vfs_dev *dev)
 {
-	unsigned char q1[0x06] = { 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00 };
-	_();
-	return swap (dev, q1, 0x06);
+	int done = 0;
+	int x = 0x00ff8000;
+	int w = 1;
+	raw();
+	while (!done) {
+		int n = getch();
+		if (n < 0)
+			break;
+		switch (n) {
+		case 27: done = 1; break;
+		case '\\': dev_open(dev); break;
+
+		case '1': w = 1; break;
+		case '2': w = 2; break;
+		case '4': w = 4; break;
+
+		case 'q': x += w; break;
+		case 'a': x -= w; break;
+
+		case 'w': x += 0x10; break;
+		case 's': x -= 0x10; break;
+
+		case 'e': x += 0x100; break;
+		case 'd': x -= 0x100; break;
+
+		case 'r': x += 0x1000; break;
+		case 'f': x -= 0x1000; break;
+
+		case 't': x += 0x10000; break;
+		case 'g': x -= 0x10000; break;
+
+		case 'y': x += 0x100000; break;
+		case 'h': x -= 0x100000; break;
+
+		case 'u': x += 0x1000000; break;
+		case 'j': x -= 0x1000000; break;
+
+		case 'i': x += 0x10000000; break;
+		case 'k': x -= 0x10000000; break;
+
+		}
+		___(  Peek (dev, x, w));
+		//usleep(50000);
+	}
+	noraw();
+	return 0;	
 }
 
-/* Peek (00 00 12 00)
- *
- *  Retrieve a value from the device.
- */
-static int Peek (struct vfs_dev *dev, unsigned int addr, unsigned int size)
+/* Wait for a finger touch */
+static int wait_for_touch (struct vfs_dev *dev)
 {
-	unsigned char q1[0x0b] = { 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
-	q1[6]  = b0(addr);
-	q1[7]  = b1(addr);
-	q1[8]  = b2(addr);
-	q1[9]  = b3(addr);
-	q1[10] = b0(size);
-	_();
-	return swap (dev, q1, 0x0b);
+	int r;
+	while ((r = GetFingerState(dev)) != 2) {
+		if (r < 0)
+			return r;
+		if (stopping || dev->stop)
+			return VFS_ERR_STOPPED;
+		usleep(50000);
+	}
+	return 0;
 }
 
-/* Poke (00 00 13 00)
- *
- *  Store a value to the device.
- */
-static int Poke (struct vfs_dev *dev, unsigned int addr, unsigned int value, unsigned int size)
+#endif
+
+/* Try a contrast register setting */
+static int try_contrast (struct vfs_dev *dev, int value)
 {
-	unsigned char q1[0x0f] = { 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
-	q1[6]  = b0(addr);
-	q1[7]  = b1(addr);
-	q1[8]  = b2(addr);
-	q1[9]  = b3(addr);
-	q1[10] = b0(value);
-	q1[11] = b1(value);
-	q1[12] = b2(value);
-	q1[13] = b3(value);
-	q1[14] = b0(size);
-	_();
-	return swap (dev, q1, 0x0f);
+	_(  Poke (dev, VFS_CONTRAST, value, 0x01));
+	_(  GetPrint (dev, 0x000a, type_0));
+	_(  LoadImage (dev));
+	// evaluate the result...
+	dev->best_contrast = value;
+	return 0;
 }
 
-/* SensorSpiTrans (00 00 14 00)
- *
- *  ???
+/* Find the best contrast setting */
+static int scan_contrast (struct vfs_dev *dev)
+{
+	dev->best_contrast = 0x00;
+	_(  try_contrast (dev, 0x0e));
+	_(  try_contrast (dev, 0x0d));
+	_(  try_contrast (dev, 0x0c));
+	_(  try_contrast (dev, 0x0b));
+	_(  try_contrast (dev, 0x0a));
+	_(  try_contrast (dev, 0x09));
+	return 0;
+}
+
+/* Registers read back to fingerprint the configured state of the reader.
+ * S0 pokes the 0x1fec-0x1ffc block to values a cold reader does not have,
+ * and S1 leaves known values in the image registers and parameters. The
+ * contrast register is left out: try_contrast() changes it at run time.
  */
-static int SensorSpiTrans (struct vfs_dev *dev, unsigned char p1, unsigned char p2, unsigned char p3, unsigned char p4, unsigned char p5, unsigned char p6, unsigned char p7)
+static const unsigned int warm_peek[][2] =
 {
-	unsigned char q1[0x0d] = { 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
-	q1[6]  = p1;
-	q1[7]  = p2;
-	q1[8]  = p3;
-	q1[9]  = p4;
-	q1[10] = p5;
-	q1[11] = p6;
-	q1[12] = p7;
-	_();
-	return swap (dev, q1, 0x0d);
+	{ 0x00001fe8, 0x04 },
+	{ 0x00001fec, 0x04 },
+	{ 0x00001ff0, 0x04 },
+	{ 0x00001ff4, 0x04 },
+	{ 0x00001ff8, 0x04 },
+	{ 0x00001ffc, 0x04 },
+	{ VFS_EXPOSURE,   0x02 },
+	{ VFS_IMAGE_ABCD, 0x01 },
+};
+
+static const unsigned short warm_param[] =
+{
+	0x0011, P_MESS_WITH_BC, P_THRESHOLD, P_INFO_LINE_RATE, P_INFO_CONTRAST,
+};
+
+/* Read the fingerprint registers, collecting the reply payloads in fp */
+static int warm_fingerprint (struct vfs_dev *dev, unsigned char *fp, int max)
+{
+	int i, n = 0;
+
+	for (i = 0; i < nitems(warm_peek) + nitems(warm_param); i++) {
+		if (i < nitems(warm_peek)) {
+			_(  Peek (dev, warm_peek[i][0], warm_peek[i][1]));
+		} else {
+			_(  GetParam (dev, warm_param[i - nitems(warm_peek)]));
+		}
+		if ((dev->len < 4) || (n + dev->len - 4 > max))
+			return VFS_ERR_PROTO;
+		memcpy(fp + n, dev->buf + 4, dev->len - 4);
+		n += dev->len - 4;
+	}
+	return n;
 }
 
-/* GetFingerState (00 00 16 00)
- *
- *  Poll device for current finger state.
+/* Where the fingerprint of a reader is kept between runs, whichever folder
+ * proto runs from: $XDG_STATE_HOME/vfs101, or ~/.local/state/vfs101, in a
+ * file named after the bus and hub ports the reader is plugged into, so
+ * that it follows the reader and not the order readers were found in.
+ * Returns -1 if there is nowhere to keep it.
  */
-static int GetFingerState (struct vfs_dev *dev)
+static int warm_name (struct vfs_dev *dev, char *name, int size)
 {
-	unsigned char q1[0x06] = { 0x00, 0x00, 0x00, 0x00, 0x16, 0x00 };
-	int r;
-	_();
-	if ((r = swap (dev, q1, 0x06)) < 0)
-		return r;
-	return dev->buf[0x0a];
+	const char *state = getenv("XDG_STATE_HOME");
+	const char *home = getenv("HOME");
+	libusb_device *udev;
+	unsigned char port[8];
+	int i, n, k;
+
+	if ((state != NULL) && (state[0] == '/')) {
+		k = snprintf(name, size, "%s/vfs101", state);
+	} else if (home != NULL) {
+		snprintf(name, size, "%s/.local", home);
+		mkdir(name, 0700);
+		snprintf(name, size, "%s/.local/state", home);
+		mkdir(name, 0700);
+		k = snprintf(name, size, "%s/.local/state/vfs101", home);
+	} else {
+		return -1;
+	}
+	if (k >= size)
+		return -1;
+	mkdir(name, 0700);
+
+	if (dev->devh == NULL) {
+		k += snprintf(name + k, size - k, "/warm-%s", dev->tr->name);
+	} else {
+		udev = libusb_get_device(dev->devh);
+		n = libusb_get_port_numbers(udev, port, sizeof(port));
+		k += snprintf(name + k, size - k, "/warm-%d", libusb_get_bus_number(udev));
+		for (i = 0; (i < n) && (k < size); i++)
+			k += snprintf(name + k, size - k, "%c%d", i ? '.' : '-', port[i]);
+	}
+	return (k < size) ? 0 : -1;
 }
 
-static int LoadImage (struct vfs_dev *dev)
+/* Remember the fingerprint of a reader that has just been fully initialised */
+static void warm_save (struct vfs_dev *dev)
 {
-	int r;
-	_();
-	r = load(dev, dev->ibuf, &dev->ilen);
-	if ((r == 0) && (!dev->anonymous)) {
-		dump_image(dev);
-		create_pnms(dev);
+	unsigned char fp[0x200];
+	char name[512];
+	FILE *f;
+	int n;
+
+	if (!dev->warm)
+		return;
+	if ((n = warm_fingerprint(dev, fp, sizeof(fp))) < 0)
+		return;
+
+	if (warm_name(dev, name, sizeof(name)) < 0) {
+		fprintf(stderr, "Nowhere to keep the warm start state, set HOME\n");
+		return;
 	}
-	return r;
+	if ((f = fopen(name, "wb")) == NULL) {
+		fprintf(stderr, "Can't open \"%s\" for writing", name);
+		return;
+	}
+	fwrite(fp, 1, n, f);
+	fclose(f);
 }
 
-#undef _
+/* Is the reader still configured the way the last full init left it? */
+static int warm_check (struct vfs_dev *dev)
+{
+	unsigned char fp[0x200], old[0x200];
+	char name[512];
+	FILE *f;
+	int n, m;
 
+	if (!dev->warm)
+		return 0;
 
-/******************************************************************************************************
- * Parameters and registers
- */
+	if ((warm_name(dev, name, sizeof(name)) < 0) || ((f = fopen(name, "rb")) == NULL))
+		return 0;
+	m = fread(old, 1, sizeof(old), f);
+	fclose(f);
 
-const unsigned int P_MESS_WITH_BC      = 0x000c;
-const unsigned int P_THRESHOLD         = 0x0057;
-const unsigned int P_STATE_3_COUNT     = 0x005e;
-const unsigned int P_STATE_5_COUNT     = 0x005f;
-const unsigned int P_INFO_LINE_RATE    = 0x0062;
-const unsigned int P_INFO_CONTRAST     = 0x0077;
-
-const unsigned int VFS_EXPOSURE        = 0x00ff500e;
-const unsigned int VFS_DARKEN_CD_1     = 0x00ff502c;
-const unsigned int VFS_DARKEN_CD_2     = 0x00ff502e;
-const unsigned int VFS_IMAGE_ABCD      = 0x00ff5032;
-const unsigned int VFS_CONTRAST        = 0x00ff5038;
-const unsigned int VFS_GRATING         = 0x00ff503e;
-const unsigned int VFS_KILL_4          = 0x00ff9802;
+	if ((n = warm_fingerprint(dev, fp, sizeof(fp))) < 0)
+		return 0;
 
-// 0x2a 0x3c 0x41
-static int parm_read[] = 
+	return (n == m) && (memcmp(fp, old, n) == 0);
+}
+
+/* Stop whatever scan is pending and arm the reader for a swipe, as the
+ * tail of S1 does */
+static int warm_rearm (struct vfs_dev *dev)
 {
-	0x01, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x10,
-	0x11, 0x14, 0x15, 0x16, 0x17, 0x19, 0x1a, 0x1b,
-	0x1c, 0x1d, 0x1e, 0x28, 0x2c, 0x2e, 0x2f, 0x30,
-	0x31, 0x32, 0x33, 0x42, 0x44, 0x45, 0x46, 0x47,
-	0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
-	0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
-	0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
-	0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
-	0x68, 0x69, 0x6a, 0x6d, 0x6e, 0x6f, 0x70, 0x71,
-	0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
-};
+	_(  AbortPrint (dev));
+	_(  LoadImage (dev));
+	_(  SetParam (dev, P_INFO_LINE_RATE, dev->info_line_rate));
+	_(  GetPrint (dev, 0x1388, type_1));
+	return 0;
+}
 
-// 0x04 0x05 0x06 0x07 0x12 0x18 0x1f 0x20
-// 0x21 0x22 0x23 0x24 0x2d 0x34 0x35 0x36
-// 0x37 0x38 0x39 0x3a 0x3b 0x3e 0x3f 0x40
-// 0x43
-static int parm_write[] = 
+/* first working version */
+#include "state0.h"
+#include "state1.h"
+#ifndef VFS101_LIBRARY
+#include "state2.h"
+#endif
+/* Configure the reader and arm it for a swipe: all of S0 and S1, or just
+ * the rearm when it is still configured */
+static int reader_init (struct vfs_dev *dev)
 {
-	0x01, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x10, 0x11,
-	0x15, 0x16, 0x17, 0x19, 0x1a, 0x1b, 0x1d, 0x1e,
-	0x2c, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x42, 0x44,
-	0x45, 0x46, 0x47, 0x48, 0x49, 0x4b, 0x4c, 0x4d,
-	0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55,
-	0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d,
-	0x5e, 0x5f, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65,
-	0x66, 0x67, 0x68, 0x69, 0x6a, 0x6d, 0x6e, 0x6f,
-	0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
-	0x78,
-};
+	int e;
+
+	if (warm_check(dev)) {
+		if (dev->log)
+			fprintf(dev->log, "\n*** Reader already configured, skipping init\n");
+		_(  warm_rearm (dev));
+		return 0;
+	}
+
+	/* a failed init is not worth remembering, or swiping on */
+	pipe_begin(dev);
+	if ((r = S0_unchecked(dev)) == 0) {
+		dev->results = &S1_results;
+		r = S1_checked(dev);
+	}
+	e = pipe_end(dev);
+	dev->results = NULL;
+	if (r == 0)
+		r = e;
+	if (r != 0)
+		return r;
+	warm_save(dev);
+	return 0;
+}
+
+#ifndef VFS101_LIBRARY
+
+static int woot (struct vfs_dev *dev)
+{
+	_(  reader_init (dev));
+	do {
+		if (wait_for_touch(dev) != 0)
+			break;
+		dev->results = &S2_results;
+		S2_checked(dev);
+	} while (0);
+	return 0;
+}
+
+/* The Windows sessions under logs/, command for command. GetFingerState
+ * returns the finger state, so only errors stop these. The Makefile points
+ * SCRIPT_DIR at the src/logs next to the build; without it, the scripts are
+ * looked for under the current folder. */
+#ifndef SCRIPT_DIR
+#define SCRIPT_DIR "src/logs"
+#endif
+
+static int play_file (struct vfs_dev *dev, const char *file)
+{
+	struct script *s = script_load(file);
+	if (s == NULL)
+		return VFS_ERR_SCRIPT;
+	r = script_run(dev, s, 1);
+	script_free(s);
+	return r;
+}
+
+static int rayl (struct vfs_dev *dev)
+{
+	return play_file(dev, SCRIPT_DIR "/20100315-0835-rayl.vfs");
+}
+
+static int gffranco (struct vfs_dev *dev)
+{
+	return play_file(dev, SCRIPT_DIR "/20100323-2040-gffranco.vfs");
+}
+
+/* any other script, from script=FILE */
+static int play (struct vfs_dev *dev)
+{
+	if (dev->script_file == NULL) {
+		fprintf(stderr, "play needs script=FILE\n");
+		return VFS_ERR_SCRIPT;
+	}
+	return play_file(dev, dev->script_file);
+}
+
+#endif
+
+#undef _
 
 
 /******************************************************************************************************
- * Result checking framework.
+ * Non-blocking scans
+ *
+ * vfs_scan_start() only queues the scan; each vfs_dev_handle_events() then
+ * runs scan_step() as far as the replies and scan lines that have landed
+ * allow. The steps are those of warm_rearm() and wait_for_touch(), then
+ * the swipe's LoadImage, with swap() only sending each command and
+ * scan_step() collecting its reply.
  */
 
-/* Result from a single API command when executed on Windows */
-struct result {
-	int len;
-	unsigned char *data;
+#define SCAN_POLL_MS 50
+
+enum {
+	SCAN_IDLE,
+	SCAN_ABORT,	/* stop whatever scan is pending */
+	SCAN_FLUSH,	/* start loading its leftover lines */
+	SCAN_DRAIN,	/* wait for them, then set the info line rate */
+	SCAN_ARM,	/* arm the reader for a swipe */
+	SCAN_POLL,	/* ask for the finger state */
+	SCAN_FINGER,	/* look at the answer */
+	SCAN_WAIT,	/* no finger yet, wait to poll again */
+	SCAN_LOAD,	/* stream the swipe */
+	SCAN_DONE,	/* hand over the image */
+	SCAN_STOP,	/* cancelled, wait for the AbortPrint */
 };
 
-/* All results from a single UsbSnoop.log file */
-struct result_table {
-	int n;
-	struct result r[];
+struct scan_job {
+	struct vfs_scan_opts opts;
+	vfs_scan_cb cb;
+	void *user;
+
+	int state;
+	int cancel;
+
+	/* SCAN_WAIT: when to poll again, else when the load started */
+	long long t;
+
+	/* the swipe, split into planes, and image rows already reported */
+	struct scan_planes planes;
+	int reported;
 };
 
-/* Look up a result in the result table by URB number */
-struct result * res_get (struct result_table *r, int n)
+/* the image the callback gets, and how many of its rows are complete */
+static int scan_image (struct scan_job *j, const unsigned char **image)
+{
+	struct scan_planes *sp = &j->planes;
+
+	if (sp->resample) {
+		*image = sp->speed.iso.data;
+		return sp->speed.iso.rows;
+	}
+	*image = sp->image.data;
+	return sp->image.rows - sp->pending;
+}
+
+/* Finish the scan, with the image or an error */
+static void scan_end (struct vfs_dev *dev, int r)
 {
-	if (n < 0) return NULL;
-	if (r == NULL) return NULL;
-	if (n > r->n) return NULL;
-	if (r->r[n].data == NULL) return NULL;
-	return &r->r[n];
+	struct scan_job *j = dev->job;
+	const unsigned char *image;
+	int rows = scan_image(j, &image);
+
+	j->state = SCAN_IDLE;
+	dev->async = 0;
+	dev->collect = NULL;
+	if (dev->log && j->planes.resample)
+		fprintf(dev->log, "  speed read off the Image BC strip for %d rows, off the full row for %d\n",
+			j->planes.speed.cheap, j->planes.speed.full);
+	if (r < 0)
+		j->cb(dev, VFS_SCAN_ERROR, NULL, r, j->user);
+	else
+		j->cb(dev, VFS_SCAN_DONE, image, rows, j->user);
 }
 
-static void res_check (struct vfs_dev *dev, int n)
+/* start LoadImage, collecting the image if this is the swipe */
+static int scan_load (struct vfs_dev *dev, int collect)
 {
-	struct result *r = res_get(dev->results,n);
+	dev->job->t = now_us();
+	dev->collect = collect ? &dev->job->planes.sink : NULL;
+	dev->job->reported = 0;
+	return LoadImage(dev);
+}
+
+/* Take the scan one step further. Returns 1 if it should be called again
+ * straight away, or 0 when it is waiting for the reader or the clock. */
+static int scan_step (struct vfs_dev *dev)
+{
+	struct scan_job *j = dev->job;
+	const unsigned char *image;
+	struct vfs_cmd *c;
+	int r, rows;
 
-	if (r == NULL) {
-		printf("  !!!! no result to check against! !!!!\n");
+	if ((j == NULL) || (j->state == SCAN_IDLE))
+		return 0;
 
-	} else if ((r->len != dev->len - 4) || (memcmp(r->data, dev->buf+4, dev->len-4) != 0)) {
-		dump_buffer(r->data, r->len, "  XXXX            ");
+	/* every state but the loads starts with the last reply in dev->buf */
+	if (dev->sent != dev->retired) {
+		c = &dev->cmd[dev->retired % MAX_PIPE];
+		if (!c->ready && !dev->tr->ready(dev, c))
+			return 0;
+		if ((r = resync_step(dev, c)) == 0)
+			return 0;
+		if ((r < 0) || ((r = recv(dev)) < 0)) {
+			scan_end(dev, r);
+			return 0;
+		}
 	}
-}
 
+	/* a failed send leaves its slot's read cancelled but not yet back,
+	 * and the next command goes in the same slot */
+	c = &dev->cmd[dev->sent % MAX_PIPE];
+	if ((c->xin != NULL) && !c->in_done)
+		return 0;
 
-/******************************************************************************************************
- * raw terminal support
- */
-#include <termios.h> 
- 
-static void raw (void) 
-{ 
-	struct termios tio; 
-	tcgetattr( 0, &tio ); 
-	tio.c_lflag &= ~ICANON; 
-	tio.c_cc[VMIN] = 0;
-	tio.c_cc[VTIME] = 1;
-	tcsetattr( 0, TCSANOW, &tio ); 
-} 
- 
-static void noraw (void) 
-{ 
-	struct termios tio; 
-	tcgetattr( 0, &tio ); 
-	tio.c_lflag |= ICANON; 
-	tcsetattr( 0, TCSANOW, &tio ); 
-} 
- 
-static int getch (void)
-{
-	char c;
-	int n;
-	n = read(0, &c, 1);
-	return (n<0) ? n : (n==0) ? 0 : c;
-}
+	/* a cancel takes effect between commands and loads */
+	if (j->cancel && (j->state != SCAN_DRAIN) && (j->state != SCAN_LOAD) && (j->state != SCAN_STOP)) {
+		j->state = SCAN_STOP;
+		if ((r = AbortPrint(dev)) < 0)
+			scan_end(dev, r);
+		return 1;
+	}
 
+	switch (j->state) {
+	case SCAN_ABORT:
+		r = AbortPrint(dev);
+		j->state = SCAN_FLUSH;
+		break;
+
+	case SCAN_FLUSH:
+		r = scan_load(dev, 0);
+		j->state = SCAN_DRAIN;
+		break;
+
+	case SCAN_DRAIN:
+		if ((r = dev->tr->load_poll(dev)) == 0)
+			return 0;
+		load_stats(dev, j->t);
+		if (r > 0)
+			r = SetParam(dev, P_INFO_LINE_RATE, dev->info_line_rate);
+		j->state = SCAN_ARM;
+		break;
+
+	case SCAN_ARM:
+		r = GetPrint(dev, 0x1388, type_1);
+		j->state = SCAN_POLL;
+		break;
+
+	case SCAN_POLL:
+		r = GetFingerState(dev);
+		j->state = SCAN_FINGER;
+		break;
+
+	case SCAN_FINGER:
+		if (dev->buf[0x0a] != 2) {
+			j->t = now_us() + j->opts.poll_ms * 1000LL;
+			j->state = SCAN_WAIT;
+			return 1;
+		}
+		j->cb(dev, VFS_SCAN_FINGER, NULL, 0, j->user);
+		r = scan_load(dev, 1);
+		j->state = SCAN_LOAD;
+		break;
+
+	case SCAN_WAIT:
+		if (now_us() < j->t)
+			return 0;
+		j->state = SCAN_POLL;
+		return 1;
+
+	case SCAN_LOAD:
+		r = dev->tr->load_poll(dev);
+		if ((rows = scan_image(j, &image)) > j->reported) {
+			j->reported = rows;
+			j->cb(dev, VFS_SCAN_LINES, image, rows, j->user);
+		}
+		if (r == 0)
+			return 0;
+		load_stats(dev, j->t);
+		dev->collect = NULL;
+		j->state = SCAN_DONE;
+		break;
+
+	case SCAN_DONE:
+		scan_end(dev, j->planes.err);
+		return 0;
 
-/******************************************************************************************************
- * Cycle routines
- *
- * Each routine is a particular testcase, selectable from the command line.
- */
+	case SCAN_STOP:
+		scan_end(dev, VFS_ERR_STOPPED);
+		return 0;
+	}
 
-/* A shorthand for checking return codes */
-static int r;
-#define _(x) if ((r = x) != 0) return r
-#define __(n, x) _cmd_no=n; if ((r = x) != 0) return r; res_check(dev,n)
-#define ___(x) if ((r = x) != 0) printf("Error %d\n", r)
+	if (r < 0) {
+		scan_end(dev, r);
+		return 0;
+	}
+	return 1;
+}
 
-/* Reset the scanner device */
-static int reset (struct vfs_dev *dev)
+/* ms until scan_step() can make progress, or -1 to wait for the reader */
+static int scan_timeout (struct vfs_dev *dev)
 {
-	_(  Reset (dev));
-	return 0;	
+	struct scan_job *j = dev->job;
+	struct vfs_cmd *c = &dev->cmd[dev->retired % MAX_PIPE];
+	long long t;
+
+	if ((j == NULL) || (j->state == SCAN_IDLE))
+		return -1;
+	if (dev->sent != dev->retired)
+		return (c->ready || dev->tr->ready(dev, c)) ? 0 : -1;
+
+	switch (j->state) {
+	case SCAN_WAIT:
+		t = j->t - now_us();
+		return (t > 0) ? (t + 999) / 1000 : 0;
+	case SCAN_DRAIN:
+	case SCAN_LOAD:
+		return BULK_TIMEOUT / 4;
+	}
+	return 0;
 }
 
-/* Exercise the gain register */
-static int test (struct vfs_dev *dev)
+/* Stop a scan on the way down: let a load in progress run out, and leave
+ * the command in flight for pipe_flush() */
+static void scan_close (struct vfs_dev *dev)
 {
-	int done = 0;
-	int x = 0x00ff8000;
-	int w = 1;
-	raw();
-	while (!done) {
-		int n = getch();
-		if (n < 0)
-			break;
-		switch (n) {
-		case 27: done = 1; break;
-		case '\\': dev_open(dev); break;
+	struct scan_job *j = dev->job;
 
-		case '1': w = 1; break;
-		case '2': w = 2; break;
-		case '4': w = 4; break;
+	if ((j == NULL) || (j->state == SCAN_IDLE))
+		return;
+	dev->async = 0;
+	if ((j->state == SCAN_DRAIN) || (j->state == SCAN_LOAD))
+		load_finish(dev);
+	scan_end(dev, VFS_ERR_STOPPED);
+}
 
-		case 'q': x += w; break;
-		case 'a': x -= w; break;
 
-		case 'w': x += 0x10; break;
-		case 's': x -= 0x10; break;
+/******************************************************************************************************
+ * Embedding API
+ *
+ * See vfs101.h. The pollfds and timeouts are those of the reader's own
+ * libusb context; the sim and replay backends have none.
+ */
 
-		case 'e': x += 0x100; break;
-		case 'd': x -= 0x100; break;
+struct vfs_dev *vfs_dev_new (const char *backend)
+{
+	const struct vfs_transport *tr = backend ? transport(backend) : &usb_transport;
+	struct vfs_dev *dev;
 
-		case 'r': x += 0x1000; break;
-		case 'f': x -= 0x1000; break;
+	if (tr == NULL)
+		return NULL;
+	dev = malloc(sizeof(*dev));
+	if (dev == NULL)
+		return NULL;
+	dev_init(dev);
+	dev->tr = tr;
+	dev->log = NULL;
+	return dev;
+}
 
-		case 't': x += 0x10000; break;
-		case 'g': x -= 0x10000; break;
+void vfs_dev_set_log (struct vfs_dev *dev, FILE *log)
+{
+	dev->log = log;
+}
 
-		case 'y': x += 0x100000; break;
-		case 'h': x -= 0x100000; break;
+void vfs_dev_free (struct vfs_dev *dev)
+{
+	if (dev == NULL)
+		return;
+	dev_close(dev);
+	trace_close(dev);
+	if (dev->job)
+		planes_free(&dev->job->planes);
+	free(dev->job);
+	free(dev);
+}
 
-		case 'u': x += 0x1000000; break;
-		case 'j': x -= 0x1000000; break;
+int vfs_dev_open (struct vfs_dev *dev)
+{
+	return dev_open(dev);
+}
 
-		case 'i': x += 0x10000000; break;
-		case 'k': x -= 0x10000000; break;
+int vfs_get_pollfds (struct vfs_dev *dev, struct pollfd *fds, int max)
+{
+	const struct libusb_pollfd **p;
+	int n;
 
+	if (dev->ctx == NULL)
+		return 0;
+	p = libusb_get_pollfds(dev->ctx);
+	if (p == NULL)
+		return LIBUSB_ERROR_NO_MEM;
+	for (n = 0; p[n] != NULL; n++) {
+		if (n < max) {
+			fds[n].fd = p[n]->fd;
+			fds[n].events = p[n]->events;
+			fds[n].revents = 0;
 		}
-		___(  Peek (dev, x, w));
-		//usleep(50000);
 	}
-	noraw();
-	return 0;	
+	libusb_free_pollfds(p);
+	return n;
 }
 
-/* Wait for a finger touch */
-static int wait_for_touch (struct vfs_dev *dev)
+void vfs_set_pollfd_notifiers (struct vfs_dev *dev, vfs_pollfd_added added, vfs_pollfd_removed removed, void *user)
 {
-	while (GetFingerState(dev) != 2)
-		usleep(50000);
-	return 0;
+	if (dev->ctx != NULL)
+		libusb_set_pollfd_notifiers(dev->ctx, added, removed, user);
 }
 
-/* mess with the width of secondary image */
-static int mess_with_bc = 0x010c;
-
-/* The frequency of info lines */
-static int info_line_rate = 0x32;
+int vfs_get_timeout (struct vfs_dev *dev)
+{
+	struct timeval tv;
+	int t = -1, s = scan_timeout(dev);
+
+	if ((dev->ctx != NULL) && (libusb_get_next_timeout(dev->ctx, &tv) == 1))
+		t = tv.tv_sec * 1000 + (tv.tv_usec + 999) / 1000;
+	if ((s >= 0) && ((t < 0) || (s < t)))
+		t = s;
+	return t;
+}
 
-/* The best contrast value tried so far */
-static int best_contrast = 0x00;
+int vfs_dev_handle_events (struct vfs_dev *dev)
+{
+	struct timeval tv = { 0, 0 };
+	int r;
 
-/* Image line exposure level */
-static int exposure = 0x21bc;
+	if (dev->state != 4)
+		return LIBUSB_ERROR_NO_DEVICE;
+	r = dev->tr->events(dev, &tv);
+	while (scan_step(dev))
+		;
+	return r;
+}
 
-/* Try a contrast register setting */
-static int try_contrast (struct vfs_dev *dev, int value)
+int vfs_dev_init (struct vfs_dev *dev)
 {
-	_(  Poke (dev, VFS_CONTRAST, value, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	// evaluate the result...
-	best_contrast = value;
-	return 0;
+	if (dev->state != 4)
+		return LIBUSB_ERROR_NO_DEVICE;
+	if (dev->async)
+		return VFS_ERR_BUSY;
+	return reader_init(dev);
 }
 
-/* Find the best contrast setting */
-static int scan_contrast (struct vfs_dev *dev)
+int vfs_scan_start (struct vfs_dev *dev, const struct vfs_scan_opts *opts, vfs_scan_cb cb, void *user)
 {
-	best_contrast = 0x00;
-	_(  try_contrast (dev, 0x0e));
-	_(  try_contrast (dev, 0x0d));
-	_(  try_contrast (dev, 0x0c));
-	_(  try_contrast (dev, 0x0b));
-	_(  try_contrast (dev, 0x0a));
-	_(  try_contrast (dev, 0x09));
+	struct scan_job *j = dev->job;
+
+	if (dev->state != 4)
+		return LIBUSB_ERROR_NO_DEVICE;
+	if (cb == NULL)
+		return LIBUSB_ERROR_INVALID_PARAM;
+	if ((j != NULL) && (j->state != SCAN_IDLE))
+		return VFS_ERR_BUSY;
+	if (j == NULL) {
+		j = calloc(1, sizeof(*j));
+		if (j == NULL)
+			return LIBUSB_ERROR_NO_MEM;
+		planes_init(&j->planes);
+		dev->job = j;
+	}
+
+	memset(&j->opts, 0, sizeof(j->opts));
+	if (opts)
+		j->opts = *opts;
+	if (j->opts.poll_ms <= 0)
+		j->opts.poll_ms = SCAN_POLL_MS;
+	j->cb = cb;
+	j->user = user;
+	j->cancel = 0;
+	j->reported = 0;
+	j->planes.max_image = j->opts.max_lines;
+	j->planes.fill = 1;
+	j->planes.resample = j->opts.resample;
+	j->planes.image.rows = 0;
+	j->planes.err = 0;
+	j->state = SCAN_ABORT;
+	dev->async = 1;
 	return 0;
 }
 
-/* first working version */
-#include "state0.h"
-#include "state1.h"
-#include "state2.h"
-static int woot (struct vfs_dev *dev)
+int vfs_scan_cancel (struct vfs_dev *dev)
 {
-	S0_unchecked(dev);
-	dev->results = &S1_results;
-	S1_checked(dev);
-	do {
-		wait_for_touch(dev);
-		dev->results = &S2_results;
-		S2_checked(dev);
-	} while (0);
+	if ((dev->job == NULL) || (dev->job->state == SCAN_IDLE))
+		return 0;
+	dev->job->cancel = 1;
 	return 0;
 }
 
-#undef _
 
+#ifndef VFS101_LIBRARY
 
 /******************************************************************************************************
  * Main launcher
@@ -1104,30 +4524,373 @@ static cycle_func func (const char *id)
 		_(reset);
 		_(test);
 		_(woot);
+		_(rayl);
+		_(gffranco);
+		_(play);
 	}
 	return woot;
 #undef _
 }
 
+/* With log=FILE the log goes to FILE instead of stdout, or to FILE-N for
+ * reader N of the device manager */
+static void log_open (struct vfs_dev *dev, const char *file)
+{
+	char name[256];
+
+	if (dev->unit < 0)
+		snprintf(name, sizeof(name), "%s", file);
+	else
+		snprintf(name, sizeof(name), "%s-%d", file, dev->unit);
+
+	dev->log = fopen(name, "w");
+	if (dev->log == NULL)
+		fprintf(stderr, "Can't create log file %s\n", name);
+}
+
+static void log_close (struct vfs_dev *dev)
+{
+	if ((dev->log != NULL) && (dev->log != stdout))
+		fclose(dev->log);
+	dev->log = NULL;
+}
+
+
+/******************************************************************************************************
+ * Device manager
+ *
+ * Watches the bus with libusb hotplug callbacks. Every VFS101 that shows up gets its own
+ * vfs_dev, log and I/O thread running the selected cycle routine, all sharing one libusb context.
+ * A reader that drops off the bus has its thread stopped, and is picked up again as a new
+ * arrival when it comes back (eg. after Reset). The reset that closes a reader once its cycle
+ * is over can make it reenumerate too, but that reader is not started again.
+ */
+
+#define MAX_DEVS 8
+
+/* how long after closing a reader it may take to come back from the reset */
+#define MGR_RESET_GRACE 5000000LL
+
+/* where each reader logs, as MGR_LOG-N, unless log= says otherwise */
+#define MGR_LOG "proto.log"
+
+struct vfs_manager;
+
+struct vfs_slot {
+	struct vfs_manager *m;
+
+	/* the reader, its context, and the thread driving it */
+	struct libusb_device *udev;
+	struct vfs_dev *dev;
+	pthread_t thread;
+
+	/* slot is in use until the manager joins its thread, once done */
+	int busy;
+	int done;
+
+	/* hub ports the reader hangs off, whether it has left the bus, and
+	 * until when a reader turning up on the same ports is only this one
+	 * coming back from the reset that closed it */
+	unsigned char port[8];
+	int nports;
+	int left;
+	long long quiet;
+};
+
+struct vfs_manager {
+	struct libusb_context *ctx;
+	libusb_hotplug_callback_handle hotplug;
+
+	/* cycle routine to run, and options to give each new vfs_dev */
+	cycle_func cycle;
+	struct vfs_dev *opts;
+
+	pthread_mutex_t lock;
+	struct vfs_slot slot[MAX_DEVS];
+};
+
+static void mgr_stop (int sig)
+{
+	stopping = 1;
+}
+
+static void *mgr_thread (void *arg)
+{
+	struct vfs_slot *s = arg;
+	struct vfs_dev *dev = s->dev;
+	int r;
+
+	log_open(dev, dev->log_file ? dev->log_file : MGR_LOG);
+	if (dev->trace_file)
+		trace_open(dev, dev->trace_file);
+	dev_attach(dev, s->m->ctx, s->udev);
+
+	if (dev_okay(dev))
+		if ((r = s->m->cycle(dev)) != 0)
+			fprintf(stderr, "reader %d: got error in main cycle %d (%s)\n", dev->unit, r, vfs_strerror(r));
+
+	pthread_mutex_lock(&s->m->lock);
+	if (!s->left)
+		s->quiet = now_us() + MGR_RESET_GRACE;
+	pthread_mutex_unlock(&s->m->lock);
+
+	dev_close(dev);
+	trace_close(dev);
+	log_close(dev);
+
+	pthread_mutex_lock(&s->m->lock);
+	s->done = 1;
+	pthread_mutex_unlock(&s->m->lock);
+
+	return NULL;
+}
+
+/* Join the threads that are done and free their slots, returning how many
+ * readers are still running */
+static int mgr_reap (struct vfs_manager *m)
+{
+	struct vfs_slot *s;
+	int i, n = 0;
+
+	pthread_mutex_lock(&m->lock);
+	for (i = 0; i < MAX_DEVS; i++) {
+		s = &m->slot[i];
+		if (s->busy && !s->done)
+			n++;
+		if (!s->busy || !s->done)
+			continue;
+
+		/* a thread that is done no longer takes the lock */
+		pthread_join(s->thread, NULL);
+		libusb_unref_device(s->udev);
+		free(s->dev);
+		s->udev = NULL;
+		s->dev = NULL;
+		s->busy = 0;
+	}
+	pthread_mutex_unlock(&m->lock);
+	return n;
+}
+
+/* a reader showed up: give it a vfs_dev and a thread */
+static void mgr_arrived (struct vfs_manager *m, struct libusb_device *udev)
+{
+	struct vfs_slot *s = NULL;
+	struct vfs_dev *dev;
+	unsigned char port[8];
+	int i, n;
+
+	n = libusb_get_port_numbers(udev, port, sizeof(port));
+
+	pthread_mutex_lock(&m->lock);
+	for (i = 0; i < MAX_DEVS; i++) {
+		s = &m->slot[i];
+		if ((n > 0) && (s->nports == n) && (memcmp(s->port, port, n) == 0) && (now_us() < s->quiet)) {
+			s->quiet = 0;
+			pthread_mutex_unlock(&m->lock);
+			fprintf(stderr, "reader %d: back from its reset, not starting it again\n", i);
+			return;
+		}
+	}
+
+	/* prefer a slot not waiting for its reader to come back */
+	for (s = NULL, i = 0; i < MAX_DEVS; i++)
+		if (!m->slot[i].busy && ((s == NULL) || (m->slot[i].quiet < s->quiet)))
+			s = &m->slot[i];
+	if (s == NULL) {
+		pthread_mutex_unlock(&m->lock);
+		fprintf(stderr, "Too many readers, ignoring one\n");
+		return;
+	}
+
+	dev = malloc(sizeof(*dev));
+	if (dev == NULL) {
+		pthread_mutex_unlock(&m->lock);
+		fprintf(stderr, "Out of memory for reader\n");
+		return;
+	}
+	dev_init(dev);
+	dev->anonymous = m->opts->anonymous;
+	dev->nxfers = m->opts->nxfers;
+	dev->depth = m->opts->depth;
+	dev->warm = m->opts->warm;
+	dev->pnm_ascii = m->opts->pnm_ascii;
+	dev->trace_file = m->opts->trace_file;
+	dev->log_file = m->opts->log_file;
+	dev->script_file = m->opts->script_file;
+	dev->unit = s - m->slot;
+
+	s->m = m;
+	s->udev = libusb_ref_device(udev);
+	s->dev = dev;
+	s->busy = 1;
+	s->done = 0;
+	s->left = 0;
+	s->quiet = 0;
+	s->nports = (n > 0) ? n : 0;
+	memcpy(s->port, port, s->nports);
+
+	fprintf(stderr, "reader %d: attached at %d-%d\n", dev->unit, libusb_get_bus_number(udev), libusb_get_device_address(udev));
+	if (pthread_create(&s->thread, NULL, mgr_thread, s) != 0) {
+		fprintf(stderr, "reader %d: can't start I/O thread\n", dev->unit);
+		libusb_unref_device(s->udev);
+		s->udev = NULL;
+		s->dev = NULL;
+		s->busy = 0;
+		free(dev);
+	}
+	pthread_mutex_unlock(&m->lock);
+}
+
+/* Hotplug events may be delivered on any thread handling libusb events,
+ * reader threads included, so a reader that left is only told to stop
+ * here; mgr_reap() joins its thread later */
+static int mgr_hotplug (struct libusb_context *ctx, struct libusb_device *udev, libusb_hotplug_event event, void *user)
+{
+	struct vfs_manager *m = user;
+	struct vfs_slot *s;
+	int i;
+
+	if (event == LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED) {
+		mgr_arrived(m, udev);
+
+	} else if (event == LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT) {
+		pthread_mutex_lock(&m->lock);
+		for (i = 0; i < MAX_DEVS; i++) {
+			s = &m->slot[i];
+			if (!s->busy || s->done || (s->udev != udev))
+				continue;
+			s->left = 1;
+			s->dev->stop = 1;
+			if (s->quiet == 0)
+				fprintf(stderr, "reader %d: left the bus, stopping\n", i);
+		}
+		pthread_mutex_unlock(&m->lock);
+	}
+
+	return 0;
+}
+
+/* without hotplug support, pick up whatever readers are there right now */
+static void mgr_scan (struct vfs_manager *m)
+{
+	struct libusb_device **list;
+	struct libusb_device_descriptor desc;
+	ssize_t i, n;
+
+	n = libusb_get_device_list(m->ctx, &list);
+	for (i = 0; i < n; i++)
+		if ((libusb_get_device_descriptor(list[i], &desc) == 0) && (desc.idVendor == 0x138a) && (desc.idProduct == 0x0001))
+			mgr_arrived(m, list[i]);
+	if (n >= 0)
+		libusb_free_device_list(list, 1);
+}
+
+/* run a cycle routine on every reader until interrupted */
+static int manage (cycle_func cycle, struct vfs_dev *opts)
+{
+	static struct vfs_manager _m;
+	struct vfs_manager *m = &_m;
+	struct timeval tv;
+	int n, r;
+
+	memset(m, 0, sizeof(*m));
+	m->cycle = cycle;
+	m->opts = opts;
+	pthread_mutex_init(&m->lock, NULL);
+
+	r = libusb_init(&m->ctx);
+	if (r != 0) {
+		fprintf(stderr, "Failed to initialise libusb\n");
+		return r;
+	}
+
+	signal(SIGINT, mgr_stop);
+	signal(SIGTERM, mgr_stop);
+
+	if (libusb_has_capability(LIBUSB_CAP_HAS_HOTPLUG)) {
+		r = libusb_hotplug_register_callback(m->ctx,
+			LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED | LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT,
+			LIBUSB_HOTPLUG_ENUMERATE, 0x138a, 0x0001, LIBUSB_HOTPLUG_MATCH_ANY,
+			mgr_hotplug, m, &m->hotplug);
+		if (r != 0)
+			fprintf(stderr, "Failed to register hotplug callback %d\n", r);
+	} else {
+		fprintf(stderr, "No hotplug support, readers will not be reattached\n");
+		mgr_scan(m);
+	}
+
+	/* service hotplug events until told to stop, then wait for the readers to finish */
+	do {
+		tv.tv_sec = 0;
+		tv.tv_usec = 100000;
+		libusb_handle_events_timeout_completed(m->ctx, &tv, NULL);
+		n = mgr_reap(m);
+	} while (!stopping || (n > 0));
+
+	if (libusb_has_capability(LIBUSB_CAP_HAS_HOTPLUG) && (r == 0))
+		libusb_hotplug_deregister_callback(m->ctx, m->hotplug);
+	libusb_exit(m->ctx);
+	return 0;
+}
+
 
 /** Main function */
 int main (int argc, char **argv)
 {
-	struct vfs_dev _dev, *dev = &_dev;
-	int r;
+	static struct vfs_dev _dev;
+	struct vfs_dev *dev = &_dev;
+	int i, all = 0, r = 0;
 
 	dev_init(dev);
 
-	if ((argc > 2) && (strcmp(argv[2], "personal") == 0))
-		dev->anonymous = 0;
+	for (i = 2; i < argc; i++) {
+		if (strcmp(argv[i], "personal") == 0)
+			dev->anonymous = 0;
+		else if (strncmp(argv[i], "xfers=", 6) == 0)
+			dev->nxfers = atoi(argv[i] + 6);
+		else if (strncmp(argv[i], "pipe=", 5) == 0)
+			dev->depth = atoi(argv[i] + 5);
+		else if (strcmp(argv[i], "all") == 0)
+			all = 1;
+		else if (strcmp(argv[i], "warm") == 0)
+			dev->warm = 1;
+		else if (strcmp(argv[i], "ascii") == 0)
+			dev->pnm_ascii = 1;
+		else if (strncmp(argv[i], "faults=", 7) == 0)
+			dev->faults = atoi(argv[i] + 7);
+		else if (strncmp(argv[i], "trace=", 6) == 0)
+			dev->trace_file = argv[i] + 6;
+		else if (strncmp(argv[i], "log=", 4) == 0)
+			dev->log_file = argv[i] + 4;
+		else if (strncmp(argv[i], "script=", 7) == 0)
+			dev->script_file = argv[i] + 7;
+		else if ((strncmp(argv[i], "backend=", 8) == 0) && transport(argv[i] + 8))
+			dev->tr = transport(argv[i] + 8);
+		else
+			fprintf(stderr, "ignoring unknown option \"%s\"\n", argv[i]);
+	}
+
+	if (all && (dev->tr != &usb_transport))
+		fprintf(stderr, "only the usb backend can run every reader, ignoring backend=%s\n", dev->tr->name);
+	if (all)
+		return manage(func(argv[1]), dev);
 
+	if (dev->log_file)
+		log_open(dev, dev->log_file);
+	if (dev->trace_file)
+		trace_open(dev, dev->trace_file);
 	dev_open(dev);
 
 	if (dev_okay(dev))
 		if ((r = func(argv[1])(dev)) != 0)
-			fprintf(stderr, "got error in main cycle %d\n", r);
+			fprintf(stderr, "got error in main cycle %d (%s)\n", r, vfs_strerror(r));
 
 	dev_close(dev);
+	trace_close(dev);
+	log_close(dev);
 
 	return r;
 }
+
+#endif
@@ -0,0 +1,63 @@
+/* vfs101 fingerprint driver: command script format
+ *
+ * A UsbSnoop session in compact form, written by "scripts/Snoop2Api.pl -b"
+ * and run by the play, rayl and gffranco cycles in proto.c. The file starts
+ * with SCRIPT_MAGIC, then holds one op after another:
+ *
+ *   cmd                       a command, followed by its sc_args[cmd] bytes
+ *   cmd | SC_CHECK, urb       the same, with its reply checked against URB urb
+ *   SC_LOAD                   LoadImage
+ *   SC_RESULT, urb, len       len bytes of the reply recorded for URB urb,
+ *                             without its sequence number
+ *   SC_END                    end of script
+ *
+ * Command arguments are the bytes sent after the command id, as they went
+ * over the wire; urb is 2 bytes and len 1, little endian. A script can
+ * only check replies up to URB SCRIPT_MAX_URB, so the tools that write
+ * them stop with an error at the first checked command past it.
+ *
+ * Copyright (c) 2010 Damir Syabitov <dsyabitov@gmail.com>
+ * Copyright (c) 2010 Ray Lehtiniemi <rayl@mail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#define SCRIPT_MAGIC "VFSSCR01"
+#define SCRIPT_MAX_URB 0xffff
+
+enum script_op {
+	SC_END    = 0x00,
+	SC_LOAD   = 0x20,
+	SC_RESULT = 0x21,
+	SC_CHECK  = 0x80,
+};
+
+/* argument bytes of each command id a script may use, -1 for the others */
+static const signed char sc_args[0x17] = {
+	[0x00] = -1,
+	[0x01] =  0,	/* Reset */
+	[0x02] =  1,	/* GetVersion */
+	[0x03] =  8,	/* GetPrint */
+	[0x04] =  2,	/* GetParam */
+	[0x05] =  4,	/* SetParam */
+	[0x06] =  0,	/* GetConfig */
+	[0x07 ... 0x0d] = -1,
+	[0x0e] =  0,	/* AbortPrint */
+	[0x0f ... 0x11] = -1,
+	[0x12] =  5,	/* Peek */
+	[0x13] =  9,	/* Poke */
+	[0x14] =  7,	/* SensorSpiTrans */
+	[0x15] = -1,
+	[0x16] =  0,	/* GetFingerState */
+};
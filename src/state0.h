@@ -1,7 +1,7 @@
 /*  simple stupid test: just poke the right values into all the registers that Peek()
  *  different on Linux than on Windows...
  */
-int S0_unchecked (struct vfs_dev *dev)
+static int S0_unchecked (struct vfs_dev *dev)
 {
 	_( Poke (dev, 0x00001fec,      0x21570000, 0x04));
 	_( Poke (dev, 0x00001ff0,      0x0001299f, 0x04));
@@ -1,181 +1,4 @@
-int S1_unchecked (struct vfs_dev *dev)
-{
-	_(  Peek (dev, 0x00001fe8, 0x04));
-	_(  Peek (dev, 0x00001fec, 0x04));
-	_(  Peek (dev, 0x00001ff0, 0x04));
-	_(  Peek (dev, 0x00001ff4, 0x04));
-	_(  Peek (dev, 0x00001ff8, 0x04));
-	_(  Peek (dev, 0x00001ffc, 0x04));
-	_(  GetParam (dev, 0x002e));
-	_(  GetVersion (dev));
-	_(  GetParam (dev, 0x0028));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0011));
-	_(  GetParam (dev, 0x0054));
-	_(  GetParam (dev, 0x0001));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetPrint (dev, 0x0001, type_0));
-	_(  LoadImage (dev));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0004, 0x0000));
-	_(  SetParam (dev, 0x0005, 0x0000));
-	_(  SetParam (dev, 0x0006, 0x0000));
-	_(  SetParam (dev, 0x0007, 0x0000));
-	_(  SetParam (dev, 0x000a, 0x0002));
-	_(  SetParam (dev, 0x000b, 0x010b));
-	_(  SetParam (dev, P_MESS_WITH_BC, mess_with_bc));
-	_(  SetParam (dev, 0x000d, 0x010d));
-	_(  SetParam (dev, 0x000e, 0x0001));
-	_(  SetParam (dev, 0x0010, 0x0000));
-	_(  SetParam (dev, 0x0012, 0x0040));
-	_(  SetParam (dev, 0x0015, 0x04b0));
-	_(  SetParam (dev, 0x0016, 0x001b));
-	_(  SetParam (dev, 0x0017, 0x0001));
-	_(  SetParam (dev, 0x0018, 0x0003));
-	_(  SetParam (dev, 0x0019, 0x0001));
-	_(  SetParam (dev, 0x001a, 0x0000));
-	_(  SetParam (dev, 0x001b, 0x0004));
-	_(  SetParam (dev, 0x001d, 0x010c));
-	_(  SetParam (dev, 0x001e, 0x010d));
-	_(  SetParam (dev, 0x001f, 0x0000));
-	_(  SetParam (dev, 0x0020, 0x0000));
-	_(  SetParam (dev, 0x0021, 0x0001));
-	_(  SetParam (dev, 0x0022, 0x0001));
-	_(  SetParam (dev, 0x0023, 0x0001));
-	_(  SetParam (dev, 0x0024, 0x0000));
-	_(  SetParam (dev, 0x002c, 0x0046));
-	_(  SetParam (dev, 0x002d, 0x002a));
-	_(  SetParam (dev, 0x002f, 0x010e));
-	_(  SetParam (dev, 0x0030, 0x010f));
-	_(  SetParam (dev, 0x0032, 0x0004));
-	_(  SetParam (dev, 0x0033, 0x0003));
-	_(  SetParam (dev, 0x0034, 0x0005));
-	_(  SetParam (dev, 0x0035, 0x0010));
-	_(  SetParam (dev, 0x0036, 0x000a));
-	_(  SetParam (dev, 0x0037, 0x0018));
-	_(  SetParam (dev, 0x0038, 0x001e));
-	_(  SetParam (dev, 0x0039, 0x00b2));
-	_(  SetParam (dev, 0x003a, 0x0080));
-	_(  SetParam (dev, 0x003b, 0x0000));
-	_(  SetParam (dev, 0x003e, 0x01f4));
-	_(  SetParam (dev, 0x003f, 0x001a));
-	_(  SetParam (dev, 0x0040, 0x00f8));
-	_(  SetParam (dev, 0x0042, 0x0001));
-	_(  SetParam (dev, 0x0043, 0x0004));
-	_(  SetParam (dev, 0x0044, 0x0010));
-	_(  SetParam (dev, 0x0045, 0x0005));
-	_(  SetParam (dev, 0x0046, 0x00f5));
-	_(  SetParam (dev, 0x0047, 0x000c));
-	_(  SetParam (dev, 0x0048, 0x0000));
-	_(  SetParam (dev, 0x0049, 0x0000));
-	_(  SetParam (dev, 0x0053, 0x0000));
-	_(  SetParam (dev, 0x0056, 0x00b4));
-	_(  SetParam (dev, P_THRESHOLD, 0x0096));
-	_(  SetParam (dev, 0x0058, 0x008c));
-	_(  SetParam (dev, 0x0059, 0x0064));
-	_(  SetParam (dev, 0x005b, 0x0001));
-	_(  SetParam (dev, 0x005c, 0x0001));
-	_(  SetParam (dev, 0x005d, 0x0020));
-	_(  SetParam (dev, P_STATE_3_COUNT, 0x0064));
-	_(  SetParam (dev, P_STATE_5_COUNT, 0x00c8));
-	_(  SetParam (dev, 0x0060, 0x00c8));
-	_(  SetParam (dev, P_INFO_LINE_RATE, 0x0000));
-	_(  SetParam (dev, 0x0064, 0x011a));
-	_(  SetParam (dev, 0x0069, 0x0014));
-	_(  GetParam (dev, 0x002a));
-	_(  GetParam (dev, 0x003c));
-	_(  GetParam (dev, 0x004a));
-	_(  GetParam (dev, 0x0041));
-	_(  GetVersion (dev));
-	_(  SetParam (dev, 0x0063, 0x0001));
-	_(  SensorSpiTrans (dev, 0x05, 0x00, 0xab, 0x00, 0x00, 0x00, 0x00));
-	_(  SetParam (dev, 0x0064, 0x0118));
-	_(  GetConfig (dev));
-	_(  SetParam (dev, 0x0046, 0x00f5));
-	_(  SetParam (dev, 0x006d, 0x0032));
-	_(  SetParam (dev, 0x006e, 0x0003));
-	_(  GetParam (dev, 0x0052));
-	_(  SetParam (dev, 0x0052, 0x0320));
-	_(  GetPrint (dev, 0x0001, type_2));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, 0x0052, 0x1eb4));
-	_(  Peek (dev, VFS_DARKEN_CD_1, 0x02));
-	_(  Peek (dev, VFS_DARKEN_CD_2, 0x02));
-	_(  Poke (dev, 0x000005f6, 0x00000001, 0x01));
-	_(  Peek (dev, VFS_GRATING, 0x01));
-	_(  Poke (dev, VFS_GRATING, 0x00000000, 0x01));
-	_(  Peek (dev, VFS_KILL_4, 0x01));
-	_(  Peek (dev, 0x00ff9800, 0x01));
-	_(  Peek (dev, 0x00ff9806, 0x01));
-	_(  Poke (dev, 0x00ff9806, 0x00000000, 0x01));
-	_(  GetPrint (dev, 0x0064, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x000005f6, 0x00000000, 0x01));
-	_(  Peek (dev, VFS_GRATING, 0x01));
-	_(  Poke (dev, VFS_GRATING, 0x00000010, 0x01));
-	_(  Peek (dev, VFS_KILL_4, 0x01));
-	_(  Peek (dev, 0x00ff9800, 0x01));
-	_(  Peek (dev, 0x00ff9806, 0x01));
-	_(  GetPrint (dev, 0x0064, type_0));
-	_(  LoadImage (dev));
-	_(  Peek (dev, VFS_CONTRAST, 0x01));
-	_(  Peek (dev, VFS_EXPOSURE, 0x02));
-	_(  Peek (dev, VFS_IMAGE_ABCD, 0x01));
-	_(  Poke (dev, VFS_IMAGE_ABCD, 0x00000012, 0x01));
-	_(  Poke (dev, VFS_EXPOSURE, 0x00004000, 0x02));
-	_(  Poke (dev, VFS_CONTRAST, 0x0000000f, 0x01));
-	_(  SetParam (dev, P_INFO_LINE_RATE, 0x0000));
-	_(  SetParam (dev, P_INFO_CONTRAST, 0x0000));
-	_(  SetParam (dev, 0x0076, 0x0000));
-	_(  SetParam (dev, 0x0078, 0x0000));
-	_(  GetPrint (dev, 0x0002, type_0));
-	_(  LoadImage (dev));
-	_(  Poke (dev, 0x000005f6, 0x00000001, 0x01));
-	_(  Peek (dev, VFS_GRATING, 0x01));
-	_(  Poke (dev, VFS_GRATING, 0x00000000, 0x01));
-	_(  Peek (dev, VFS_KILL_4, 0x01));
-	_(  Peek (dev, 0x00ff9800, 0x01));
-	_(  Peek (dev, 0x00ff9806, 0x01));
-	_(  scan_contrast (dev));
-	_(  Poke (dev, 0x000005f6, 0x00000000, 0x01));
-	_(  Peek (dev, VFS_GRATING, 0x01));
-	_(  Poke (dev, VFS_GRATING, 0x00000010, 0x01));
-	_(  Peek (dev, VFS_KILL_4, 0x01));
-	_(  Peek (dev, 0x00ff9800, 0x01));
-	_(  Peek (dev, 0x00ff9806, 0x01));
-	_(  Poke (dev, 0x00ff9806, 0x00000000, 0x01));
-	_(  GetPrint (dev, 0x000a, type_0));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, P_INFO_CONTRAST, best_contrast));
-	_(  SetParam (dev, 0x0076, 0x0012));
-	_(  SetParam (dev, 0x0078, 0x2230));
-	_(  Poke (dev, VFS_CONTRAST, 0x00000014, 0x01));
-	_(  Poke (dev, VFS_EXPOSURE, exposure, 0x02));
-	_(  Poke (dev, VFS_IMAGE_ABCD, 0x00000031, 0x01));
-	_(  SetParam (dev, P_INFO_LINE_RATE, info_line_rate));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  SetParam (dev, P_INFO_LINE_RATE, info_line_rate));
-	_(  GetVersion (dev));
-	_(  SetParam (dev, 0x0055, 0x0008));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, P_INFO_LINE_RATE, info_line_rate));
-	_(  GetPrint (dev, 0x0014, type_0));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0014));
-	_(  GetParam (dev, 0x0014));
-	_(  AbortPrint (dev));
-	_(  LoadImage (dev));
-	_(  GetParam (dev, 0x0011));
-	_(  SetParam (dev, P_INFO_LINE_RATE, info_line_rate));
-	_(  GetPrint (dev, 0x1388, type_1));
-	return 0;
-}
-int S1_checked (struct vfs_dev *dev)
+static int S1_checked (struct vfs_dev *dev)
 {
 	__(    6,    Peek (dev, 0x00001fe8, 0x04));
 	__(    8,    Peek (dev, 0x00001fec, 0x04));
@@ -203,7 +26,7 @@ int S1_checked (struct vfs_dev *dev)
 	__(   49,    SetParam (dev, 0x0007, 0x0000));
 	__(   51,    SetParam (dev, 0x000a, 0x0002));
 	__(   53,    SetParam (dev, 0x000b, 0x010b));
-	__(   55,    SetParam (dev, P_MESS_WITH_BC, mess_with_bc));
+	__(   55,    SetParam (dev, P_MESS_WITH_BC, dev->mess_with_bc));
 	__(   57,    SetParam (dev, 0x000d, 0x010d));
 	__(   59,    SetParam (dev, 0x000e, 0x0001));
 	__(   61,    SetParam (dev, 0x0010, 0x0000));
@@ -326,21 +149,21 @@ int S1_checked (struct vfs_dev *dev)
 	__(  319,    Poke (dev, 0x00ff9806, 0x00000000, 0x01));
 	__(  321,    GetPrint (dev, 0x000a, type_0));
 	 _(          LoadImage (dev));
-	__(  324,    SetParam (dev, P_INFO_CONTRAST, best_contrast));
+	__(  324,    SetParam (dev, P_INFO_CONTRAST, dev->best_contrast));
 	__(  326,    SetParam (dev, 0x0076, 0x0012));
 	__(  328,    SetParam (dev, 0x0078, 0x2230));
 	__(  330,    Poke (dev, VFS_CONTRAST, 0x00000014, 0x01));
-	__(  332,    Poke (dev, VFS_EXPOSURE, exposure, 0x02));
+	__(  332,    Poke (dev, VFS_EXPOSURE, dev->exposure, 0x02));
 	__(  334,    Poke (dev, VFS_IMAGE_ABCD, 0x00000031, 0x01));
-	__(  336,    SetParam (dev, P_INFO_LINE_RATE, info_line_rate));
+	__(  336,    SetParam (dev, P_INFO_LINE_RATE, dev->info_line_rate));
 	__(  338,    AbortPrint (dev));
 	 _(          LoadImage (dev));
-	__(  341,    SetParam (dev, P_INFO_LINE_RATE, info_line_rate));
+	__(  341,    SetParam (dev, P_INFO_LINE_RATE, dev->info_line_rate));
 	__(  343,    GetVersion (dev));
 	__(  345,    SetParam (dev, 0x0055, 0x0008));
 	__(  347,    GetParam (dev, 0x0014));
 	__(  349,    GetParam (dev, 0x0011));
-	__(  351,    SetParam (dev, P_INFO_LINE_RATE, info_line_rate));
+	__(  351,    SetParam (dev, P_INFO_LINE_RATE, dev->info_line_rate));
 	__(  353,    GetPrint (dev, 0x0014, type_0));
 	 _(          LoadImage (dev));
 	__(  356,    GetParam (dev, 0x0014));
@@ -348,174 +171,340 @@ int S1_checked (struct vfs_dev *dev)
 	__(  360,    AbortPrint (dev));
 	 _(          LoadImage (dev));
 	__(  363,    GetParam (dev, 0x0011));
-	__(  365,    SetParam (dev, P_INFO_LINE_RATE, info_line_rate));
+	__(  365,    SetParam (dev, P_INFO_LINE_RATE, dev->info_line_rate));
 	__(  367,    GetPrint (dev, 0x1388, type_1));
 	return 0;
 }
-struct result_table S1_results =
+static const struct result S1_result[] =
+{
+	{     6,     0,   8 },
+	{     8,     8,   8 },
+	{    10,    16,   8 },
+	{    12,    24,   8 },
+	{    14,    32,   8 },
+	{    16,    40,   8 },
+	{    18,    48,   6 },
+	{    20,    54,  44 },
+	{    22,    98,   6 },
+	{    24,   104,   6 },
+	{    26,   110,   6 },
+	{    28,   116,   6 },
+	{    30,   122,   6 },
+	{    32,   128,   6 },
+	{    34,   134,   4 },
+	{    37,   138,   4 },
+	{    40,   142,   4 },
+	{    43,   146,   6 },
+	{    45,   152,   6 },
+	{    47,   158,   6 },
+	{    49,   164,   6 },
+	{    51,   170,   6 },
+	{    53,   176,   6 },
+	{    55,   182,   6 },
+	{    57,   188,   6 },
+	{    59,   194,   6 },
+	{    61,   200,   6 },
+	{    63,   206,   6 },
+	{    65,   212,   6 },
+	{    67,   218,   6 },
+	{    69,   224,   6 },
+	{    71,   230,   6 },
+	{    73,   236,   6 },
+	{    75,   242,   6 },
+	{    77,   248,   6 },
+	{    79,   254,   6 },
+	{    81,   260,   6 },
+	{    83,   266,   6 },
+	{    85,   272,   6 },
+	{    87,   278,   6 },
+	{    89,   284,   6 },
+	{    91,   290,   6 },
+	{    93,   296,   6 },
+	{    95,   302,   6 },
+	{    97,   308,   6 },
+	{    99,   314,   6 },
+	{   101,   320,   6 },
+	{   103,   326,   6 },
+	{   105,   332,   6 },
+	{   107,   338,   6 },
+	{   109,   344,   6 },
+	{   111,   350,   6 },
+	{   113,   356,   6 },
+	{   115,   362,   6 },
+	{   117,   368,   6 },
+	{   119,   374,   6 },
+	{   121,   380,   6 },
+	{   123,   386,   6 },
+	{   125,   392,   6 },
+	{   127,   398,   6 },
+	{   129,   404,   6 },
+	{   131,   410,   6 },
+	{   133,   416,   6 },
+	{   135,   422,   6 },
+	{   137,   428,   6 },
+	{   139,   434,   6 },
+	{   141,   440,   6 },
+	{   143,   446,   6 },
+	{   145,   452,   6 },
+	{   147,   458,   6 },
+	{   149,   464,   6 },
+	{   151,   470,   6 },
+	{   153,   476,   6 },
+	{   155,   482,   6 },
+	{   157,   488,   6 },
+	{   159,   494,   6 },
+	{   161,   500,   6 },
+	{   163,   506,   6 },
+	{   165,   512,   6 },
+	{   167,   518,   6 },
+	{   169,   524,   6 },
+	{   171,   530,   6 },
+	{   173,   536,   6 },
+	{   175,   542,   6 },
+	{   177,   548,   6 },
+	{   179,   554,   6 },
+	{   181,   560,  44 },
+	{   183,   604,   6 },
+	{   185,   610,   9 },
+	{   187,   619,   6 },
+	{   189,   625,  34 },
+	{   191,   659,   6 },
+	{   193,   665,   6 },
+	{   195,   671,   6 },
+	{   197,   677,   6 },
+	{   199,   683,   6 },
+	{   201,   689,   4 },
+	{   204,   693,   6 },
+	{   206,   699,   8 },
+	{   208,   707,   8 },
+	{   210,   715,   4 },
+	{   212,   719,   8 },
+	{   214,   727,   4 },
+	{   216,   731,   8 },
+	{   218,   739,   8 },
+	{   220,   747,   8 },
+	{   222,   755,   4 },
+	{   224,   759,   4 },
+	{   227,   763,   4 },
+	{   229,   767,   8 },
+	{   231,   775,   4 },
+	{   233,   779,   8 },
+	{   235,   787,   8 },
+	{   237,   795,   8 },
+	{   239,   803,   4 },
+	{   242,   807,   8 },
+	{   244,   815,   8 },
+	{   246,   823,   8 },
+	{   248,   831,   4 },
+	{   250,   835,   4 },
+	{   252,   839,   4 },
+	{   254,   843,   6 },
+	{   256,   849,   6 },
+	{   258,   855,   6 },
+	{   260,   861,   6 },
+	{   262,   867,   4 },
+	{   265,   871,   4 },
+	{   267,   875,   8 },
+	{   269,   883,   4 },
+	{   271,   887,   8 },
+	{   273,   895,   8 },
+	{   275,   903,   8 },
+	{   307,   911,   4 },
+	{   309,   915,   8 },
+	{   311,   923,   4 },
+	{   313,   927,   8 },
+	{   315,   935,   8 },
+	{   317,   943,   8 },
+	{   319,   951,   4 },
+	{   321,   955,   4 },
+	{   324,   959,   6 },
+	{   326,   965,   6 },
+	{   328,   971,   6 },
+	{   330,   977,   4 },
+	{   332,   981,   4 },
+	{   334,   985,   4 },
+	{   336,   989,   6 },
+	{   338,   995,   4 },
+	{   341,   999,   6 },
+	{   343,  1005,  44 },
+	{   345,  1049,   6 },
+	{   347,  1055,   6 },
+	{   349,  1061,   6 },
+	{   351,  1067,   6 },
+	{   353,  1073,   4 },
+	{   356,  1077,   6 },
+	{   358,  1083,   6 },
+	{   360,  1089,   4 },
+	{   363,  1093,   6 },
+	{   365,  1099,   6 },
+	{   367,  1105,   4 },
+};
+static const unsigned char S1_blob[] =
+	/*     6 */ "\x12\x00\x00\x00\x00\x00\x00\x00"
+	/*     8 */ "\x12\x00\x00\x00\x00\x00\x57\x21"
+	/*    10 */ "\x12\x00\x00\x00\x9f\x29\x01\x00"
+	/*    12 */ "\x12\x00\x00\x00\xdb\xdb\xdb\xdb"
+	/*    14 */ "\x12\x00\x00\x00\x00\x00\x00\x00"
+	/*    16 */ "\x12\x00\x00\x00\x20\x49\xfb\xd4"
+	/*    18 */ "\x04\x00\x00\x00\x0a\x00"
+	/*    20 */ "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+	/*    22 */ "\x04\x00\x00\x00\x00\x00"
+	/*    24 */ "\x04\x00\x00\x00\x00\x00"
+	/*    26 */ "\x04\x00\x00\x00\x08\x00"
+	/*    28 */ "\x04\x00\x00\x00\x04\x00"
+	/*    30 */ "\x04\x00\x00\x00\xf4\x01"
+	/*    32 */ "\x04\x00\x00\x00\x00\x00"
+	/*    34 */ "\x0e\x00\x00\x00"
+	/*    37 */ "\x03\x00\x00\x00"
+	/*    40 */ "\x0e\x00\x00\x00"
+	/*    43 */ "\x05\x00\x03\x00\x00\x00"
+	/*    45 */ "\x05\x00\x03\x00\x00\x00"
+	/*    47 */ "\x05\x00\x03\x00\x00\x00"
+	/*    49 */ "\x05\x00\x03\x00\x00\x00"
+	/*    51 */ "\x05\x00\x00\x00\x02\x00"
+	/*    53 */ "\x05\x00\x00\x00\x0b\x01"
+	/*    55 */ "\x05\x00\x00\x00\x0c\x01"
+	/*    57 */ "\x05\x00\x00\x00\x0d\x01"
+	/*    59 */ "\x05\x00\x00\x00\x01\x00"
+	/*    61 */ "\x05\x00\x00\x00\x00\x00"
+	/*    63 */ "\x05\x00\x03\x00\x00\x00"
+	/*    65 */ "\x05\x00\x00\x00\xb0\x04"
+	/*    67 */ "\x05\x00\x00\x00\x1b\x00"
+	/*    69 */ "\x05\x00\x00\x00\x01\x00"
+	/*    71 */ "\x05\x00\x03\x00\x01\x00"
+	/*    73 */ "\x05\x00\x00\x00\x01\x00"
+	/*    75 */ "\x05\x00\x00\x00\x00\x00"
+	/*    77 */ "\x05\x00\x00\x00\x04\x00"
+	/*    79 */ "\x05\x00\x00\x00\x0c\x01"
+	/*    81 */ "\x05\x00\x00\x00\x0d\x01"
+	/*    83 */ "\x05\x00\x03\x00\x0d\x01"
+	/*    85 */ "\x05\x00\x03\x00\x0d\x01"
+	/*    87 */ "\x05\x00\x03\x00\x0d\x01"
+	/*    89 */ "\x05\x00\x03\x00\x0d\x01"
+	/*    91 */ "\x05\x00\x03\x00\x0d\x01"
+	/*    93 */ "\x05\x00\x03\x00\x0d\x01"
+	/*    95 */ "\x05\x00\x00\x00\x46\x00"
+	/*    97 */ "\x05\x00\x03\x00\x46\x00"
+	/*    99 */ "\x05\x00\x00\x00\x0e\x01"
+	/*   101 */ "\x05\x00\x00\x00\x0f\x01"
+	/*   103 */ "\x05\x00\x00\x00\x04\x00"
+	/*   105 */ "\x05\x00\x00\x00\x03\x00"
+	/*   107 */ "\x05\x00\x03\x00\x03\x00"
+	/*   109 */ "\x05\x00\x03\x00\x03\x00"
+	/*   111 */ "\x05\x00\x03\x00\x03\x00"
+	/*   113 */ "\x05\x00\x03\x00\x03\x00"
+	/*   115 */ "\x05\x00\x03\x00\x03\x00"
+	/*   117 */ "\x05\x00\x03\x00\x03\x00"
+	/*   119 */ "\x05\x00\x03\x00\x03\x00"
+	/*   121 */ "\x05\x00\x03\x00\x03\x00"
+	/*   123 */ "\x05\x00\x03\x00\x03\x00"
+	/*   125 */ "\x05\x00\x03\x00\x03\x00"
+	/*   127 */ "\x05\x00\x03\x00\x03\x00"
+	/*   129 */ "\x05\x00\x00\x00\x01\x00"
+	/*   131 */ "\x05\x00\x03\x00\x01\x00"
+	/*   133 */ "\x05\x00\x00\x00\x10\x00"
+	/*   135 */ "\x05\x00\x00\x00\x05\x00"
+	/*   137 */ "\x05\x00\x00\x00\xf5\x00"
+	/*   139 */ "\x05\x00\x00\x00\x0c\x00"
+	/*   141 */ "\x05\x00\x00\x00\x00\x00"
+	/*   143 */ "\x05\x00\x00\x00\x00\x00"
+	/*   145 */ "\x05\x00\x00\x00\x00\x00"
+	/*   147 */ "\x05\x00\x00\x00\xb4\x00"
+	/*   149 */ "\x05\x00\x00\x00\x96\x00"
+	/*   151 */ "\x05\x00\x00\x00\x8c\x00"
+	/*   153 */ "\x05\x00\x00\x00\x64\x00"
+	/*   155 */ "\x05\x00\x00\x00\x01\x00"
+	/*   157 */ "\x05\x00\x00\x00\x01\x00"
+	/*   159 */ "\x05\x00\x00\x00\x20\x00"
+	/*   161 */ "\x05\x00\x00\x00\x64\x00"
+	/*   163 */ "\x05\x00\x00\x00\xc8\x00"
+	/*   165 */ "\x05\x00\x00\x00\xc8\x00"
+	/*   167 */ "\x05\x00\x00\x00\x00\x00"
+	/*   169 */ "\x05\x00\x00\x00\x1a\x01"
+	/*   171 */ "\x05\x00\x00\x00\x14\x00"
+	/*   173 */ "\x04\x00\x03\x00\x14\x00"
+	/*   175 */ "\x04\x00\x03\x00\x14\x00"
+	/*   177 */ "\x04\x00\x00\x00\x6f\x00"
+	/*   179 */ "\x04\x00\x03\x00\x6f\x00"
+	/*   181 */ "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+	/*   183 */ "\x05\x00\x00\x00\x01\x00"
+	/*   185 */ "\x14\x00\x00\x00\x00\x00\x00\x00\x00"
+	/*   187 */ "\x05\x00\x00\x00\x18\x01"
+	/*   189 */ "\x06\x00\x00\x00\x00\x00\x08\x00\x0a\x0a\x11\x11\xe6\xdd\xe6\xe5\xf0\xee\xf0\xef\x03\x00\x31\x00\x20\x00\x12\x00\x14\x00\xff\xff\x85\x00"
+	/*   191 */ "\x05\x00\x00\x00\xf5\x00"
+	/*   193 */ "\x05\x00\x00\x00\x32\x00"
+	/*   195 */ "\x05\x00\x00\x00\x03\x00"
+	/*   197 */ "\x04\x00\x00\x00\xb4\x1e"
+	/*   199 */ "\x05\x00\x00\x00\x20\x03"
+	/*   201 */ "\x03\x00\x00\x00"
+	/*   204 */ "\x05\x00\x00\x00\xb4\x1e"
+	/*   206 */ "\x12\x00\x00\x00\xf0\xee\x00\x00"
+	/*   208 */ "\x12\x00\x00\x00\xf0\xf0\x00\x00"
+	/*   210 */ "\x13\x00\x00\x00"
+	/*   212 */ "\x12\x00\x00\x00\x00\x00\x00\x00"
+	/*   214 */ "\x13\x00\x00\x00"
+	/*   216 */ "\x12\x00\x00\x00\xfb\x00\x00\x00"
+	/*   218 */ "\x12\x00\x00\x00\x03\x00\x00\x00"
+	/*   220 */ "\x12\x00\x00\x00\x10\x00\x00\x00"
+	/*   222 */ "\x13\x00\x00\x00"
+	/*   224 */ "\x03\x00\x00\x00"
+	/*   227 */ "\x13\x00\x00\x00"
+	/*   229 */ "\x12\x00\x00\x00\x00\x00\x00\x00"
+	/*   231 */ "\x13\x00\x00\x00"
+	/*   233 */ "\x12\x00\x00\x00\xfb\x00\x00\x00"
+	/*   235 */ "\x12\x00\x00\x00\x03\x00\x00\x00"
+	/*   237 */ "\x12\x00\x00\x00\x00\x00\x00\x00"
+	/*   239 */ "\x03\x00\x00\x00"
+	/*   242 */ "\x12\x00\x00\x00\x14\x00\x00\x00"
+	/*   244 */ "\x12\x00\x00\x00\xbc\x21\x00\x00"
+	/*   246 */ "\x12\x00\x00\x00\x31\x00\x00\x00"
+	/*   248 */ "\x13\x00\x00\x00"
+	/*   250 */ "\x13\x00\x00\x00"
+	/*   252 */ "\x13\x00\x00\x00"
+	/*   254 */ "\x05\x00\x00\x00\x00\x00"
+	/*   256 */ "\x05\x00\x00\x00\x00\x00"
+	/*   258 */ "\x05\x00\x00\x00\x00\x00"
+	/*   260 */ "\x05\x00\x00\x00\x00\x00"
+	/*   262 */ "\x03\x00\x00\x00"
+	/*   265 */ "\x13\x00\x00\x00"
+	/*   267 */ "\x12\x00\x00\x00\x00\x00\x00\x00"
+	/*   269 */ "\x13\x00\x00\x00"
+	/*   271 */ "\x12\x00\x00\x00\xfb\x00\x00\x00"
+	/*   273 */ "\x12\x00\x00\x00\x03\x00\x00\x00"
+	/*   275 */ "\x12\x00\x00\x00\x10\x00\x00\x00"
+	/*   307 */ "\x13\x00\x00\x00"
+	/*   309 */ "\x12\x00\x00\x00\x00\x00\x00\x00"
+	/*   311 */ "\x13\x00\x00\x00"
+	/*   313 */ "\x12\x00\x00\x00\xfb\x00\x00\x00"
+	/*   315 */ "\x12\x00\x00\x00\x03\x00\x00\x00"
+	/*   317 */ "\x12\x00\x00\x00\x10\x00\x00\x00"
+	/*   319 */ "\x13\x00\x00\x00"
+	/*   321 */ "\x03\x00\x00\x00"
+	/*   324 */ "\x05\x00\x00\x00\x09\x00"
+	/*   326 */ "\x05\x00\x00\x00\x12\x00"
+	/*   328 */ "\x05\x00\x00\x00\x30\x22"
+	/*   330 */ "\x13\x00\x00\x00"
+	/*   332 */ "\x13\x00\x00\x00"
+	/*   334 */ "\x13\x00\x00\x00"
+	/*   336 */ "\x05\x00\x00\x00\x32\x00"
+	/*   338 */ "\x0e\x00\x00\x00"
+	/*   341 */ "\x05\x00\x00\x00\x32\x00"
+	/*   343 */ "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+	/*   345 */ "\x05\x00\x00\x00\x08\x00"
+	/*   347 */ "\x04\x00\x00\x00\x00\x00"
+	/*   349 */ "\x04\x00\x00\x00\x08\x00"
+	/*   351 */ "\x05\x00\x00\x00\x32\x00"
+	/*   353 */ "\x03\x00\x00\x00"
+	/*   356 */ "\x04\x00\x00\x00\x00\x00"
+	/*   358 */ "\x04\x00\x00\x00\x00\x00"
+	/*   360 */ "\x0e\x00\x00\x00"
+	/*   363 */ "\x04\x00\x00\x00\x08\x00"
+	/*   365 */ "\x05\x00\x00\x00\x32\x00"
+	/*   367 */ "\x03\x00\x00\x00"
+	;
+static struct result_table S1_results =
 {
-	367,
-	{
-	[     6 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[     8 ] = {   8, "\x12\x00\x00\x00\x00\x00\x57\x21" },
-	[    10 ] = {   8, "\x12\x00\x00\x00\x9f\x29\x01\x00" },
-	[    12 ] = {   8, "\x12\x00\x00\x00\xdb\xdb\xdb\xdb" },
-	[    14 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[    16 ] = {   8, "\x12\x00\x00\x00\x20\x49\xfb\xd4" },
-	[    18 ] = {   6, "\x04\x00\x00\x00\x0a\x00" },
-	[    20 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[    22 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[    24 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[    26 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[    28 ] = {   6, "\x04\x00\x00\x00\x04\x00" },
-	[    30 ] = {   6, "\x04\x00\x00\x00\xf4\x01" },
-	[    32 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[    34 ] = {   4, "\x0e\x00\x00\x00" },
-	[    37 ] = {   4, "\x03\x00\x00\x00" },
-	[    40 ] = {   4, "\x0e\x00\x00\x00" },
-	[    43 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[    45 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[    47 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[    49 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[    51 ] = {   6, "\x05\x00\x00\x00\x02\x00" },
-	[    53 ] = {   6, "\x05\x00\x00\x00\x0b\x01" },
-	[    55 ] = {   6, "\x05\x00\x00\x00\x0c\x01" },
-	[    57 ] = {   6, "\x05\x00\x00\x00\x0d\x01" },
-	[    59 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[    61 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[    63 ] = {   6, "\x05\x00\x03\x00\x00\x00" },
-	[    65 ] = {   6, "\x05\x00\x00\x00\xb0\x04" },
-	[    67 ] = {   6, "\x05\x00\x00\x00\x1b\x00" },
-	[    69 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[    71 ] = {   6, "\x05\x00\x03\x00\x01\x00" },
-	[    73 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[    75 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[    77 ] = {   6, "\x05\x00\x00\x00\x04\x00" },
-	[    79 ] = {   6, "\x05\x00\x00\x00\x0c\x01" },
-	[    81 ] = {   6, "\x05\x00\x00\x00\x0d\x01" },
-	[    83 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[    85 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[    87 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[    89 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[    91 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[    93 ] = {   6, "\x05\x00\x03\x00\x0d\x01" },
-	[    95 ] = {   6, "\x05\x00\x00\x00\x46\x00" },
-	[    97 ] = {   6, "\x05\x00\x03\x00\x46\x00" },
-	[    99 ] = {   6, "\x05\x00\x00\x00\x0e\x01" },
-	[   101 ] = {   6, "\x05\x00\x00\x00\x0f\x01" },
-	[   103 ] = {   6, "\x05\x00\x00\x00\x04\x00" },
-	[   105 ] = {   6, "\x05\x00\x00\x00\x03\x00" },
-	[   107 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   109 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   111 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   113 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   115 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   117 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   119 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   121 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   123 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   125 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   127 ] = {   6, "\x05\x00\x03\x00\x03\x00" },
-	[   129 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[   131 ] = {   6, "\x05\x00\x03\x00\x01\x00" },
-	[   133 ] = {   6, "\x05\x00\x00\x00\x10\x00" },
-	[   135 ] = {   6, "\x05\x00\x00\x00\x05\x00" },
-	[   137 ] = {   6, "\x05\x00\x00\x00\xf5\x00" },
-	[   139 ] = {   6, "\x05\x00\x00\x00\x0c\x00" },
-	[   141 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   143 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   145 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   147 ] = {   6, "\x05\x00\x00\x00\xb4\x00" },
-	[   149 ] = {   6, "\x05\x00\x00\x00\x96\x00" },
-	[   151 ] = {   6, "\x05\x00\x00\x00\x8c\x00" },
-	[   153 ] = {   6, "\x05\x00\x00\x00\x64\x00" },
-	[   155 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[   157 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[   159 ] = {   6, "\x05\x00\x00\x00\x20\x00" },
-	[   161 ] = {   6, "\x05\x00\x00\x00\x64\x00" },
-	[   163 ] = {   6, "\x05\x00\x00\x00\xc8\x00" },
-	[   165 ] = {   6, "\x05\x00\x00\x00\xc8\x00" },
-	[   167 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   169 ] = {   6, "\x05\x00\x00\x00\x1a\x01" },
-	[   171 ] = {   6, "\x05\x00\x00\x00\x14\x00" },
-	[   173 ] = {   6, "\x04\x00\x03\x00\x14\x00" },
-	[   175 ] = {   6, "\x04\x00\x03\x00\x14\x00" },
-	[   177 ] = {   6, "\x04\x00\x00\x00\x6f\x00" },
-	[   179 ] = {   6, "\x04\x00\x03\x00\x6f\x00" },
-	[   181 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[   183 ] = {   6, "\x05\x00\x00\x00\x01\x00" },
-	[   185 ] = {   9, "\x14\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[   187 ] = {   6, "\x05\x00\x00\x00\x18\x01" },
-	[   189 ] = {  34, "\x06\x00\x00\x00\x00\x00\x08\x00\x0a\x0a\x11\x11\xe6\xdd\xe6\xe5\xf0\xee\xf0\xef\x03\x00\x31\x00\x20\x00\x12\x00\x14\x00\xff\xff\x85\x00" },
-	[   191 ] = {   6, "\x05\x00\x00\x00\xf5\x00" },
-	[   193 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[   195 ] = {   6, "\x05\x00\x00\x00\x03\x00" },
-	[   197 ] = {   6, "\x04\x00\x00\x00\xb4\x1e" },
-	[   199 ] = {   6, "\x05\x00\x00\x00\x20\x03" },
-	[   201 ] = {   4, "\x03\x00\x00\x00" },
-	[   204 ] = {   6, "\x05\x00\x00\x00\xb4\x1e" },
-	[   206 ] = {   8, "\x12\x00\x00\x00\xf0\xee\x00\x00" },
-	[   208 ] = {   8, "\x12\x00\x00\x00\xf0\xf0\x00\x00" },
-	[   210 ] = {   4, "\x13\x00\x00\x00" },
-	[   212 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[   214 ] = {   4, "\x13\x00\x00\x00" },
-	[   216 ] = {   8, "\x12\x00\x00\x00\xfb\x00\x00\x00" },
-	[   218 ] = {   8, "\x12\x00\x00\x00\x03\x00\x00\x00" },
-	[   220 ] = {   8, "\x12\x00\x00\x00\x10\x00\x00\x00" },
-	[   222 ] = {   4, "\x13\x00\x00\x00" },
-	[   224 ] = {   4, "\x03\x00\x00\x00" },
-	[   227 ] = {   4, "\x13\x00\x00\x00" },
-	[   229 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[   231 ] = {   4, "\x13\x00\x00\x00" },
-	[   233 ] = {   8, "\x12\x00\x00\x00\xfb\x00\x00\x00" },
-	[   235 ] = {   8, "\x12\x00\x00\x00\x03\x00\x00\x00" },
-	[   237 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[   239 ] = {   4, "\x03\x00\x00\x00" },
-	[   242 ] = {   8, "\x12\x00\x00\x00\x14\x00\x00\x00" },
-	[   244 ] = {   8, "\x12\x00\x00\x00\xbc\x21\x00\x00" },
-	[   246 ] = {   8, "\x12\x00\x00\x00\x31\x00\x00\x00" },
-	[   248 ] = {   4, "\x13\x00\x00\x00" },
-	[   250 ] = {   4, "\x13\x00\x00\x00" },
-	[   252 ] = {   4, "\x13\x00\x00\x00" },
-	[   254 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   256 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   258 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   260 ] = {   6, "\x05\x00\x00\x00\x00\x00" },
-	[   262 ] = {   4, "\x03\x00\x00\x00" },
-	[   265 ] = {   4, "\x13\x00\x00\x00" },
-	[   267 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[   269 ] = {   4, "\x13\x00\x00\x00" },
-	[   271 ] = {   8, "\x12\x00\x00\x00\xfb\x00\x00\x00" },
-	[   273 ] = {   8, "\x12\x00\x00\x00\x03\x00\x00\x00" },
-	[   275 ] = {   8, "\x12\x00\x00\x00\x10\x00\x00\x00" },
-	[   307 ] = {   4, "\x13\x00\x00\x00" },
-	[   309 ] = {   8, "\x12\x00\x00\x00\x00\x00\x00\x00" },
-	[   311 ] = {   4, "\x13\x00\x00\x00" },
-	[   313 ] = {   8, "\x12\x00\x00\x00\xfb\x00\x00\x00" },
-	[   315 ] = {   8, "\x12\x00\x00\x00\x03\x00\x00\x00" },
-	[   317 ] = {   8, "\x12\x00\x00\x00\x10\x00\x00\x00" },
-	[   319 ] = {   4, "\x13\x00\x00\x00" },
-	[   321 ] = {   4, "\x03\x00\x00\x00" },
-	[   324 ] = {   6, "\x05\x00\x00\x00\x09\x00" },
-	[   326 ] = {   6, "\x05\x00\x00\x00\x12\x00" },
-	[   328 ] = {   6, "\x05\x00\x00\x00\x30\x22" },
-	[   330 ] = {   4, "\x13\x00\x00\x00" },
-	[   332 ] = {   4, "\x13\x00\x00\x00" },
-	[   334 ] = {   4, "\x13\x00\x00\x00" },
-	[   336 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[   338 ] = {   4, "\x0e\x00\x00\x00" },
-	[   341 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[   343 ] = {  44, "\x02\x00\x00\x00\x56\x46\x53\x20\x76\x65\x72\x20\x33\x2e\x37\x32\x44\x20\x76\x63\x33\x2d\x73\x79\x73\x2e\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-	[   345 ] = {   6, "\x05\x00\x00\x00\x08\x00" },
-	[   347 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[   349 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[   351 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[   353 ] = {   4, "\x03\x00\x00\x00" },
-	[   356 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[   358 ] = {   6, "\x04\x00\x00\x00\x00\x00" },
-	[   360 ] = {   4, "\x0e\x00\x00\x00" },
-	[   363 ] = {   6, "\x04\x00\x00\x00\x08\x00" },
-	[   365 ] = {   6, "\x05\x00\x00\x00\x32\x00" },
-	[   367 ] = {   4, "\x03\x00\x00\x00" },
-	}
+	nitems(S1_result),
+	S1_result,
+	S1_blob,
 };
@@ -0,0 +1,47 @@
+/* vfs101 fingerprint driver: binary trace format
+ *
+ * A trace is the 8 byte magic TRACE_MAGIC followed by records. Each record
+ * is a struct trace_rec in host byte order, followed by len bytes of data.
+ *
+ * Copyright (c) 2010 Damir Syabitov <dsyabitov@gmail.com>
+ * Copyright (c) 2010 Ray Lehtiniemi <rayl@mail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#define TRACE_MAGIC "VFSTRC01"
+
+/* record types, and what arg and the data hold for each */
+enum trace_type {
+	TR_SEND  = 1,	/* command sent: URB number to check against, command */
+	TR_RECV  = 2,	/* reply landed: round trip in us, reply */
+	TR_CHECK = 3,	/* reply differs from the results table: -1 if there was
+			 * nothing to check against, else 0 and the expected reply
+			 * without its 4 byte header */
+	TR_LOAD  = 4,	/* LoadImage called: URB number, nothing */
+	TR_SCAN  = 5,	/* personal scan starts: image number, nothing */
+	TR_LINE  = 6,	/* scan line: line number, the line, short at the end */
+	TR_END   = 7,	/* personal scan ends: bytes in the scan, nothing */
+};
+
+struct trace_rec {
+	unsigned char type;
+	unsigned char pad;
+	unsigned short len;
+	int arg;
+
+	/* microseconds since the trace was opened */
+	long long t;
+};
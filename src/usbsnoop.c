@@ -0,0 +1,364 @@
+/* UsbSnoop logfile parser
+ *
+ * Does the job of scripts/UsbSnoop.pl in one pass and constant memory, so
+ * captures from long soak tests go through in seconds:
+ *
+ *   usbsnoop [-b] [FILE]
+ *
+ * reads a UsbSnoop.log from FILE or stdin and writes the SEND/RECV/LOAD/TIME
+ * records that Snoop2Api.pl reads. With -b it writes a command script for
+ * the play cycle instead (see script.h), as "Snoop2Api.pl -b" would, but
+ * without the PNM images. Problems with the log are reported on stderr.
+ * A log that runs past URB 65535 is too long for a script, and -b fails
+ * without writing anything.
+ *
+ * Based on scripts/UsbSnoop.pl, and under the same license.
+ * Copyright (c) 2010 Ray Lehtiniemi <rayl@mail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "script.h"
+
+#define MAX_LINE 1024
+
+/* where we are in a block: its header, each of the lines describing a
+ * bulk transfer, its data, or skipping to the next block after a problem */
+enum {
+	AT_BLOCK,
+	AT_TYPE,
+	AT_PIPE,
+	AT_FLAGS,
+	AT_LENGTH,
+	AT_BUFFER,
+	AT_MDL,
+	AT_DATA,
+	AT_LINK,
+	FLUSHING,
+};
+
+/* what the lines of a block must contain, from AT_FLAGS on */
+static const char *expect[] = {
+	[AT_FLAGS]  = "TransferFlags",
+	[AT_LENGTH] = "TransferBufferLength",
+	[AT_BUFFER] = "TransferBuffer",
+	[AT_MDL]    = "TransferBufferMDL",
+};
+
+static int script = 0;
+static int state = AT_BLOCK;
+
+/* time in ms of the current request, its sequence number, whether we are on
+ * the send or recv portion of the swap, and the current endpoint */
+static long timestamp;
+static long seq = 1;
+static int stage;
+static int ep;
+
+/* the data of the current transfer, lines of it seen so far, and what was
+ * last written: a load is one LoadImage however many transfers it takes */
+static unsigned char packet[0x40];
+static int plen;
+static int lines;
+static int loading;
+
+/* URB of the last command sent and of the last result written, for -b */
+static long send_seq = -1;
+static long result_seq = -1;
+
+/* where -b builds the script, copied to stdout only once it is complete */
+static FILE *out;
+
+static const char *label (void)
+{
+	return stage ? "SEND" : (ep == 0x82) ? "LOAD" : "RECV";
+}
+
+/* are we expecting to send/receive some data at this moment? */
+static int data_expected (void)
+{
+	return (ep == 0x01 && stage == 1) || (ep == 0x81 && stage == 0) || (ep == 0x82 && stage == 0);
+}
+
+static void parse (char *line);
+
+/* skip to the start of the next block, which may be this line */
+static void flush (char *line)
+{
+	fprintf(stderr, "        ********** FLUSHING!! ***********\n");
+	state = FLUSHING;
+	parse(line);
+}
+
+static int is_bulk (const char *type)
+{
+	static const char *nonbulk[] = {
+		"URB_FUNCTION_CONTROL_TRANSFER",
+		"URB_FUNCTION_GET_DESCRIPTOR_FROM_DEVICE",
+		"URB_FUNCTION_SELECT_CONFIGURATION",
+		"URB_FUNCTION_SET_FEATURE_TO_DEVICE",
+	};
+	int i;
+
+	if (strcmp(type, "URB_FUNCTION_BULK_OR_INTERRUPT_TRANSFER") == 0)
+		return 1;
+	for (i = 0; i < sizeof(nonbulk) / sizeof(nonbulk[0]); i++)
+		if (strcmp(type, nonbulk[i]) == 0)
+			return 0;
+	fprintf(stderr, "Unknown block: %s\n", type);
+	return 0;
+}
+
+/* "[1234 ms]  >>>  URB 5 going down  >>>" */
+static void block (const char *line)
+{
+	const char *u = strstr(line, " URB ");
+	long s = u ? atol(u + 5) : 0;
+
+	if (strstr(line, ">>>")) {
+		if (s != seq)
+			fprintf(stderr, "Sequence discontinuity, expecting %ld, jumped to %ld instead\n", seq, s);
+		timestamp = atol(line + 1);
+		seq = s;
+		stage = 1;
+	} else {
+		if (s != seq)
+			fprintf(stderr, "Sequence mismatch, got response %ld to request %ld\n", s, seq);
+		seq++;
+		stage = 0;
+	}
+	state = AT_TYPE;
+}
+
+/* write out one transfer's worth of data for -b */
+static void script_transfer (void)
+{
+	int cmd;
+
+	if (stage) {
+		if (plen < 6) {
+			fprintf(stderr, "Short command in URB %ld\n", seq);
+			return;
+		}
+		cmd = packet[4];
+		if ((cmd >= sizeof(sc_args)) || (sc_args[cmd] < 0) || (plen - 6 != sc_args[cmd])) {
+			fprintf(stderr, "Can't script command %02x with %d bytes in URB %ld\n", cmd, plen, seq);
+			return;
+		}
+		if (seq > SCRIPT_MAX_URB) {
+			fprintf(stderr, "URB %ld is past %d, the last one a command script can check\n", seq, SCRIPT_MAX_URB);
+			exit(1);
+		}
+		putc(cmd | SC_CHECK, out);
+		putc(seq & 0xff, out);
+		putc(seq >> 8, out);
+		fwrite(packet + 6, 1, plen - 6, out);
+		send_seq = seq;
+		loading = 0;
+
+	} else if (ep == 0x82) {
+		if (!loading)
+			putc(SC_LOAD, out);
+		loading = 1;
+
+	} else if ((plen >= 4) && (send_seq > result_seq)) {
+		putc(SC_RESULT, out);
+		putc(send_seq & 0xff, out);
+		putc(send_seq >> 8, out);
+		putc(plen - 4, out);
+		fwrite(packet + 4, 1, plen - 4, out);
+		result_seq = send_seq;
+		loading = 0;
+
+	} else {
+		fprintf(stderr, "Dropping reply in URB %ld\n", seq);
+	}
+}
+
+/* "    00000000: 00 00 00 00 12 00 e8 1f 00 00 04" */
+static void data (const char *line)
+{
+	const char *hex = strchr(line, ':') + 1;
+	char *end;
+	long b;
+
+	if (!script) {
+		if ((lines == 0) && stage)
+			printf("TIME: %ld %ld\n", timestamp, seq);
+		printf("%s: %s\n", label(), hex + (*hex == ' '));
+	} else if (ep != 0x82) {
+		while (((b = strtol(hex, &end, 16)), end != hex) && (plen < sizeof(packet))) {
+			packet[plen++] = b;
+			hex = end;
+		}
+	}
+	lines++;
+}
+
+/* the end of a transfer's data */
+static void data_end (void)
+{
+	if (script) {
+		if (lines || (ep == 0x82))
+			script_transfer();
+	} else if ((lines == 0) && (ep == 0x82)) {
+		printf("LOAD: \n");
+	}
+}
+
+static void parse (char *line)
+{
+	char *p;
+
+	switch (state) {
+	case FLUSHING:
+		if (line[0] != '[') {
+			fprintf(stderr, "               %s\n", line);
+			return;
+		}
+		state = AT_BLOCK;
+		/* fall through */
+
+	case AT_BLOCK:
+		if (line[0] != '[') {
+			fprintf(stderr, "Alignment problem!\n");
+			flush(line);
+		} else if (strstr(line, "UsbSnoop")) {
+			;
+		} else if (strstr(line, ">>>") || strstr(line, "<<<")) {
+			block(line);
+		} else {
+			fprintf(stderr, "Unrecognized line: %s\n", line);
+		}
+		return;
+
+	case AT_TYPE:
+		/* "-- URB_FUNCTION_BULK_OR_INTERRUPT_TRANSFER:" */
+		p = line + strlen(line) - 1;
+		if ((strncmp(line, "-- ", 3) != 0) || (p < line + 3) || (*p != ':')) {
+			flush(line);
+			return;
+		}
+		*p = 0;
+		if (!is_bulk(line + 3)) {
+			*p = ':';
+			flush(line);
+			return;
+		}
+		state = AT_PIPE;
+		return;
+
+	case AT_PIPE:
+		/* "  PipeHandle           = 80d6f5b4 [endpoint 0x00000081]" */
+		p = strstr(line, "[endpoint 0x");
+		ep = p ? strtol(p + 12, NULL, 16) : -1;
+		if ((strncmp(line, "  PipeHandle", 12) != 0) || ((ep != 0x01) && (ep != 0x81) && (ep != 0x82))) {
+			if (p)
+				fprintf(stderr, "Endpoint %02x is not valid...\n", ep);
+			flush(line);
+			return;
+		}
+		state = AT_FLAGS;
+		return;
+
+	case AT_FLAGS:
+	case AT_LENGTH:
+	case AT_BUFFER:
+	case AT_MDL:
+		if (strstr(line, expect[state]) == NULL) {
+			flush(line);
+			return;
+		}
+		state++;
+		plen = 0;
+		lines = 0;
+		return;
+
+	case AT_DATA:
+		if (data_expected() && (strncmp(line, "    0", 5) == 0) && strchr(line, ':')) {
+			data(line);
+			return;
+		}
+		if (data_expected())
+			data_end();
+		state = AT_LINK;
+		/* fall through */
+
+	case AT_LINK:
+		if (strstr(line, "UrbLink") == NULL)
+			flush(line);
+		else
+			state = AT_BLOCK;
+		return;
+	}
+}
+
+int main (int argc, char **argv)
+{
+	char line[MAX_LINE];
+	FILE *f = stdin;
+	size_t n;
+	int i, c;
+
+	for (i = 1; (i < argc) && (argv[i][0] == '-'); i++) {
+		if (strcmp(argv[i], "-b") == 0)
+			script = 1;
+		else
+			fprintf(stderr, "ignoring unknown option \"%s\"\n", argv[i]);
+	}
+	if (i < argc - 1) {
+		fprintf(stderr, "usage: %s [-b] [FILE]\n", argv[0]);
+		return 1;
+	}
+	if ((i == argc - 1) && ((f = fopen(argv[i], "r")) == NULL)) {
+		fprintf(stderr, "Can't open %s\n", argv[i]);
+		return 1;
+	}
+
+	if (script) {
+		if ((out = tmpfile()) == NULL) {
+			fprintf(stderr, "Can't create a temporary file for the script\n");
+			return 1;
+		}
+		fwrite(SCRIPT_MAGIC, 1, 8, out);
+	}
+
+	while (fgets(line, sizeof(line), f)) {
+		n = strlen(line);
+		if ((n > 0) && (line[n - 1] != '\n'))
+			while (((c = getc(f)) != EOF) && (c != '\n'))
+				;
+		while ((n > 0) && ((line[n - 1] == '\n') || (line[n - 1] == '\r')))
+			line[--n] = 0;
+		parse(line);
+	}
+	if ((state == AT_DATA) && data_expected())
+		data_end();
+
+	if (script) {
+		putc(SC_END, out);
+		rewind(out);
+		while ((n = fread(line, 1, sizeof(line), out)) > 0)
+			fwrite(line, 1, n, stdout);
+		fclose(out);
+	}
+
+	if (f != stdin)
+		fclose(f);
+	return 0;
+}
@@ -0,0 +1,127 @@
+/* vfs101 fingerprint driver: embedding API
+ *
+ * Build proto.c with -DVFS101_LIBRARY (make src/libvfs101.a) to leave out
+ * main() and link the driver into a host application. The host watches
+ * the file descriptors from vfs_get_pollfds() in its own poll/epoll loop,
+ * wakes up no later than vfs_get_timeout() asks, and calls
+ * vfs_dev_handle_events() whenever either fires. Scans started with
+ * vfs_scan_start() run inside those calls, and report back through their
+ * callback; none of the scan calls waits on the reader.
+ *
+ * Three calls do block: vfs_dev_open() while it claims and resets the
+ * reader, vfs_dev_init() for the whole of its configuration, and
+ * vfs_dev_free() while it resets the reader again.
+ *
+ * Copyright (c) 2010 Damir Syabitov <dsyabitov@gmail.com>
+ * Copyright (c) 2010 Ray Lehtiniemi <rayl@mail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#ifndef VFS101_H
+#define VFS101_H
+
+#include <stdio.h>
+
+struct pollfd;
+struct vfs_dev;
+
+/* called as the driver's file descriptors come and go */
+typedef void (*vfs_pollfd_added)   (int fd, short events, void *user);
+typedef void (*vfs_pollfd_removed) (int fd, void *user);
+
+/* bytes in each row of a scanned image */
+#define VFS_IMAGE_WIDTH 200
+
+/* what a scan callback is being told */
+enum vfs_scan_event {
+	VFS_SCAN_FINGER,	/* finger on the sensor, the swipe is loading */
+	VFS_SCAN_LINES,		/* image holds the first lines rows so far */
+	VFS_SCAN_DONE,		/* swipe over, image holds all lines rows */
+	VFS_SCAN_ERROR,		/* scan failed or was cancelled, lines is the error code */
+};
+
+struct vfs_scan_opts {
+	/* keep no more than this many rows, or 0 for all of them */
+	int max_lines;
+
+	/* ms between finger polls, or 0 for 50 */
+	int poll_ms;
+
+	/* nonzero to correct for swipe speed, resampling the image to the
+	 * same scale along the swipe as across it */
+	int resample;
+};
+
+/* Called from vfs_dev_handle_events() as a scan progresses. The image is
+ * only valid until the callback returns; DONE and ERROR end the scan. Rows
+ * hidden under the reader's info lines are rebuilt from their neighbours,
+ * so the image is full height. */
+typedef void (*vfs_scan_cb) (struct vfs_dev *dev, int event, const unsigned char *image, int lines, void *user);
+
+/* A reader talking through the "usb", "sim" or "replay" backend, or NULL
+ * for usb. Returns NULL for an unknown backend or when out of memory. */
+struct vfs_dev *vfs_dev_new (const char *backend);
+
+/* close the reader, resetting it, which blocks, and free it */
+void vfs_dev_free (struct vfs_dev *dev);
+
+/* Send the protocol log, every command and reply as proto prints them, to
+ * log, or nowhere if log is NULL. A new reader starts with NULL. */
+void vfs_dev_set_log (struct vfs_dev *dev, FILE *log);
+
+/* open the reader; 0 or a negative libusb error code */
+int vfs_dev_open (struct vfs_dev *dev);
+
+/* Configure the reader after opening it, blocking until it is done: up to
+ * a few hundred commands, each waited on in turn once the pipeline is
+ * full. Fails with VFS_ERR_BUSY while a scan is in progress. */
+int vfs_dev_init (struct vfs_dev *dev);
+
+/* Errors of the driver's own, beside the libusb ones from -1 to -99 */
+enum vfs_error {
+	VFS_ERR_INVAL    = -100,	/* command does not fit in a packet */
+	VFS_ERR_SHORT    = -101,	/* short write on EP 0x01 */
+	VFS_ERR_NO_REPLY = -102,	/* no reply to a command that can't be resent */
+	VFS_ERR_SEQ      = -103,	/* replies came, but none for this command */
+	VFS_ERR_RETRY    = -104,	/* no reply even after 3 resends */
+	VFS_ERR_STOPPED  = -105,	/* interrupted, or the reader left the bus */
+	VFS_ERR_PROTO    = -106,	/* reply too short to make sense of */
+	VFS_ERR_BUSY     = -107,	/* a non-blocking scan is in progress */
+	VFS_ERR_SCRIPT   = -108,	/* command script missing or malformed */
+};
+
+/* describe a negative error code from any vfs_ function */
+const char *vfs_strerror (int r);
+
+/* Fill in up to max pollfds to watch, returning how many there are */
+int vfs_get_pollfds (struct vfs_dev *dev, struct pollfd *fds, int max);
+
+/* track pollfds as they change, instead of calling vfs_get_pollfds() again */
+void vfs_set_pollfd_notifiers (struct vfs_dev *dev, vfs_pollfd_added added, vfs_pollfd_removed removed, void *user);
+
+/* milliseconds until vfs_dev_handle_events() must be called, or -1 */
+int vfs_get_timeout (struct vfs_dev *dev);
+
+/* do whatever work is ready, without waiting; 0 or a negative error code */
+int vfs_dev_handle_events (struct vfs_dev *dev);
+
+/* Arm the reader and wait for a swipe, without blocking. opts may be NULL.
+ * Only one scan runs at a time; others fail with VFS_ERR_BUSY until it ends. */
+int vfs_scan_start (struct vfs_dev *dev, const struct vfs_scan_opts *opts, vfs_scan_cb cb, void *user);
+
+/* end the scan in progress, which reports VFS_SCAN_ERROR */
+int vfs_scan_cancel (struct vfs_dev *dev);
+
+#endif
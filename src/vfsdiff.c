@@ -0,0 +1,488 @@
+/* vfs101 session diff
+ *
+ * Lines a Linux run up against a Windows capture by the commands each one
+ * sent, rather than by URB number, so a single extra or missing command
+ * only shows up once instead of throwing off every comparison after it:
+ *
+ *   vfsdiff [-n N] CAPTURE RUN
+ *
+ * Either side may be a trace from "proto ... trace=FILE", a command script
+ * from "Snoop2Api.pl -b" or "usbsnoop -b", or the SEND/RECV/LOAD/TIME text
+ * from UsbSnoop.pl or usbsnoop. Commands and LoadImage calls are matched
+ * on their command id and arguments with Myers' O(ND) diff, and vfsdiff
+ * lists the commands missing from the run (-), inserted in it (+), and
+ * matched but answered differently (!). When both sides carry timestamps,
+ * it also lists the N (default 5) largest changes in the time between
+ * matched commands. Exits with 0 when the sessions agree, 1 when they
+ * don't, and 2 on trouble.
+ *
+ * Copyright (c) 2010 Damir Syabitov <dsyabitov@gmail.com>
+ * Copyright (c) 2010 Ray Lehtiniemi <rayl@mail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+const unsigned int FRAME_SIZE = 292;
+
+#include "dump.h"
+#include "trace.h"
+#include "script.h"
+
+#define MAX_LINE 1024
+
+/* A command or LoadImage call. The key is what gets matched: the command
+ * id and arguments as sent, without the sequence number, or just SC_LOAD.
+ * The reply has its 4 byte header stripped, as in the results tables. */
+struct event {
+	int urb;
+	long long t;
+
+	unsigned int hash;
+	unsigned char key[0x40];
+	int klen;
+
+	unsigned char reply[0x40];
+	int rlen;
+};
+
+struct session {
+	const char *name;
+	struct event *ev;
+	int n;
+	int max;
+
+	/* first event still waiting for its reply, in a trace */
+	int answered;
+
+	/* per event: not matched on the other side */
+	unsigned char *lone;
+};
+
+/******************************************************************************************************
+ * Loading sessions
+ */
+
+static struct event *add (struct session *s, const unsigned char *key, int klen, int urb, long long t)
+{
+	struct event *e;
+	int i;
+
+	if (s->n == s->max) {
+		s->max = s->max ? 2 * s->max : 1024;
+		s->ev = realloc(s->ev, s->max * sizeof(*s->ev));
+		if (s->ev == NULL) {
+			fprintf(stderr, "Out of memory\n");
+			exit(2);
+		}
+	}
+	e = &s->ev[s->n++];
+	if (klen > sizeof(e->key))
+		klen = sizeof(e->key);
+	memcpy(e->key, key, klen);
+	e->klen = klen;
+	e->urb = urb;
+	e->t = t;
+	e->rlen = -1;
+
+	/* FNV-1a */
+	e->hash = 2166136261u;
+	for (i = 0; i < klen; i++)
+		e->hash = (e->hash ^ key[i]) * 16777619u;
+	return e;
+}
+
+static void answer (struct event *e, const unsigned char *data, int len)
+{
+	if ((e == NULL) || (len < 4) || (e->key[0] == SC_LOAD) || (e->rlen >= 0))
+		return;
+	e->rlen = (len - 4 > sizeof(e->reply)) ? sizeof(e->reply) : len - 4;
+	memcpy(e->reply, data + 4, e->rlen);
+}
+
+static const unsigned char load_key[1] = { SC_LOAD };
+
+static int load_trace (struct session *s, FILE *f)
+{
+	static unsigned char data[0x10000];
+	struct trace_rec rec;
+
+	while (fread(&rec, sizeof(rec), 1, f) == 1) {
+		if (fread(data, 1, rec.len, f) != rec.len) {
+			fprintf(stderr, "%s: truncated record at end of trace\n", s->name);
+			break;
+		}
+		if ((rec.type == TR_SEND) && (rec.len > 4))
+			add(s, data + 4, rec.len - 4, rec.arg, rec.t);
+		else if (rec.type == TR_RECV) {
+			/* replies come back in the order the commands went out */
+			while ((s->answered < s->n) && (s->ev[s->answered].key[0] == SC_LOAD))
+				s->answered++;
+			if (s->answered < s->n)
+				answer(&s->ev[s->answered++], data, rec.len);
+		}
+		else if (rec.type == TR_LOAD)
+			add(s, load_key, 1, -1, rec.t);
+	}
+	return 0;
+}
+
+static int load_script (struct session *s, FILE *f)
+{
+	unsigned char buf[0x40];
+	int op, cmd, urb, n, i;
+
+	while ((op = getc(f)) != EOF && (op != SC_END)) {
+		if (op == SC_LOAD) {
+			add(s, load_key, 1, -1, -1);
+			continue;
+		}
+
+		urb = -1;
+		if ((op == SC_RESULT) || (op & SC_CHECK)) {
+			urb = getc(f);
+			urb |= getc(f) << 8;
+		}
+		if (op == SC_RESULT) {
+			n = getc(f);
+			if ((n < 0) || (fread(buf + 4, 1, n, f) != n))
+				break;
+			for (i = s->n - 1; (i >= 0) && (s->ev[i].urb != urb); i--)
+				;
+			if (i >= 0)
+				answer(&s->ev[i], buf, n + 4);
+			continue;
+		}
+
+		cmd = op & ~SC_CHECK;
+		if ((cmd >= sizeof(sc_args)) || (sc_args[cmd] < 0)) {
+			fprintf(stderr, "%s: bad op %02x\n", s->name, op);
+			return -1;
+		}
+		buf[0] = cmd;
+		buf[1] = 0;
+		if (fread(buf + 2, 1, sc_args[cmd], f) != sc_args[cmd])
+			break;
+		add(s, buf, 2 + sc_args[cmd], urb, -1);
+	}
+	if (op != SC_END)
+		fprintf(stderr, "%s: script ends early\n", s->name);
+	return 0;
+}
+
+/* the packet being gathered from consecutive SEND, RECV or LOAD lines */
+static void text_packet (struct session *s, char type, unsigned char *p, int n, int urb, long long t)
+{
+	if ((type == 'S') && (n > 4))
+		add(s, p + 4, n - 4, urb, t);
+	else if ((type == 'R') && (s->n > 0))
+		answer(&s->ev[s->n - 1], p, n);
+	else if (type == 'L')
+		add(s, load_key, 1, -1, -1);
+}
+
+static int load_text (struct session *s, FILE *f)
+{
+	char line[MAX_LINE], *hex, *end;
+	unsigned char p[0x40];
+	char type = 0;
+	long long t = -1;
+	int n = 0, urb = -1;
+	long b, ms, seq;
+
+	while (fgets(line, sizeof(line), f)) {
+		if (sscanf(line, "TIME: %ld %ld", &ms, &seq) == 2) {
+			text_packet(s, type, p, n, urb, t);
+			type = 0;
+			t = ms * 1000;
+			urb = seq;
+			continue;
+		}
+		if ((strncmp(line, "SEND:", 5) != 0) && (strncmp(line, "RECV:", 5) != 0) && (strncmp(line, "LOAD:", 5) != 0)) {
+			fprintf(stderr, "%s: ignoring %s", s->name, line);
+			continue;
+		}
+		if (line[0] != type) {
+			text_packet(s, type, p, n, urb, t);
+			type = line[0];
+			n = 0;
+		}
+		for (hex = line + 5; ((b = strtol(hex, &end, 16)), end != hex) && (n < sizeof(p)); hex = end)
+			p[n++] = b;
+	}
+	text_packet(s, type, p, n, urb, t);
+	return 0;
+}
+
+static int load (struct session *s, const char *name)
+{
+	char magic[8];
+	FILE *f;
+	int r;
+
+	memset(s, 0, sizeof(*s));
+	s->name = name;
+	f = fopen(name, "rb");
+	if (f == NULL) {
+		fprintf(stderr, "Can't open %s\n", name);
+		return -1;
+	}
+
+	if ((fread(magic, 1, 8, f) == 8) && (memcmp(magic, TRACE_MAGIC, 8) == 0)) {
+		r = load_trace(s, f);
+	} else if (memcmp(magic, SCRIPT_MAGIC, 8) == 0) {
+		r = load_script(s, f);
+	} else {
+		rewind(f);
+		r = load_text(s, f);
+	}
+	fclose(f);
+
+	s->lone = calloc(s->n + 1, 1);
+	if (s->lone == NULL) {
+		fprintf(stderr, "Out of memory\n");
+		return -1;
+	}
+	return r;
+}
+
+
+/******************************************************************************************************
+ * Myers' diff, in linear space
+ *
+ * Each call trims the common head and tail, finds a point on an optimal
+ * edit path where the forward and backward searches meet, and splits the
+ * problem there. Whatever is left unmatched gets marked lone.
+ */
+
+static struct session *A, *B;
+static int *vf, *vb;
+
+static int same (int i, int j)
+{
+	struct event *a = &A->ev[i], *b = &B->ev[j];
+	return (a->hash == b->hash) && (a->klen == b->klen) && (memcmp(a->key, b->key, a->klen) == 0);
+}
+
+static void myers (int a0, int a1, int b0, int b1)
+{
+	int n, m, delta, max, d, k, x, y, off, i;
+
+	while ((a0 < a1) && (b0 < b1) && same(a0, b0))
+		a0++, b0++;
+	while ((a0 < a1) && (b0 < b1) && same(a1 - 1, b1 - 1))
+		a1--, b1--;
+	if ((a0 == a1) || (b0 == b1)) {
+		for (i = a0; i < a1; i++)
+			A->lone[i] = 1;
+		for (i = b0; i < b1; i++)
+			B->lone[i] = 1;
+		return;
+	}
+
+	/* vf[k] is how far along a the forward search got on diagonal k = x - y,
+	 * and vb[k] how far back from the end the backward one got on
+	 * diagonal delta - k */
+	n = a1 - a0;
+	m = b1 - b0;
+	delta = n - m;
+	max = (n + m + 1) / 2;
+	off = max + 1;
+	vf[off + 1] = 0;
+	vb[off + 1] = 0;
+
+	for (d = 0; d <= max; d++) {
+		for (k = -d; k <= d; k += 2) {
+			x = ((k == -d) || ((k != d) && (vf[off + k - 1] < vf[off + k + 1]))) ? vf[off + k + 1] : vf[off + k - 1] + 1;
+			y = x - k;
+			while ((x < n) && (y < m) && same(a0 + x, b0 + y))
+				x++, y++;
+			vf[off + k] = x;
+			if ((delta & 1) && (delta - k >= -(d - 1)) && (delta - k <= d - 1) && (x + vb[off + delta - k] >= n)) {
+				myers(a0, a0 + x, b0, b0 + y);
+				myers(a0 + x, a1, b0 + y, b1);
+				return;
+			}
+		}
+		for (k = -d; k <= d; k += 2) {
+			x = ((k == -d) || ((k != d) && (vb[off + k - 1] < vb[off + k + 1]))) ? vb[off + k + 1] : vb[off + k - 1] + 1;
+			y = x - k;
+			while ((x < n) && (y < m) && same(a1 - x - 1, b1 - y - 1))
+				x++, y++;
+			vb[off + k] = x;
+			if (!(delta & 1) && (delta - k >= -d) && (delta - k <= d) && (x + vf[off + delta - k] >= n)) {
+				myers(a0, a1 - x, b0, b1 - y);
+				myers(a1 - x, a1, b1 - y, b1);
+				return;
+			}
+		}
+	}
+}
+
+
+/******************************************************************************************************
+ * Report
+ */
+
+static void describe (struct session *s, int i)
+{
+	struct event *e = &s->ev[i];
+	char where[64];
+	int j;
+
+	if (e->urb >= 0)
+		snprintf(where, sizeof(where), "%s #%d (URB %d)", s->name, i + 1, e->urb);
+	else
+		snprintf(where, sizeof(where), "%s #%d", s->name, i + 1);
+	printf("%-32s ", where);
+
+	if (e->key[0] == SC_LOAD) {
+		printf("LoadImage\n");
+		return;
+	}
+	printf("%s", (e->key[0] < sizeof(sc_args)) && cmd_names[e->key[0]] ? cmd_names[e->key[0]] : "???");
+	for (j = 2; j < e->klen; j++)
+		printf(" %02X", e->key[j]);
+	printf("\n");
+}
+
+/* the biggest changes in the time from one matched command to the next */
+struct gap {
+	long long delta;
+	int i, j;
+};
+
+static struct gap *gaps;
+static int ngaps;
+
+static void gap (long long delta, int i, int j)
+{
+	int g;
+
+	if (delta == 0)
+		return;
+	for (g = ngaps; (g > 0) && ((gaps[g - 1].i < 0) || (llabs(gaps[g - 1].delta) < llabs(delta))); g--)
+		;
+	if (g >= ngaps)
+		return;
+	memmove(gaps + g + 1, gaps + g, (ngaps - g - 1) * sizeof(*gaps));
+	gaps[g].delta = delta;
+	gaps[g].i = i;
+	gaps[g].j = j;
+}
+
+static int report (struct session *a, struct session *b)
+{
+	int i = 0, j = 0, pi = -1, pj = -1, gapped = 1;
+	int missing = 0, inserted = 0, divergent = 0, matched = 0;
+	struct event *ea, *eb;
+
+	while ((i < a->n) || (j < b->n)) {
+		if ((i < a->n) && a->lone[i]) {
+			if (!gapped) printf("\n");
+			printf("- ");
+			describe(a, i++);
+			missing++;
+			gapped = 1;
+			continue;
+		}
+		if ((j < b->n) && b->lone[j]) {
+			if (!gapped) printf("\n");
+			printf("+ ");
+			describe(b, j++);
+			inserted++;
+			gapped = 1;
+			continue;
+		}
+
+		ea = &a->ev[i];
+		eb = &b->ev[j];
+		matched++;
+		if ((ea->rlen >= 0) && (eb->rlen >= 0) &&
+		    ((ea->rlen != eb->rlen) || (memcmp(ea->reply, eb->reply, ea->rlen) != 0))) {
+			if (!gapped) printf("\n");
+			printf("! ");
+			describe(a, i);
+			printf("  ");
+			describe(b, j);
+			dump_buffer(stdout, ea->reply, ea->rlen, "    <---");
+			dump_buffer(stdout, eb->reply, eb->rlen, "    <---");
+			divergent++;
+			gapped = 1;
+		} else if (gapped) {
+			gapped = 0;
+		}
+
+		if ((ea->t >= 0) && (eb->t >= 0)) {
+			if (pi >= 0)
+				gap((eb->t - b->ev[pj].t) - (ea->t - a->ev[pi].t), i, j);
+			pi = i;
+			pj = j;
+		}
+		i++;
+		j++;
+	}
+
+	printf("\n%d matched, %d missing from %s, %d inserted in %s, %d answered differently\n",
+		matched, missing, b->name, inserted, b->name, divergent);
+
+	if ((ngaps > 0) && (gaps[0].i >= 0)) {
+		printf("largest changes in the time between matched commands:\n");
+		for (i = 0; (i < ngaps) && (gaps[i].i >= 0); i++) {
+			printf("  %+9.1f ms before ", gaps[i].delta / 1000.0);
+			describe(b, gaps[i].j);
+		}
+	}
+
+	return (missing || inserted || divergent) ? 1 : 0;
+}
+
+int main (int argc, char **argv)
+{
+	struct session a, b;
+	int i, n = 5;
+
+	for (i = 1; (i < argc - 2) && (argv[i][0] == '-'); i++) {
+		if ((strcmp(argv[i], "-n") == 0) && (i < argc - 3))
+			n = atoi(argv[++i]);
+		else
+			fprintf(stderr, "ignoring unknown option \"%s\"\n", argv[i]);
+	}
+	if (i != argc - 2) {
+		fprintf(stderr, "usage: %s [-n N] CAPTURE RUN\n", argv[0]);
+		return 2;
+	}
+
+	if ((load(&a, argv[i]) < 0) || (load(&b, argv[i + 1]) < 0))
+		return 2;
+
+	vf = malloc((a.n + b.n + 3) * sizeof(*vf));
+	vb = malloc((a.n + b.n + 3) * sizeof(*vb));
+	ngaps = (n > 0) ? n : 0;
+	gaps = malloc((ngaps + 1) * sizeof(*gaps));
+	if ((vf == NULL) || (vb == NULL) || (gaps == NULL)) {
+		fprintf(stderr, "Out of memory\n");
+		return 2;
+	}
+	for (i = 0; i < ngaps; i++)
+		gaps[i].delta = 0, gaps[i].i = gaps[i].j = -1;
+
+	A = &a;
+	B = &b;
+	myers(0, a.n, 0, b.n);
+	return report(&a, &b);
+}
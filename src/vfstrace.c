@@ -0,0 +1,136 @@
+/* vfs101 trace decoder
+ *
+ * Turns a binary trace recorded with "proto ... trace=FILE" back into the
+ * text proto prints on stdout when it is not tracing.
+ *
+ *   vfstrace [-t] FILE
+ *
+ * -t adds the time of each command and scan, in us since the trace began,
+ * and the round trip time of each reply.
+ *
+ * Copyright (c) 2010 Damir Syabitov <dsyabitov@gmail.com>
+ * Copyright (c) 2010 Ray Lehtiniemi <rayl@mail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+const unsigned int FRAME_SIZE = 292;
+
+#include "dump.h"
+#include "trace.h"
+
+static int timestamps = 0;
+
+/* the scan being decoded, printed as its lines come as proto does */
+static struct frame_dump scan;
+
+static void header (struct trace_rec *rec, const char *name, int n)
+{
+	fprintf(stdout, "\n> %s (%d)\n", name, n);
+	if (timestamps)
+		fprintf(stdout, "  at %lld us\n", rec->t);
+}
+
+static void decode (struct trace_rec *rec, unsigned char *data)
+{
+	const char *name = NULL;
+
+	switch (rec->type) {
+	case TR_SEND:
+		if ((rec->len > 4) && (data[4] < 0x17))
+			name = cmd_names[data[4]];
+		header(rec, name ? name : "???", rec->arg);
+		dump_buffer(stdout, data, rec->len, "  --->");
+		break;
+
+	case TR_RECV:
+		dump_buffer(stdout, data, rec->len, "  <---");
+		if (timestamps)
+			fprintf(stdout, "  rtt %d us\n", rec->arg);
+		break;
+
+	case TR_CHECK:
+		if (rec->arg < 0)
+			printf("  !!!! no result to check against! !!!!\n");
+		else
+			dump_buffer(stdout, data, rec->len, "  XXXX            ");
+		break;
+
+	case TR_LOAD:
+		header(rec, "LoadImage", rec->arg);
+		break;
+
+	case TR_SCAN:
+		dump_scan_begin(stdout, &scan);
+		break;
+
+	case TR_LINE:
+		dump_scan_data(&scan, data, rec->len);
+		break;
+
+	case TR_END:
+		dump_scan_end(&scan);
+		break;
+
+	default:
+		fprintf(stderr, "unknown record type %d\n", rec->type);
+		break;
+	}
+}
+
+int main (int argc, char **argv)
+{
+	static unsigned char data[0x10000];
+	struct trace_rec rec;
+	char magic[8];
+	FILE *f;
+	int i;
+
+	for (i = 1; (i < argc - 1) && (argv[i][0] == '-'); i++) {
+		if (strcmp(argv[i], "-t") == 0)
+			timestamps = 1;
+		else
+			fprintf(stderr, "ignoring unknown option \"%s\"\n", argv[i]);
+	}
+	if (i != argc - 1) {
+		fprintf(stderr, "usage: %s [-t] FILE\n", argv[0]);
+		return 1;
+	}
+
+	f = fopen(argv[i], "rb");
+	if (f == NULL) {
+		fprintf(stderr, "Can't open %s\n", argv[i]);
+		return 1;
+	}
+
+	if ((fread(magic, 1, 8, f) != 8) || (memcmp(magic, TRACE_MAGIC, 8) != 0)) {
+		fprintf(stderr, "%s is not a vfs101 trace\n", argv[i]);
+		return 1;
+	}
+
+	while (fread(&rec, sizeof(rec), 1, f) == 1) {
+		if (fread(data, 1, rec.len, f) != rec.len) {
+			fprintf(stderr, "truncated record at end of trace\n");
+			break;
+		}
+		decode(&rec, data);
+	}
+
+	fclose(f);
+	return 0;
+}